@@ -0,0 +1,104 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/helpers/helpers.cmake"
+  "/root/repo/packages/CMakeLists.txt"
+  "/root/repo/packages/ropen/CMakeLists.txt"
+  "/root/repo/packages/terminalpp/CMakeLists.txt"
+  "/root/repo/packages/tpp-bypass/CMakeLists.txt"
+  "/root/repo/ropen/CMakeLists.txt"
+  "/root/repo/terminalpp/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tpp-bypass/CMakeLists.txt"
+  "/root/repo/tpp-bypass/install.sh"
+  "/root/repo/tpp-lib/CMakeLists.txt"
+  "/root/repo/tpp-server/CMakeLists.txt"
+  "/root/repo/ui-terminal/CMakeLists.txt"
+  "/root/repo/ui/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tpp-bypass/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tpp-server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tpp-lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ropen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ui-terminal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "terminalpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "packages/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "packages/terminalpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "packages/tpp-bypass/tpp-bypass-source/install.sh"
+  "packages/tpp-bypass/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "packages/ropen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/stamp-generator.dir/DependInfo.cmake"
+  "CMakeFiles/stamp.dir/DependInfo.cmake"
+  "tpp-bypass/CMakeFiles/tpp-bypass.dir/DependInfo.cmake"
+  "tpp-server/CMakeFiles/tpp-server.dir/DependInfo.cmake"
+  "tpp-lib/CMakeFiles/libtpp.dir/DependInfo.cmake"
+  "ropen/CMakeFiles/ropen.dir/DependInfo.cmake"
+  "ui/CMakeFiles/libui.dir/DependInfo.cmake"
+  "ui-terminal/CMakeFiles/libuiterminal.dir/DependInfo.cmake"
+  "tests/CMakeFiles/tests.dir/DependInfo.cmake"
+  "tools/CMakeFiles/xIconCpp.dir/DependInfo.cmake"
+  "tools/CMakeFiles/icons.dir/DependInfo.cmake"
+  "tools/CMakeFiles/unicodeTablesCpp.dir/DependInfo.cmake"
+  "tools/CMakeFiles/unicode.dir/DependInfo.cmake"
+  "tools/CMakeFiles/cloc.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchmarks.dir/DependInfo.cmake"
+  "packages/CMakeFiles/packages.dir/DependInfo.cmake"
+  "packages/tpp-bypass/CMakeFiles/tpp-bypass-source.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stamp-generator.dir/helpers/stamp_generator.cpp.o"
+  "CMakeFiles/stamp-generator.dir/helpers/stamp_generator.cpp.o.d"
+  "stamp-generator"
+  "stamp-generator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stamp-generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "/root/repo/stamp.h"
+  "CMakeFiles/stamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/stamp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
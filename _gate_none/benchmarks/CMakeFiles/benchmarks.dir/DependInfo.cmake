@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/bypass.cpp" "benchmarks/CMakeFiles/benchmarks.dir/bypass.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/bypass.cpp.o.d"
+  "/root/repo/benchmarks/event_queue.cpp" "benchmarks/CMakeFiles/benchmarks.dir/event_queue.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/event_queue.cpp.o.d"
+  "/root/repo/benchmarks/json.cpp" "benchmarks/CMakeFiles/benchmarks.dir/json.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/json.cpp.o.d"
+  "/root/repo/benchmarks/json_config.cpp" "benchmarks/CMakeFiles/benchmarks.dir/json_config.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/json_config.cpp.o.d"
+  "/root/repo/benchmarks/main-benchmarks.cpp" "benchmarks/CMakeFiles/benchmarks.dir/main-benchmarks.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/main-benchmarks.cpp.o.d"
+  "/root/repo/benchmarks/terminal.cpp" "benchmarks/CMakeFiles/benchmarks.dir/terminal.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/terminal.cpp.o.d"
+  "/root/repo/benchmarks/utf8.cpp" "benchmarks/CMakeFiles/benchmarks.dir/utf8.cpp.o" "gcc" "benchmarks/CMakeFiles/benchmarks.dir/utf8.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_none/ui-terminal/CMakeFiles/libuiterminal.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/tpp-lib/CMakeFiles/libtpp.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/ui/CMakeFiles/libui.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks.dir/bypass.cpp.o"
+  "CMakeFiles/benchmarks.dir/bypass.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/event_queue.cpp.o"
+  "CMakeFiles/benchmarks.dir/event_queue.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/json.cpp.o"
+  "CMakeFiles/benchmarks.dir/json.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/json_config.cpp.o"
+  "CMakeFiles/benchmarks.dir/json_config.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/main-benchmarks.cpp.o"
+  "CMakeFiles/benchmarks.dir/main-benchmarks.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/terminal.cpp.o"
+  "CMakeFiles/benchmarks.dir/terminal.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/utf8.cpp.o"
+  "CMakeFiles/benchmarks.dir/utf8.cpp.o.d"
+  "benchmarks"
+  "benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tpp-bypass-source"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tpp-bypass-source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ropen.dir/main_ropen.cpp.o"
+  "CMakeFiles/ropen.dir/main_ropen.cpp.o.d"
+  "ropen"
+  "ropen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ropen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/helpers/tests/char.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/char.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/char.cpp.o.d"
+  "/root/repo/helpers/tests/events.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/events.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/events.cpp.o.d"
+  "/root/repo/helpers/tests/fsm.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/fsm.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/fsm.cpp.o.d"
+  "/root/repo/helpers/tests/json.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/json.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/json.cpp.o.d"
+  "/root/repo/helpers/tests/string.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/string.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/string.cpp.o.d"
+  "/root/repo/helpers/tests/time.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/time.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/time.cpp.o.d"
+  "/root/repo/helpers/tests/version.cpp" "tests/CMakeFiles/tests.dir/__/helpers/tests/version.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/helpers/tests/version.cpp.o.d"
+  "/root/repo/ui-terminal/tests/ansi_terminal.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/ansi_terminal.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/ansi_terminal.cpp.o.d"
+  "/root/repo/ui-terminal/tests/compact_row.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/compact_row.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/compact_row.cpp.o.d"
+  "/root/repo/ui-terminal/tests/fast_forward.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/fast_forward.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/fast_forward.cpp.o.d"
+  "/root/repo/ui-terminal/tests/key_table.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/key_table.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/key_table.cpp.o.d"
+  "/root/repo/ui-terminal/tests/terminal_history.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/terminal_history.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/terminal_history.cpp.o.d"
+  "/root/repo/ui-terminal/tests/trigger_matcher.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/trigger_matcher.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/trigger_matcher.cpp.o.d"
+  "/root/repo/ui-terminal/tests/url_matcher.cpp" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/url_matcher.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui-terminal/tests/url_matcher.cpp.o.d"
+  "/root/repo/ui/tests/buffer.cpp" "tests/CMakeFiles/tests.dir/__/ui/tests/buffer.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui/tests/buffer.cpp.o.d"
+  "/root/repo/ui/tests/canvas.cpp" "tests/CMakeFiles/tests.dir/__/ui/tests/canvas.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui/tests/canvas.cpp.o.d"
+  "/root/repo/ui/tests/event_queue.cpp" "tests/CMakeFiles/tests.dir/__/ui/tests/event_queue.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/ui/tests/event_queue.cpp.o.d"
+  "/root/repo/tests/main-tests.cpp" "tests/CMakeFiles/tests.dir/main-tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/main-tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_none/ui-terminal/CMakeFiles/libuiterminal.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/tpp-lib/CMakeFiles/libtpp.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/ui/CMakeFiles/libui.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
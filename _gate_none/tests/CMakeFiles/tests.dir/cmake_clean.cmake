@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/__/helpers/tests/char.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/char.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/events.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/events.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/fsm.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/fsm.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/json.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/json.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/string.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/string.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/time.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/time.cpp.o.d"
+  "CMakeFiles/tests.dir/__/helpers/tests/version.cpp.o"
+  "CMakeFiles/tests.dir/__/helpers/tests/version.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/ansi_terminal.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/ansi_terminal.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/compact_row.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/compact_row.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/fast_forward.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/fast_forward.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/key_table.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/key_table.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/terminal_history.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/terminal_history.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/trigger_matcher.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/trigger_matcher.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/url_matcher.cpp.o"
+  "CMakeFiles/tests.dir/__/ui-terminal/tests/url_matcher.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui/tests/buffer.cpp.o"
+  "CMakeFiles/tests.dir/__/ui/tests/buffer.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui/tests/canvas.cpp.o"
+  "CMakeFiles/tests.dir/__/ui/tests/canvas.cpp.o.d"
+  "CMakeFiles/tests.dir/__/ui/tests/event_queue.cpp.o"
+  "CMakeFiles/tests.dir/__/ui/tests/event_queue.cpp.o.d"
+  "CMakeFiles/tests.dir/main-tests.cpp.o"
+  "CMakeFiles/tests.dir/main-tests.cpp.o.d"
+  "tests"
+  "tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cloc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/cloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/icons"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/icons.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unicodeTablesCpp.dir/unicodeTablesCpp.cpp.o"
+  "CMakeFiles/unicodeTablesCpp.dir/unicodeTablesCpp.cpp.o.d"
+  "unicodeTablesCpp"
+  "unicodeTablesCpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unicodeTablesCpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
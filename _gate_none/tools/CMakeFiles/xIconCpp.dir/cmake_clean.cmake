@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xIconCpp.dir/xIconCpp.cpp.o"
+  "CMakeFiles/xIconCpp.dir/xIconCpp.cpp.o.d"
+  "xIconCpp"
+  "xIconCpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xIconCpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tpp-bypass.dir/main_bypass.cpp.o"
+  "CMakeFiles/tpp-bypass.dir/main_bypass.cpp.o.d"
+  "tpp-bypass"
+  "tpp-bypass.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tpp-bypass.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
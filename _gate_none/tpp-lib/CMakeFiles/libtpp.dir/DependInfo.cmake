@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tpp-lib/bypass_pty.cpp" "tpp-lib/CMakeFiles/libtpp.dir/bypass_pty.cpp.o" "gcc" "tpp-lib/CMakeFiles/libtpp.dir/bypass_pty.cpp.o.d"
+  "/root/repo/tpp-lib/local_pty.cpp" "tpp-lib/CMakeFiles/libtpp.dir/local_pty.cpp.o" "gcc" "tpp-lib/CMakeFiles/libtpp.dir/local_pty.cpp.o.d"
+  "/root/repo/tpp-lib/remote_files.cpp" "tpp-lib/CMakeFiles/libtpp.dir/remote_files.cpp.o" "gcc" "tpp-lib/CMakeFiles/libtpp.dir/remote_files.cpp.o.d"
+  "/root/repo/tpp-lib/sequence.cpp" "tpp-lib/CMakeFiles/libtpp.dir/sequence.cpp.o" "gcc" "tpp-lib/CMakeFiles/libtpp.dir/sequence.cpp.o.d"
+  "/root/repo/tpp-lib/terminal_client.cpp" "tpp-lib/CMakeFiles/libtpp.dir/terminal_client.cpp.o" "gcc" "tpp-lib/CMakeFiles/libtpp.dir/terminal_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtpp.dir/bypass_pty.cpp.o"
+  "CMakeFiles/libtpp.dir/bypass_pty.cpp.o.d"
+  "CMakeFiles/libtpp.dir/local_pty.cpp.o"
+  "CMakeFiles/libtpp.dir/local_pty.cpp.o.d"
+  "CMakeFiles/libtpp.dir/remote_files.cpp.o"
+  "CMakeFiles/libtpp.dir/remote_files.cpp.o.d"
+  "CMakeFiles/libtpp.dir/sequence.cpp.o"
+  "CMakeFiles/libtpp.dir/sequence.cpp.o.d"
+  "CMakeFiles/libtpp.dir/terminal_client.cpp.o"
+  "CMakeFiles/libtpp.dir/terminal_client.cpp.o.d"
+  "liblibtpp.a"
+  "liblibtpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tpp-server/main_tpp_server.cpp" "tpp-server/CMakeFiles/tpp-server.dir/main_tpp_server.cpp.o" "gcc" "tpp-server/CMakeFiles/tpp-server.dir/main_tpp_server.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_none/ui-terminal/CMakeFiles/libuiterminal.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/ui/CMakeFiles/libui.dir/DependInfo.cmake"
+  "/root/repo/_gate_none/tpp-lib/CMakeFiles/libtpp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tpp-server.dir/main_tpp_server.cpp.o"
+  "CMakeFiles/tpp-server.dir/main_tpp_server.cpp.o.d"
+  "tpp-server"
+  "tpp-server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tpp-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
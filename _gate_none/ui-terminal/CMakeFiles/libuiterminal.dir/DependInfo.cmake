@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ui-terminal/ansi_renderer.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/ansi_renderer.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/ansi_renderer.cpp.o.d"
+  "/root/repo/ui-terminal/ansi_terminal.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/ansi_terminal.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/ansi_terminal.cpp.o.d"
+  "/root/repo/ui-terminal/csi_sequence.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/csi_sequence.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/csi_sequence.cpp.o.d"
+  "/root/repo/ui-terminal/osc_sequence.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/osc_sequence.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/osc_sequence.cpp.o.d"
+  "/root/repo/ui-terminal/tests/ansi_terminal.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/ansi_terminal.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/ansi_terminal.cpp.o.d"
+  "/root/repo/ui-terminal/tests/compact_row.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/compact_row.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/compact_row.cpp.o.d"
+  "/root/repo/ui-terminal/tests/fast_forward.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/fast_forward.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/fast_forward.cpp.o.d"
+  "/root/repo/ui-terminal/tests/key_table.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/key_table.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/key_table.cpp.o.d"
+  "/root/repo/ui-terminal/tests/terminal_history.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/terminal_history.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/terminal_history.cpp.o.d"
+  "/root/repo/ui-terminal/tests/trigger_matcher.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/trigger_matcher.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/trigger_matcher.cpp.o.d"
+  "/root/repo/ui-terminal/tests/url_matcher.cpp" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/url_matcher.cpp.o" "gcc" "ui-terminal/CMakeFiles/libuiterminal.dir/tests/url_matcher.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
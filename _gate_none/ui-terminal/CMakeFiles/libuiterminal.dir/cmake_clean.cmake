@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuiterminal.dir/ansi_renderer.cpp.o"
+  "CMakeFiles/libuiterminal.dir/ansi_renderer.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/ansi_terminal.cpp.o"
+  "CMakeFiles/libuiterminal.dir/ansi_terminal.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/csi_sequence.cpp.o"
+  "CMakeFiles/libuiterminal.dir/csi_sequence.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/osc_sequence.cpp.o"
+  "CMakeFiles/libuiterminal.dir/osc_sequence.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/ansi_terminal.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/ansi_terminal.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/compact_row.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/compact_row.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/fast_forward.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/fast_forward.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/key_table.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/key_table.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/terminal_history.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/terminal_history.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/trigger_matcher.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/trigger_matcher.cpp.o.d"
+  "CMakeFiles/libuiterminal.dir/tests/url_matcher.cpp.o"
+  "CMakeFiles/libuiterminal.dir/tests/url_matcher.cpp.o.d"
+  "liblibuiterminal.a"
+  "liblibuiterminal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuiterminal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ui/canvas.cpp" "ui/CMakeFiles/libui.dir/canvas.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/canvas.cpp.o.d"
+  "/root/repo/ui/color.cpp" "ui/CMakeFiles/libui.dir/color.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/color.cpp.o.d"
+  "/root/repo/ui/inputs.cpp" "ui/CMakeFiles/libui.dir/inputs.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/inputs.cpp.o.d"
+  "/root/repo/ui/layout.cpp" "ui/CMakeFiles/libui.dir/layout.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/layout.cpp.o.d"
+  "/root/repo/ui/renderer.cpp" "ui/CMakeFiles/libui.dir/renderer.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/renderer.cpp.o.d"
+  "/root/repo/ui/tests/buffer.cpp" "ui/CMakeFiles/libui.dir/tests/buffer.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/tests/buffer.cpp.o.d"
+  "/root/repo/ui/tests/canvas.cpp" "ui/CMakeFiles/libui.dir/tests/canvas.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/tests/canvas.cpp.o.d"
+  "/root/repo/ui/tests/event_queue.cpp" "ui/CMakeFiles/libui.dir/tests/event_queue.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/tests/event_queue.cpp.o.d"
+  "/root/repo/ui/widget.cpp" "ui/CMakeFiles/libui.dir/widget.cpp.o" "gcc" "ui/CMakeFiles/libui.dir/widget.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
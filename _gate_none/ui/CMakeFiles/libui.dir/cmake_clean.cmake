@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libui.dir/canvas.cpp.o"
+  "CMakeFiles/libui.dir/canvas.cpp.o.d"
+  "CMakeFiles/libui.dir/color.cpp.o"
+  "CMakeFiles/libui.dir/color.cpp.o.d"
+  "CMakeFiles/libui.dir/inputs.cpp.o"
+  "CMakeFiles/libui.dir/inputs.cpp.o.d"
+  "CMakeFiles/libui.dir/layout.cpp.o"
+  "CMakeFiles/libui.dir/layout.cpp.o.d"
+  "CMakeFiles/libui.dir/renderer.cpp.o"
+  "CMakeFiles/libui.dir/renderer.cpp.o.d"
+  "CMakeFiles/libui.dir/tests/buffer.cpp.o"
+  "CMakeFiles/libui.dir/tests/buffer.cpp.o.d"
+  "CMakeFiles/libui.dir/tests/canvas.cpp.o"
+  "CMakeFiles/libui.dir/tests/canvas.cpp.o.d"
+  "CMakeFiles/libui.dir/tests/event_queue.cpp.o"
+  "CMakeFiles/libui.dir/tests/event_queue.cpp.o.d"
+  "CMakeFiles/libui.dir/widget.cpp.o"
+  "CMakeFiles/libui.dir/widget.cpp.o.d"
+  "liblibui.a"
+  "liblibui.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
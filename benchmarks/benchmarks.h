@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "helpers/helpers.h"
+
+/** Defines new micro benchmark. 
+
+    The benchmark body receives a Benchmark object and should repeat the measured work while Benchmark::run() returns true, i.e.:
+
+        BENCHMARK(suite, name) {
+            std::string input = ...; // setup, not measured
+            benchmark.setBytesPerIteration(input.size());
+            while (benchmark.run()) {
+                // measured code
+            }
+        }
+ */
+#define BENCHMARK(SUITE_NAME, NAME) \
+    void Benchmark_ ## SUITE_NAME ## _ ## NAME(Benchmark & benchmark); \
+    static Benchmark::Registration BenchmarkRegistration_ ## SUITE_NAME ## _ ## NAME{# SUITE_NAME, # NAME, Benchmark_ ## SUITE_NAME ## _ ## NAME}; \
+    void Benchmark_ ## SUITE_NAME ## _ ## NAME(Benchmark & benchmark)
+
+/** Prevents the compiler from optimizing away the computation of the given value. 
+
+    Benchmarks should pass their results to it so that the measured code is not eliminated as dead. 
+ */
+template<typename T>
+inline void DoNotOptimize(T const & value) {
+#if (defined __GNUC__ || defined __clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static void const * volatile sink;
+    sink = & value;
+#endif
+}
+
+/** Micro benchmark. 
+
+    Runs the measured code repeatedly for at least MIN_DURATION and MIN_ITERATIONS and reports the average time per iteration and the throughput if the number of bytes processed per iteration is known. 
+ */
+class Benchmark {
+public:
+    using Function = std::function<void(Benchmark &)>;
+
+    static constexpr size_t MIN_ITERATIONS = 3;
+    static constexpr std::chrono::milliseconds MIN_DURATION{500};
+
+    /** Registers the benchmark function with the global list of benchmarks. 
+     */
+    class Registration {
+    public:
+        Registration(char const * suite, char const * name, Function f) {
+            Benchmarks().push_back(Benchmark{suite, name, f});
+        }
+    }; // Benchmark::Registration
+
+    /** Returns true if the measured code should be executed again. 
+     
+        The first call starts the measurement. 
+     */
+    bool run() {
+        auto now = std::chrono::steady_clock::now();
+        if (iterations_ == 0) {
+            start_ = now;
+        } else if (iterations_ >= MIN_ITERATIONS && now - start_ >= MIN_DURATION) {
+            duration_ = now - start_;
+            return false;
+        }
+        ++iterations_;
+        return true;
+    }
+
+    /** Sets the number of bytes processed by single iteration so that the throughput can be reported. 
+     */
+    void setBytesPerIteration(size_t bytes) {
+        bytes_ = bytes;
+    }
+
+    /** Runs all benchmarks whose full name (suite.name) contains the filter. 
+     */
+    static int RunAll(int argc, char * argv[]) {
+        std::string filter = argc > 1 ? argv[1] : "";
+        for (Benchmark & b : Benchmarks()) {
+            std::string name = b.suite_ + "." + b.name_;
+            if (name.find(filter) == std::string::npos)
+                continue;
+            b.function_(b);
+            double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(b.duration_).count()) / static_cast<double>(b.iterations_);
+            std::cout << std::left << std::setw(50) << name << std::right << std::setw(10) << b.iterations_ << " iterations " << std::setw(14) << std::fixed << std::setprecision(0) << ns << " ns/iteration";
+            if (b.bytes_ != 0)
+                std::cout << std::setw(10) << std::setprecision(1) << (static_cast<double>(b.bytes_) * 1000.0 / ns) << " MB/s";
+            std::cout << std::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
+private:
+
+    Benchmark(char const * suite, char const * name, Function f):
+        suite_{suite},
+        name_{name},
+        function_{f} {
+    }
+
+    static std::vector<Benchmark> & Benchmarks() {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    std::string suite_;
+    std::string name_;
+    Function function_;
+    size_t iterations_ = 0;
+    size_t bytes_ = 0;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::duration duration_{0};
+
+}; // Benchmark
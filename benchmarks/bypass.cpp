@@ -0,0 +1,103 @@
+#include "helpers/helpers.h"
+
+#if (defined ARCH_LINUX)
+
+#include <fcntl.h>
+#include <pty.h>
+#include <termios.h>
+
+#include <thread>
+
+#include "tpp-bypass/relay.h"
+
+#include "benchmarks.h"
+
+namespace {
+
+    /** Size of the bypass buffers, the default of tpp-bypass. 
+     */
+    constexpr size_t BUFFER_SIZE = 10240;
+
+    /** Pseudoterminal pair in raw mode, the slave is written to as by the target command of the bypass and the master is relayed. 
+     */
+    class PTYPair {
+    public:
+        PTYPair() {
+            if (openpty(& master, & slave, nullptr, nullptr, nullptr) != 0)
+                THROW(IOError()) << "Unable to open pseudoterminal";
+            termios t;
+            tcgetattr(slave, & t);
+            cfmakeraw(& t);
+            tcsetattr(slave, TCSANOW, & t);
+        }
+
+        ~PTYPair() {
+            close(master);
+            close(slave);
+        }
+
+        int master;
+        int slave;
+    }; // PTYPair
+
+    /** Relays 1MB of output written to the pseudoterminal to /dev/null. 
+     */
+    void RelayOutput(Benchmark & benchmark, bool useSplice) {
+        PTYPair pty;
+        int null = open("/dev/null", O_WRONLY);
+        std::string output(1024 * 1024, 'x');
+        benchmark.setBytesPerIteration(output.size());
+        {
+            OutputRelay relay{pty.master, null, BUFFER_SIZE, useSplice};
+            while (benchmark.run()) {
+                std::thread writer{[&]() {
+                    WriteAll(pty.slave, output.data(), output.size());
+                }};
+                size_t relayed = 0;
+                while (relayed < output.size())
+                    relayed += relay.relay();
+                writer.join();
+            }
+        }
+        close(null);
+    }
+
+} // anonymous namespace
+
+/** Output relayed by reading into a buffer and writing it out. 
+ */
+BENCHMARK(bypass, relayCopy) {
+    RelayOutput(benchmark, false);
+}
+
+/** Output relayed with splice through a pipe. 
+ */
+BENCHMARK(bypass, relaySplice) {
+    RelayOutput(benchmark, true);
+}
+
+/** Decodes 1MB of input with escaped backticks and resize commands and writes it to /dev/null.
+ */
+BENCHMARK(bypass, decodeInput) {
+    int null = open("/dev/null", O_WRONLY);
+    std::string input;
+    for (size_t i = 0; input.size() < 1024 * 1024; ++i) {
+        input += "echo \"hello world\" | grep ``world`` && ls -la\r";
+        if (i % 16 == 0)
+            input += "`r120:40;";
+    }
+    unsigned resizes = 0;
+    InputDecoder decoder{null, [&resizes](unsigned cols, unsigned rows) { resizes += cols + rows; }};
+    benchmark.setBytesPerIteration(input.size());
+    std::string buffer;
+    while (benchmark.run()) {
+        buffer = input;
+        // commands split at the end of the buffer are decoded with the next buffer, as in the bypass
+        for (size_t i = 0; i < buffer.size(); )
+            i += decoder.decode(& buffer[i], std::min(BUFFER_SIZE, buffer.size() - i));
+    }
+    close(null);
+    DoNotOptimize(resizes);
+}
+
+#endif
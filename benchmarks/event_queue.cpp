@@ -0,0 +1,83 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ui/event_queue.h"
+
+#include "benchmarks.h"
+
+using namespace ui;
+
+namespace {
+
+    constexpr size_t EVENTS_PER_PRODUCER = 10000;
+
+    /** Schedules the events from given number of producer threads, each with its own widget, while the benchmark thread executes them as the UI thread would.
+     */
+    void ScheduleEvents(Benchmark & benchmark, size_t producers) {
+        EventQueue eq;
+        std::vector<Widget *> widgets;
+        for (size_t i = 0; i < producers; ++i)
+            widgets.push_back(new Widget{});
+        size_t total = producers * EVENTS_PER_PRODUCER;
+        while (benchmark.run()) {
+            size_t executed = 0;
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < producers; ++i) {
+                threads.emplace_back([&eq, & executed, widget = widgets[i]]() {
+                    for (size_t j = 0; j < EVENTS_PER_PRODUCER; ++j)
+                        eq.schedule([& executed, j]() { executed += j & 1; ++executed; }, widget);
+                });
+            }
+            for (size_t done = 0; done < total; ) {
+                size_t n = eq.processEvents();
+                if (n == 0)
+                    std::this_thread::yield();
+                done += n;
+            }
+            for (std::thread & t : threads)
+                t.join();
+        }
+        for (Widget * w : widgets) {
+            eq.cancelEvents(w);
+            delete w;
+        }
+    }
+
+} // anonymous namespace
+
+/** Events scheduled and executed by a single producer and the UI thread.
+ */
+BENCHMARK(event_queue, singleProducer) {
+    ScheduleEvents(benchmark, 1);
+}
+
+/** Events scheduled by many producer threads contending for the queue.
+ */
+BENCHMARK(event_queue, contention) {
+    ScheduleEvents(benchmark, 16);
+}
+
+/** Events of many widgets cancelled while still in the queue.
+ */
+BENCHMARK(event_queue, cancel) {
+    EventQueue eq;
+    std::vector<Widget *> widgets;
+    for (size_t i = 0; i < 100; ++i)
+        widgets.push_back(new Widget{});
+    size_t executed = 0;
+    while (benchmark.run()) {
+        for (size_t j = 0; j < 10; ++j)
+            for (Widget * w : widgets)
+                eq.schedule([& executed]() { ++executed; }, w);
+        // every other widget is detached before its events are processed
+        for (size_t i = 0; i < widgets.size(); i += 2)
+            eq.cancelEvents(widgets[i]);
+        while (eq.processEvents() > 0) {
+        }
+    }
+    for (Widget * w : widgets) {
+        eq.cancelEvents(w);
+        delete w;
+    }
+}
@@ -0,0 +1,57 @@
+#include "helpers/json.h"
+
+#include "benchmarks.h"
+
+namespace {
+
+    /** Creates a document of roughly 1MB resembling the settings file, i.e. nested objects with commented values, strings, numbers and arrays.
+     */
+    std::string const & Settings() {
+        static std::string document = [](){
+            std::stringstream s;
+            s << "/* Generated settings */\n{\n    \"sessions\" : [\n";
+            for (size_t i = 0; s.tellp() < 1024 * 1024; ++i) {
+                s << (i == 0 ? "" : ",\n");
+                s << "        {\n";
+                s << "            // Name of the session\n";
+                s << "            \"name\" : \"session " << i << "\",\n";
+                s << "            \"command\" : [ \"/bin/bash\", \"--login\", \"-c\", \"echo \\\"hello\\\" \\\\ world\\n\" ],\n";
+                s << "            \"workingDirectory\" : \"/home/user/projects/terminalpp/build/" << i << "\",\n";
+                s << "            \"cols\" : " << (80 + i % 40) << ",\n";
+                s << "            \"opacity\" : 0." << (i % 10) << "5,\n";
+                s << "            \"fullscreen\" : " << (i % 2 ? "true" : "false") << ",\n";
+                s << "            \"palette\" : { \"defaultForeground\" : \"#ffffff\", \"defaultBackground\" : \"#000000\", \"colors\" : [ \"#000000\", \"#800000\", \"#008000\", \"#808000\", \"#000080\", \"#800080\", \"#008080\", \"#c0c0c0\" ] },\n";
+                s << "            \"cursor\" : null\n";
+                s << "        }";
+            }
+            s << "\n    ]\n}\n";
+            return s.str();
+        }();
+        return document;
+    }
+
+} // anonymous namespace
+
+/** Parses the document from a string.
+ */
+BENCHMARK(json, parseString) {
+    std::string const & input = Settings();
+    benchmark.setBytesPerIteration(input.size());
+    size_t checksum = 0;
+    while (benchmark.run())
+        checksum += JSON::Parse(input)["sessions"].numElements();
+    DoNotOptimize(checksum);
+}
+
+/** Parses the document from an input stream, as the settings are read.
+ */
+BENCHMARK(json, parseStream) {
+    std::string const & input = Settings();
+    benchmark.setBytesPerIteration(input.size());
+    size_t checksum = 0;
+    while (benchmark.run()) {
+        std::stringstream s{input};
+        checksum += JSON::Parse(s)["sessions"].numElements();
+    }
+    DoNotOptimize(checksum);
+}
@@ -0,0 +1,228 @@
+#include "helpers/json_config.h"
+
+#include "benchmarks.h"
+
+namespace {
+
+    /** Configuration of roughly the shape and size of the terminal settings.
+     */
+    class SettingsConfig : public JSONConfig::Root {
+    public:
+        CONFIG_OBJECT(
+            version,
+            "Version information",
+            CONFIG_PROPERTY(
+                version,
+                "Version of the settings",
+                JSON{"0.8.4"},
+                std::string
+            );
+            CONFIG_PROPERTY(
+                checkChannel,
+                "Release channel to check for updates",
+                JSON{"stable"},
+                std::string
+            );
+        );
+        CONFIG_OBJECT(
+            renderer,
+            "Renderer settings",
+            CONFIG_PROPERTY(
+                fps,
+                "Maximum number of frames per second the renderer should produce",
+                JSON{60},
+                unsigned
+            );
+            CONFIG_PROPERTY(
+                fastForward,
+                "Skips rendering of output floods",
+                JSON{true},
+                bool
+            );
+            CONFIG_OBJECT(
+                font,
+                "Font used to render the terminal",
+                CONFIG_PROPERTY(
+                    family,
+                    "Font to render default size characters",
+                    []() { return JSON{"Monospace"}; },
+                    std::string
+                );
+                CONFIG_PROPERTY(
+                    boldFamily,
+                    "Font to render bold characters, if different from normal font",
+                    JSON{""},
+                    std::string
+                );
+                CONFIG_PROPERTY(
+                    size,
+                    "Size of the font in pixels at zoom level 1.0",
+                    JSON{18},
+                    unsigned
+                );
+                CONFIG_PROPERTY(
+                    charSpacing,
+                    "Spacing between characters.",
+                    JSON{1.0},
+                    double
+                );
+            );
+            CONFIG_OBJECT(
+                window,
+                "Properties of the terminal window",
+                CONFIG_PROPERTY(
+                    cols,
+                    "Number of columns the non-maximized window should have.",
+                    JSON{80},
+                    unsigned
+                );
+                CONFIG_PROPERTY(
+                    rows,
+                    "Number of rows the non-maximized window should have.",
+                    JSON{25},
+                    unsigned
+                );
+                CONFIG_PROPERTY(
+                    fullscreen,
+                    "Determines whether the window starts fullscreen.",
+                    JSON{false},
+                    bool
+                );
+                CONFIG_PROPERTY(
+                    historyLimit,
+                    "Determines the maximum number of lines the terminal will remember in the history of the buffer.",
+                    JSON{10000},
+                    int
+                );
+            );
+        );
+        CONFIG_OBJECT(
+            sequences,
+            "Behavior customization for terminal escape sequences (VT100)",
+            CONFIG_PROPERTY(
+                boldIsBright,
+                "If true, bold text is rendered in bright colors.",
+                JSON{true},
+                bool
+            );
+            CONFIG_PROPERTY(
+                displayBold,
+                "If true bold font will be used when appropriate.",
+                JSON{true},
+                bool
+            );
+            CONFIG_PROPERTY(
+                detectHyperlinks,
+                "If true, hyperlinks contained within the terminal will be detected and displayed as hyperlinks.",
+                JSON{true},
+                bool
+            );
+        );
+        CONFIG_PROPERTY(
+            defaultSession,
+            "Name of the default session which will be opened when terminal starts",
+            JSON{"default"},
+            std::string
+        );
+        CONFIG_ARRAY(
+            sessions,
+            "List of known sessions",
+            JSON::Array(),
+            CONFIG_PROPERTY(
+                name,
+                "Name of the session",
+                JSON{""},
+                std::string
+            );
+            CONFIG_PROPERTY(
+                hidden,
+                "Can hide the session from menus",
+                JSON{false},
+                bool
+            );
+            CONFIG_PROPERTY(
+                pty,
+                "Determines whether local, or bypass PTY should be used.",
+                JSON{"local"},
+                std::string
+            );
+            CONFIG_PROPERTY(
+                workingDirectory,
+                "Where the terminal session should be launched, empty to use current working directory",
+                JSON{""},
+                std::string
+            );
+            CONFIG_OBJECT(
+                cursor,
+                "Cursor properties",
+                CONFIG_PROPERTY(
+                    codepoint,
+                    "UTF codepoint of the cursor",
+                    JSON{0x2581},
+                    unsigned
+                );
+                CONFIG_PROPERTY(
+                    color,
+                    "Color of the cursor",
+                    JSON{"#ffffff"},
+                    std::string
+                );
+                CONFIG_PROPERTY(
+                    blink,
+                    "Determines whether the cursor blinks or not.",
+                    JSON{true},
+                    bool
+                );
+            );
+        );
+
+        /** Updates the configuration with given settings and fills in the missing values, as the terminal does when reading its settings.
+         */
+        void load(JSON const & settings) {
+            update(settings);
+            fillMissingValues();
+        }
+    }; // SettingsConfig
+
+    /** Settings as stored by the terminal, i.e. only some values specified, with a few sessions.
+     */
+    JSON const & Settings() {
+        static JSON settings = JSON::Parse(
+            "{ \"version\" : { \"version\" : \"0.8.4\" },"
+            "  \"renderer\" : { \"font\" : { \"family\" : \"Iosevka Term\", \"size\" : 16 }, \"window\" : { \"cols\" : 120, \"rows\" : 40 } },"
+            "  \"defaultSession\" : \"bash\","
+            "  \"sessions\" : ["
+            "    { \"name\" : \"bash\", \"workingDirectory\" : \"~\" },"
+            "    { \"name\" : \"zsh\", \"cursor\" : { \"blink\" : false } },"
+            "    { \"name\" : \"fish\", \"pty\" : \"local\" },"
+            "    { \"name\" : \"ssh\", \"hidden\" : true }"
+            "  ]"
+            "}"
+        );
+        return settings;
+    }
+
+} // anonymous namespace
+
+/** Creates the configuration and loads the settings into it.
+ */
+BENCHMARK(jsonConfig, load) {
+    size_t checksum = 0;
+    while (benchmark.run()) {
+        SettingsConfig config;
+        config.load(Settings());
+        checksum += config.renderer.font.size() + config.sessions.size();
+    }
+    DoNotOptimize(checksum);
+}
+
+/** Serializes the loaded configuration, as when the settings file is updated.
+ */
+BENCHMARK(jsonConfig, toJSON) {
+    SettingsConfig config;
+    config.load(Settings());
+    size_t checksum = 0;
+    while (benchmark.run())
+        checksum += config.toJSON().numElements();
+    DoNotOptimize(checksum);
+}
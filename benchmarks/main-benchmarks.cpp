@@ -0,0 +1,12 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "benchmarks.h"
+
+/** Runs the micro benchmarks. 
+ 
+    The optional argument filters the benchmarks to run by their name. 
+ */
+int main(int argc, char * argv[]) {
+    return Benchmark::RunAll(argc, argv);
+}
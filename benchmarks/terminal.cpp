@@ -0,0 +1,216 @@
+#include <condition_variable>
+#include <mutex>
+
+#include "ui-terminal/ansi_terminal.h"
+
+#include "benchmarks.h"
+
+namespace {
+
+    /** PTY which never receives anything, the input is fed to the terminal directly by the benchmark. 
+     */
+    class NullPTY : public tpp::PTYMaster {
+    public:
+        void send(char const * buffer, size_t numBytes) override {
+            MARK_AS_UNUSED(buffer);
+            MARK_AS_UNUSED(numBytes);
+        }
+
+        size_t receive(char * buffer, size_t bufferSize) override {
+            MARK_AS_UNUSED(buffer);
+            MARK_AS_UNUSED(bufferSize);
+            std::unique_lock<std::mutex> g{m_};
+            cv_.wait(g, [this](){ return terminated_.load(); });
+            return 0;
+        }
+
+        void terminate() override {
+            {
+                std::lock_guard<std::mutex> g{m_};
+                terminated_ = true;
+            }
+            cv_.notify_all();
+        }
+
+        void resize(int cols, int rows) override {
+            MARK_AS_UNUSED(cols);
+            MARK_AS_UNUSED(rows);
+        }
+
+    private:
+        std::mutex m_;
+        std::condition_variable cv_;
+    }; // NullPTY
+
+    /** Terminal which is fed the input the same way the PTY reader does, in chunks of given size.
+     */
+    class Terminal : public ui::AnsiTerminal {
+    public:
+        Terminal(bool fastForward, int historyRows, bool detectHyperlinks = false):
+            ui::AnsiTerminal{new NullPTY{}, Palette::XTerm256()} {
+            resize(ui::Size{120, 40});
+            setMaxHistoryRows(historyRows);
+            setFastForward(fastForward);
+            setDetectHyperlinks(detectHyperlinks);
+        }
+
+        void feed(std::string const & input, size_t chunkSize) {
+            std::string buffer;
+            for (size_t i = 0; i < input.size(); i += chunkSize) {
+                buffer.append(input, i, chunkSize);
+                char * x = & buffer[0];
+                char * end = x + buffer.size();
+                while (x != end) {
+                    size_t processed = received(x, end);
+                    if (processed == 0)
+                        break;
+                    x += processed;
+                }
+                buffer.erase(0, x - & buffer[0]);
+            }
+        }
+    }; // Terminal
+
+    /** Output of `cat` on a plain text file, roughly 4MB. 
+     */
+    std::string const & PlainText() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            for (size_t i = 0; corpus.size() < 4 * 1024 * 1024; ++i)
+                corpus += "line " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog\tand keeps running.\r\n";
+        }
+        return corpus;
+    }
+
+    /** Colored output, such as a compiler, or build log, roughly 4MB. 
+     */
+    std::string const & ColoredText() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            for (size_t i = 0; corpus.size() < 4 * 1024 * 1024; ++i)
+                corpus += "\x1b[1m" + std::to_string(i) + ".cpp:42:\x1b[0m \x1b[31mwarning:\x1b[0m unused variable \x1b[1m'x'\x1b[0m [-Wunused-variable]\r\n";
+        }
+        return corpus;
+    }
+
+    /** Log output with an url on every other line, roughly 4MB. 
+     */
+    std::string const & UrlText() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            for (size_t i = 0; corpus.size() < 4 * 1024 * 1024; ++i) {
+                if (i % 2 == 0)
+                    corpus += "[12:34:56] GET https://terminalpp.com/docs/page" + std::to_string(i) + "?lang=en: 200 OK\r\n";
+                else
+                    corpus += "[12:34:56] request " + std::to_string(i) + " took 42ms, see the trace for details\r\n";
+            }
+        }
+        return corpus;
+    }
+
+    /** Output scrolling inside a scroll region which does not cover the whole screen, such as a pager, or an editor with a status line, roughly 4MB. 
+     */
+    std::string const & ScrollRegion() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            corpus = "\x1b[2;39r\x1b[39;1H";
+            for (size_t i = 0; corpus.size() < 4 * 1024 * 1024; ++i)
+                corpus += "line " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog\r\n";
+            corpus += "\x1b[r";
+        }
+        return corpus;
+    }
+
+    /** Bulk scrolling, i.e. full screen scroll ups (CSI S) and line insertions and deletions (CSI L and CSI M) of many lines at once, roughly 256KB. 
+     */
+    std::string const & BulkScroll() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            for (size_t i = 0; corpus.size() < 256 * 1024; ++i)
+                corpus += "\x1b[H" + std::to_string(i) + "\x1b[30S\x1b[5;1H\x1b[20L\x1b[10;1H\x1b[20M";
+        }
+        return corpus;
+    }
+
+    /** Output of an editor, or a pager, editing lines in place with character insertions and deletions (CSI @ and CSI P) and erasing characters, lines and the display (CSI X, CSI K and CSI J), roughly 4MB. 
+     */
+    std::string const & Editing() {
+        static std::string corpus;
+        if (corpus.empty()) {
+            for (size_t i = 0; corpus.size() < 4 * 1024 * 1024; ++i) {
+                std::string row = std::to_string(i % 40 + 1);
+                corpus += "\x1b[" + row + ";10H\x1b[4@edit\x1b[" + row + ";30H\x1b[6P\x1b[" + row + ";50H\x1b[20X\x1b[" + row + ";80H\x1b[K\x1b[1K";
+                if (i % 200 == 0)
+                    corpus += "\x1b[2J\x1b[H\x1b[J";
+            }
+        }
+        return corpus;
+    }
+
+    /** 100 triggers, most of which share prefixes with the words in the output without ever matching, one highlighting a phrase on every line of the plain text and the colored text and a few notifications which never match. 
+     */
+    std::vector<ui::AnsiTerminal::Trigger> const & Triggers() {
+        static std::vector<ui::AnsiTerminal::Trigger> triggers;
+        if (triggers.empty()) {
+            for (char const * pattern : { "password:", "panic:", "FAILED", "Segmentation fault" }) {
+                triggers.emplace_back();
+                triggers.back().pattern = pattern;
+                triggers.back().notify = true;
+            }
+            for (char const * pattern : { "lazy dog", "warning:" }) {
+                triggers.emplace_back();
+                triggers.back().pattern = pattern;
+                triggers.back().style = ui::Hyperlink::Style{ui::Color::Red, ui::Color::None, ui::Font{}.setBold()};
+            }
+            for (size_t i = 0; triggers.size() < 100; ++i) {
+                triggers.emplace_back();
+                triggers.back().pattern = "The quick brown fox " + std::to_string(i);
+                triggers.back().notify = true;
+            }
+        }
+        return triggers;
+    }
+
+    void Cat(Benchmark & benchmark, std::string const & input, size_t chunkSize, bool fastForward, int historyRows = 10000, bool detectHyperlinks = false, std::vector<ui::AnsiTerminal::Trigger> const & triggers = {}) {
+        benchmark.setBytesPerIteration(input.size());
+        Terminal t{fastForward, historyRows, detectHyperlinks};
+        t.setTriggers(triggers);
+        while (benchmark.run())
+            t.feed(input, chunkSize);
+    }
+
+    /** Resizes a terminal with full history, alternating between two widths as when the window is being dragged. 
+     */
+    void Resize(Benchmark & benchmark, std::string const & input, int historyRows) {
+        Terminal t{true, historyRows};
+        t.feed(input, 65536);
+        int cols = 120;
+        while (benchmark.run()) {
+            cols = (cols == 120) ? 97 : 120;
+            t.resize(ui::Size{cols, 40});
+        }
+    }
+
+} // anonymous namespace
+
+BENCHMARK(terminal, catPlain4k) { Cat(benchmark, PlainText(), 4096, false); }
+BENCHMARK(terminal, catPlain4kFastForward) { Cat(benchmark, PlainText(), 4096, true); }
+BENCHMARK(terminal, catPlain64k) { Cat(benchmark, PlainText(), 65536, false); }
+BENCHMARK(terminal, catPlain64kFastForward) { Cat(benchmark, PlainText(), 65536, true); }
+BENCHMARK(terminal, catColored64k) { Cat(benchmark, ColoredText(), 65536, false); }
+BENCHMARK(terminal, catColored64kFastForward) { Cat(benchmark, ColoredText(), 65536, true); }
+BENCHMARK(terminal, catPlainNoHistory) { Cat(benchmark, PlainText(), 65536, false, 0); }
+BENCHMARK(terminal, catPlainNoHistoryFastForward) { Cat(benchmark, PlainText(), 65536, true, 0); }
+BENCHMARK(terminal, catColoredNoHistory) { Cat(benchmark, ColoredText(), 65536, false, 0); }
+BENCHMARK(terminal, catColoredNoHistoryFastForward) { Cat(benchmark, ColoredText(), 65536, true, 0); }
+BENCHMARK(terminal, catPlainDetectHyperlinks) { Cat(benchmark, PlainText(), 65536, false, 10000, true); }
+BENCHMARK(terminal, catUrls) { Cat(benchmark, UrlText(), 65536, false); }
+BENCHMARK(terminal, catUrlsDetectHyperlinks) { Cat(benchmark, UrlText(), 65536, false, 10000, true); }
+BENCHMARK(terminal, catPlainTriggers) { Cat(benchmark, PlainText(), 65536, false, 10000, false, Triggers()); }
+BENCHMARK(terminal, catColoredTriggers) { Cat(benchmark, ColoredText(), 65536, false, 10000, false, Triggers()); }
+BENCHMARK(terminal, scrollRegion) { Cat(benchmark, ScrollRegion(), 65536, false); }
+BENCHMARK(terminal, bulkScroll) { Cat(benchmark, BulkScroll(), 65536, false); }
+BENCHMARK(terminal, bulkScrollNoHistory) { Cat(benchmark, BulkScroll(), 65536, false, 0); }
+BENCHMARK(terminal, editing) { Cat(benchmark, Editing(), 65536, false); }
+BENCHMARK(terminal, resize) { Resize(benchmark, PlainText(), 10000); }
+BENCHMARK(terminal, resizeLongHistory) { Resize(benchmark, PlainText(), 100000); }
@@ -0,0 +1,86 @@
+#include "helpers/char.h"
+
+#include "benchmarks.h"
+
+namespace {
+
+    /** Creates a corpus of roughly 1MB by repeating the given text. 
+     */
+    std::string Corpus(std::string const & text) {
+        std::string result;
+        while (result.size() < 1024 * 1024)
+            result += text;
+        return result;
+    }
+
+    std::string const & Ascii() {
+        static std::string corpus = Corpus("The quick brown fox jumps over the lazy dog, 0123456789 times.\r\n");
+        return corpus;
+    }
+
+    std::string const & Cyrillic() {
+        static std::string corpus = Corpus("\xd0\xa1\xd1\x8a\xd0\xb5\xd1\x88\xd1\x8c \xd0\xb6\xd0\xb5 \xd0\xb5\xd1\x89\xd1\x91 \xd1\x8d\xd1\x82\xd0\xb8\xd1\x85 \xd0\xbc\xd1\x8f\xd0\xb3\xd0\xba\xd0\xb8\xd1\x85 \xd1\x84\xd1\x80\xd0\xb0\xd0\xbd\xd1\x86\xd1\x83\xd0\xb7\xd1\x81\xd0\xba\xd0\xb8\xd1\x85 \xd0\xb1\xd1\x83\xd0\xbb\xd0\xbe\xd0\xba, \xd0\xb4\xd0\xb0 \xd0\xb2\xd1\x8b\xd0\xbf\xd0\xb5\xd0\xb9 \xd1\x87\xd0\xb0\xd1\x8e.\r\n");
+        return corpus;
+    }
+
+    std::string const & CJK() {
+        static std::string corpus = Corpus("\xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe6\xa3\x95\xe8\x89\xb2\xe7\x8b\x90\xe7\x8b\xb8\xe8\xb7\xb3\xe8\xbf\x87\xe4\xba\x86\xe9\x82\xa3\xe5\x8f\xaa\xe6\x87\x92\xe7\x8b\x97\xe3\x80\x82\xe3\x81\x84\xe3\x82\x8d\xe3\x81\xaf\xe3\x81\xab\xe3\x81\xbb\xe3\x81\xb8\xe3\x81\xa8 \xed\x82\xa4\xec\x8a\xa4\xec\x9d\x98 \xea\xb3\xa0\xec\x9c\xa0\xec\xa1\xb0\xea\xb1\xb4\xec\x9d\x80\r\n");
+        return corpus;
+    }
+
+    std::string const & Emoji() {
+        static std::string corpus = Corpus("build \xe2\x9c\x85 tests \xf0\x9f\x9f\xa2 deploy \xf0\x9f\x9a\x80\xf0\x9f\x8e\x89 warnings \xe2\x9a\xa0\xef\xb8\x8f errors \xe2\x9d\x8c \xf0\x9f\x98\x80\xf0\x9f\x98\x81\xf0\x9f\x98\x82\r\n");
+        return corpus;
+    }
+
+    std::string const & Mixed() {
+        static std::string corpus = Corpus(
+            "ls -la \xe6\x96\x87\xe4\xbb\xb6\xe5\xa4\xb9/ \xd0\xb4\xd0\xbe\xd0\xba\xd1\x83\xd0\xbc\xd0\xb5\xd0\xbd\xd1\x82\xd1\x8b/ \xf0\x9f\x93\x81 total 42\r\n"
+            "-rw-r--r-- 1 user user  4096 Oct 18 12:00 \xe6\x8a\xa5\xe5\x91\x8a.txt\r\n"
+            "-rw-r--r-- 1 user user  1024 Oct 18 12:00 readme.md\r\n"
+        );
+        return corpus;
+    }
+
+    /** Decodes the input the way the terminal did before, using the unvalidated Char iterator. 
+     */
+    void DecodeIterator(Benchmark & benchmark, std::string const & input) {
+        benchmark.setBytesPerIteration(input.size());
+        char32_t checksum = 0;
+        while (benchmark.run()) {
+            for (auto i = Char::BeginOf(input), e = Char::EndOf(input); i != e; ++i)
+                checksum += i->codepoint();
+        }
+        DoNotOptimize(checksum);
+    }
+
+    /** Decodes the input using the validating decoder in chunks, as the terminal does. 
+     */
+    void DecodeKernel(Benchmark & benchmark, std::string const & input) {
+        benchmark.setBytesPerIteration(input.size());
+        char32_t buffer[256];
+        char32_t checksum = 0;
+        while (benchmark.run()) {
+            char const * x = input.c_str();
+            char const * e = x + input.size();
+            while (x != e) {
+                size_t n = Char::DecodeUTF8(x, e, buffer, 256);
+                for (size_t i = 0; i < n; ++i)
+                    checksum += buffer[i];
+            }
+        }
+        DoNotOptimize(checksum);
+    }
+
+} // anonymous namespace
+
+BENCHMARK(utf8, iteratorAscii) { DecodeIterator(benchmark, Ascii()); }
+BENCHMARK(utf8, decodeAscii) { DecodeKernel(benchmark, Ascii()); }
+BENCHMARK(utf8, iteratorCyrillic) { DecodeIterator(benchmark, Cyrillic()); }
+BENCHMARK(utf8, decodeCyrillic) { DecodeKernel(benchmark, Cyrillic()); }
+BENCHMARK(utf8, iteratorCJK) { DecodeIterator(benchmark, CJK()); }
+BENCHMARK(utf8, decodeCJK) { DecodeKernel(benchmark, CJK()); }
+BENCHMARK(utf8, iteratorEmoji) { DecodeIterator(benchmark, Emoji()); }
+BENCHMARK(utf8, decodeEmoji) { DecodeKernel(benchmark, Emoji()); }
+BENCHMARK(utf8, iteratorMixed) { DecodeIterator(benchmark, Mixed()); }
+BENCHMARK(utf8, decodeMixed) { DecodeKernel(benchmark, Mixed()); }
@@ -21,5 +21,20 @@ HELPERS_NAMESPACE_BEGIN
         return (value & ~ mask) | bits;
     } 
 
+    /** Returns the number of trailing zero bits in the given value, which must not be zero. 
+     */
+    inline unsigned CountTrailingZeros(uint32_t value) {
+#if (defined __GNUC__ || defined __clang__)
+        return static_cast<unsigned>(__builtin_ctz(value));
+#else
+        unsigned result = 0;
+        while ((value & 1) == 0) {
+            value >>= 1;
+            ++result;
+        }
+        return result;
+#endif
+    }
+
 
 HELPERS_NAMESPACE_END
\ No newline at end of file
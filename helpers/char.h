@@ -2,7 +2,13 @@
 
 #include <ostream>
 
+#if (defined __SSE2__ || defined _M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "helpers.h"
+#include "bits.h"
+#include "unicode_tables.inc.h"
 
 #ifdef ARCH_WINDOWS
 static_assert(sizeof(wchar_t) == sizeof(char16_t), "wchar_t and char16_t must have the same size or the conversions would break");
@@ -111,6 +117,12 @@ HELPERS_NAMESPACE_BEGIN
                 return pointer_cast<Char const *>(i_);
             }
 
+			/** Returns the pointer to the first byte of the character the iterator points to. 
+			 */
+			char const * charPtr() const {
+				return pointer_cast<char const *>(i_);
+			}
+
 			size_t charSize() const {
 				unsigned char x = static_cast<unsigned char>(*i_);
 				if (x < 0x80) 
@@ -290,17 +302,17 @@ HELPERS_NAMESPACE_BEGIN
 				++i;
 			    return Char{*u};
 			} else if (*u < 0xe0) {
-				if (i + 2 >= end)
+				if (i + 2 > end)
     				THROW(CharError()) << "Cannot read character, buffer overflow";
 				i += 2;
 			    return Char{u[0], u[1]};
 			} else if (*u < 0xf0) {
-				if (i + 3 >= end)
+				if (i + 3 > end)
     				THROW(CharError()) << "Cannot read character, buffer overflow";
 				i += 3;
 			    return Char{u[0], u[1], u[2]};
 			} else {
-				if (i + 4 >= end)
+				if (i + 4 > end)
     				THROW(CharError()) << "Cannot read character, buffer overflow";
 				i += 4;
 			    return Char{u[0], u[1], u[2], u[3]};
@@ -340,26 +352,155 @@ HELPERS_NAMESPACE_BEGIN
 		/** Returns number of columns in monospace font (such as a terminal) the given character should occupy. 
 
 		    On linux, the funtion wcwidth should do, however this does not exist on Windows and to make sure that applications behave the same on all platforms, own decission is implemented. 
+
+			Combining marks and format characters have width of 0, East Asian Wide and Fullwidth characters (including emoji with default emoji presentation) have width of 2. The widths are looked up in a two level table generated from the Unicode Character Database by the `unicode` build target. 
 		 */
         static int ColumnWidth(char32_t cp) {
-			if (cp >= 0x1100) {
-				if (cp <= 0x115f || // Hangul
-				    cp == 0x2329 ||
-					cp == 0x2321 ||
-					(cp >= 0x2e80 && cp <= 0xa4cf && cp != 0x303f) || // CJK
-					(cp >= 0xac00 && cp <= 0xd7a3) || // Hangul Syllables
-					(cp >= 0xf900 && cp <= 0xfaff) || // CJK
-					(cp >= 0xfe10 && cp <= 0xfe19) || // Vertical forms
-					(cp >= 0xfe30 && cp <= 0xfe6f) || // CJK
-					(cp >= 0xff00 && cp <= 0xff60) || // Fullwidth forms
-					(cp >= 0xffe0 && cp <= 0xffe6) ||
-					(cp >= 0x20000 && cp <= 0x2fffd) ||
-					(cp >= 0x30000 && cp <= 0x3fffd))
-					return 2;
+			// nothing below the combining diacritical marks block is zero or double width
+			if (cp < 0x300 || cp >= 0x110000)
+				return 1;
+			uint8_t block = UnicodeTables::WidthIndex[cp >> 8];
+			return (UnicodeTables::WidthBlocks[block][(cp & 0xff) >> 2] >> ((cp & 3) * 2)) & 3;
+		}
+
+		/** Returns the canonical composition of the given base character and combining mark, or 0 if the pair does not compose. 
+		 */
+		static char32_t Compose(char32_t base, char32_t mark) {
+			uint64_t key = (static_cast<uint64_t>(base) << 21) | mark;
+			size_t first = 0;
+			size_t last = sizeof(UnicodeTables::Compositions) / sizeof(uint64_t);
+			while (first < last) {
+				size_t mid = (first + last) / 2;
+				uint64_t x = UnicodeTables::Compositions[mid] >> 21;
+				if (x == key)
+					return static_cast<char32_t>(UnicodeTables::Compositions[mid] & 0x1fffff);
+				else if (x < key)
+					first = mid + 1;
+				else
+					last = mid;
 			}
-			return 1;
+			return 0;
 		}
 
+		/** \name UTF-8 Decoding
+		 */
+		//@{
+
+		/** Codepoint used in place of invalid UTF-8 sequences. 
+		 */
+		static constexpr char32_t REPLACEMENT_CHARACTER = 0xfffd;
+
+		/** Validates and decodes UTF-8 encoded bytes into codepoints. 
+
+		    Decodes the bytes from begin up to end, or until output is full, and returns the number of codepoints written. The begin pointer is advanced past the decoded bytes. Invalid sequences (unexpected continuation bytes, overlong encodings, surrogates and values above U+10FFFF) are replaced with REPLACEMENT_CHARACTER, one for each maximal invalid subpart as recommended by the Unicode standard. 
+
+			If stopAtControl is true, decoding stops at the first C0 control character, which is left unprocessed. If final is false, a sequence truncated by the end of the input is left unprocessed so that it can be decoded when more data arrives, otherwise it is replaced as well. 
+
+			ASCII runs, which are the most common input by far, are validated and widened 16 bytes at a time where SSE2 is available. Other text is decoded by DecodeMultibyteUTF8(), leaving only the invalid and truncated sequences to the general, byte by byte, validation. 
+		 */
+		static size_t DecodeUTF8(char const * & begin, char const * end, char32_t * output, size_t outputSize, bool stopAtControl = false, bool final = true) {
+			unsigned char const * x = pointer_cast<unsigned char const *>(begin);
+			unsigned char const * xe = pointer_cast<unsigned char const *>(end);
+			char32_t * out = output;
+			char32_t * outEnd = output + outputSize;
+			while (x != xe && out != outEnd) {
+				unsigned char c = *x;
+				if (c < 0x80) {
+#if (defined __SSE2__ || defined _M_X64)
+					while (xe - x >= 16 && outEnd - out >= 16) {
+						__m128i v = _mm_loadu_si128(pointer_cast<__m128i const *>(x));
+						// bytes >= 0x80 are negative when compared as signed, so a single comparison detects both controls and non-ASCII
+						int mask = stopAtControl ? _mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(0x20))) : _mm_movemask_epi8(v);
+						if (mask != 0) {
+							for (unsigned i = 0, e = CountTrailingZeros(static_cast<uint32_t>(mask)); i < e; ++i)
+								*out++ = *x++;
+							break;
+						}
+						__m128i zero = _mm_setzero_si128();
+						__m128i lo = _mm_unpacklo_epi8(v, zero);
+						__m128i hi = _mm_unpackhi_epi8(v, zero);
+						_mm_storeu_si128(pointer_cast<__m128i *>(out), _mm_unpacklo_epi16(lo, zero));
+						_mm_storeu_si128(pointer_cast<__m128i *>(out + 4), _mm_unpackhi_epi16(lo, zero));
+						_mm_storeu_si128(pointer_cast<__m128i *>(out + 8), _mm_unpacklo_epi16(hi, zero));
+						_mm_storeu_si128(pointer_cast<__m128i *>(out + 12), _mm_unpackhi_epi16(hi, zero));
+						x += 16;
+						out += 16;
+					}
+					if (x == xe || out == outEnd)
+						break;
+					c = *x;
+					if (c >= 0x80)
+						continue;
+#endif
+					if (stopAtControl && c < 0x20)
+						break;
+					*out++ = c;
+					++x;
+					continue;
+				}
+				// non-ASCII text is decoded by a loop of its own for as long as it is valid, each iteration of which consumes at most 4 bytes
+				while (true) {
+					size_t count = std::min(static_cast<size_t>(outEnd - out), static_cast<size_t>(xe - x) / 4);
+					if (count == 0 || DecodeMultibyteUTF8(x, out, count, stopAtControl))
+						break;
+				}
+				if (x == xe || out == outEnd)
+					break;
+				c = *x;
+				if (c < 0x80)
+					continue;
+				size_t available = static_cast<size_t>(xe - x);
+				// the general case, which validates the first continuation byte's range and determines the maximal invalid subpart
+				unsigned length;
+				char32_t cp;
+				unsigned char lo = 0x80;
+				unsigned char hi = 0xbf;
+				if (c >= 0xc2 && c <= 0xdf) {
+					length = 2;
+					cp = c & 0x1f;
+				} else if (c >= 0xe0 && c <= 0xef) {
+					length = 3;
+					cp = c & 0x0f;
+					if (c == 0xe0) // overlong
+						lo = 0xa0;
+					else if (c == 0xed) // surrogates
+						hi = 0x9f;
+				} else if (c >= 0xf0 && c <= 0xf4) {
+					length = 4;
+					cp = c & 0x07;
+					if (c == 0xf0) // overlong
+						lo = 0x90;
+					else if (c == 0xf4) // above U+10FFFF
+						hi = 0x8f;
+				} else {
+					*out++ = REPLACEMENT_CHARACTER;
+					++x;
+					continue;
+				}
+				unsigned i = 1;
+				for (; i < length && i < available; ++i) {
+					if (x[i] < lo || x[i] > hi)
+						break;
+					cp = (cp << 6) + (x[i] & 0x3f);
+					lo = 0x80;
+					hi = 0xbf;
+				}
+				if (i == length) {
+					*out++ = cp;
+					x += length;
+				} else if (i == available && ! final) {
+					break;
+				} else {
+					*out++ = REPLACEMENT_CHARACTER;
+					x += i;
+				}
+			}
+			begin = pointer_cast<char const *>(x);
+			return static_cast<size_t>(out - output);
+		}
+
+		//@}
+
         static int ColumnWidth(Char const & c) {
             return ColumnWidth(c.codepoint());
         }
@@ -477,6 +618,50 @@ HELPERS_NAMESPACE_BEGIN
 			bytes_[3] = fourth;
 		}
 
+		/** Decodes up to count valid non-ASCII sequences and single ASCII characters between them, such as spaces between words, and returns true if it stopped early at an invalid sequence, a control character if stopAtControl is true, or an ASCII run, all of which are left to DecodeUTF8. 
+
+		    The continuation bytes are xored with their tag so that each sequence is validated by a single combined check of their payloads and the codepoint range. At least 4 * count bytes must be available. 
+		 */
+		static bool DecodeMultibyteUTF8(unsigned char const * & begin, char32_t * & output, size_t count, bool stopAtControl) {
+			unsigned char const * x = begin;
+			char32_t * out = output;
+			for (; count > 0; --count) {
+				char32_t c = x[0];
+				char32_t cp;
+				if (c < 0x80) {
+					if ((stopAtControl && c < 0x20) || (x[1] | x[2] | x[3]) < 0x80)
+						break;
+					*out++ = c;
+					++x;
+					continue;
+				}
+				char32_t c1 = x[1] ^ 0x80u;
+				if (c < 0xe0) {
+					cp = ((c & 0x1f) << 6) | c1;
+					if ((c1 > 0x3f) | (c < 0xc2))
+						break;
+					x += 2;
+				} else if (c < 0xf0) {
+					char32_t c2 = x[2] ^ 0x80u;
+					cp = ((c & 0x0f) << 12) | (c1 << 6) | c2;
+					if (((c1 | c2) > 0x3f) | (cp < 0x800) | (cp - 0xd800 < 0x800))
+						break;
+					x += 3;
+				} else {
+					char32_t c2 = x[2] ^ 0x80u;
+					char32_t c3 = x[3] ^ 0x80u;
+					cp = ((c & 0x07) << 18) | (c1 << 12) | (c2 << 6) | c3;
+					if (((c1 | c2 | c3) > 0x3f) | (cp - 0x10000 > 0xfffff) | (c > 0xf7))
+						break;
+					x += 4;
+				}
+				*out++ = cp;
+			}
+			begin = x;
+			output = out;
+			return count > 0;
+		}
+
 		friend std::ostream& operator << (std::ostream& s, Char const & c) {
 			s.write(reinterpret_cast<char const *>(&c.bytes_), c.size());
 			return s;
@@ -1,105 +1,132 @@
 #pragma once
 
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 #include "helpers.h"
 
 HELPERS_NAMESPACE_BEGIN
 
+    /** Matches the longest known prefix of the input.
+
+        The matcher is a trie stored in two flat arrays. Nodes are identified by their index and the outgoing edges of each node are stored contiguously in the edges array sorted by their input so that a transition is a binary search over a few adjacent elements and matching never allocates, or chases pointers to heap allocated nodes. Adding a match keeps the layout by inserting the new edges in place, which is slower, but only happens when the matcher is being initialized.
+     */
     template<typename T, typename IT>
     class MatchingFSM {
     public:
 
-        bool empty() {
-            return start_.final_ == false && start_.next_.empty();
+        MatchingFSM():
+            nodes_{1} {
+        }
+
+        bool empty() const {
+            return nodes_[0].final == false && edges_.empty();
         }
 
         void addMatch(IT const * begin, IT const * end, T const & result, bool overwrite = false) {
-            start_.addMatch(begin, end, result, overwrite);
+            uint32_t node = 0;
+            for (; begin != end; ++begin)
+                node = addTransition(node, *begin);
+            setResult(node, result, overwrite);
         }
 
         void addMatch(IT const * begin, T const & result, bool overwrite = false) {
-            start_.addMatch(begin, result, overwrite);
+            uint32_t node = 0;
+            for (; *begin != 0; ++begin)
+                node = addTransition(node, *begin);
+            setResult(node, result, overwrite);
         }
 
+        /** Matches the longest prefix of the input.
+
+            If there is a match, returns true, sets the result and advances begin past the matched input.
+         */
         bool match(IT const * & begin, IT const * end, T & result) const {
-            return start_.match(begin, end, result, begin, false);
+            bool matched = false;
+            uint32_t node = 0;
+            for (IT const * i = begin; ; ++i) {
+                if (nodes_[node].final) {
+                    result = nodes_[node].result;
+                    begin = i;
+                    matched = true;
+                }
+                if (i == end)
+                    break;
+                node = transition(node, *i);
+                if (node == NONE)
+                    break;
+            }
+            return matched;
         }
 
     private:
-        class Node {
-            friend class MatchingFSM;
-        public:
 
-            Node() = default;
+        static constexpr uint32_t NONE = 0;
 
-            Node(Node const & other):
-                final_{other.final},
-                result_{other.result_} {
-                for (auto i : other.next_)
-                    next_.insert(std::make_pair(i.first, new Node(*i->second)));
-            }
-
-            Node(Node && other) noexcept:
-                next_{std::move(other.next_)},
-                final_{other.final_},
-                result_{std::move(other.result_)} {
-            }
-
-            ~Node() {
-                for (auto i : next_)
-                    delete i.second;
-            }
-
-            void addMatch(IT const * begin, IT const * end, T const & result, bool overwrite) {
-                if (begin == end) {
-                    ASSERT(! final_ || overwrite) << "Ambiguous match";
-                    final_ = true;
-                    result_ = result;
-                } else {
-                    auto i = next_.find(*begin);
-                    if (i == next_.end())
-                        i = next_.insert(std::make_pair(*begin, new Node{})).first;
-                    i->second->addMatch(begin + 1, end, result, overwrite);
-                }
-            }
+        class Node {
+        public:
+            /** Index of the first outgoing edge in the edges array. */
+            uint32_t firstEdge = 0;
+            uint32_t numEdges = 0;
+            bool final = false;
+            T result{};
+        }; // MatchingFSM::Node
 
-            void addMatch(IT const * begin, T const & result, bool overwrite) {
-                if (*begin == 0) {
-                    ASSERT(! final_ || overwrite) << "Ambiguous match";
-                    final_ = true;
-                    result_ = result;
-                } else {
-                    auto i = next_.find(*begin);
-                    if (i == next_.end())
-                        i = next_.insert(std::make_pair(*begin, new Node{})).first;
-                    i->second->addMatch(begin + 1, result, overwrite);
-                }
-            }
+        class Edge {
+        public:
+            IT input;
+            uint32_t target;
+        }; // MatchingFSM::Edge
+
+        /** Returns the node reached from given node by given input, or NONE if there is no such transition.
+
+            The root node cannot be a target of any transition so its index doubles as a sentinel.
+         */
+        uint32_t transition(uint32_t node, IT input) const {
+            Node const & n = nodes_[node];
+            auto begin = edges_.begin() + n.firstEdge;
+            auto end = begin + n.numEdges;
+            auto i = std::lower_bound(begin, end, input, [](Edge const & e, IT x) { return e.input < x; });
+            return (i != end && i->input == input) ? i->target : NONE;
+        }
 
-            bool match(IT const * begin, IT const * end, T & match, IT const * & matchEnd, bool result) const {
-                if (final_) {
-                    match = result_;
-                    matchEnd = begin;
-                    result = true;
-                }
-                auto i = next_.find(*begin);
-                if (i == next_.end())
-                    return result;
-                else
-                    return i->second->match(begin + 1, end, match, matchEnd, result);
+        uint32_t addTransition(uint32_t node, IT input) {
+            Node & n = nodes_[node];
+            auto begin = edges_.begin() + n.firstEdge;
+            auto end = begin + n.numEdges;
+            auto i = std::lower_bound(begin, end, input, [](Edge const & e, IT x) { return e.input < x; });
+            if (i != end && i->input == input)
+                return i->target;
+            uint32_t target = static_cast<uint32_t>(nodes_.size());
+            uint32_t position = static_cast<uint32_t>(i - edges_.begin());
+            // nodes without edges are placed at the end so that their edges can be appended
+            if (n.numEdges == 0) {
+                n.firstEdge = static_cast<uint32_t>(edges_.size());
+                position = n.firstEdge;
+            } else {
+                // shift the edges of all nodes stored after the insertion point
+                for (Node & other : nodes_)
+                    if (other.numEdges > 0 && other.firstEdge >= position && & other != & n)
+                        ++other.firstEdge;
             }
+            edges_.insert(edges_.begin() + position, Edge{input, target});
+            ++nodes_[node].numEdges;
+            nodes_.push_back(Node{});
+            return target;
+        }
 
-        private:
-
-            std::unordered_map<IT, Node*> next_;
-            bool final_ = false;
-            T result_;
-
-        }; // MatchingFSM::Node
+        void setResult(uint32_t node, T const & result, bool overwrite) {
+            Node & n = nodes_[node];
+            ASSERT(! n.final || overwrite) << "Ambiguous match";
+            MARK_AS_UNUSED(overwrite);
+            n.final = true;
+            n.result = result;
+        }
 
-        Node start_;
+        std::vector<Node> nodes_;
+        std::vector<Edge> edges_;
 
     }; // MatchingFSM
 
-HELPERS_NAMESPACE_END
\ No newline at end of file
+HELPERS_NAMESPACE_END
@@ -2,10 +2,16 @@
 
 #include <string>
 #include <iomanip>
+#include <sstream>
 #include <vector>
 #include <unordered_map>
 
+#if (defined __SSE2__ || defined _M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "helpers.h"
+#include "bits.h"
 #include "string.h"
 
 HELPERS_NAMESPACE_BEGIN
@@ -255,12 +261,19 @@ HELPERS_NAMESPACE_BEGIN
             OBJECT := '{' [ [ COMMENT ] STR ':' ELEMENT { ',' [COMMENT] STR ':' ELEMENT } ] }
          */
         static JSON Parse(std::string const & from) {
-            std::stringstream ss(from);
-            return Parse(ss);
+            return Parse(from.c_str(), from.c_str() + from.size());
         }
 
+        /** Parses the contents of the given stream. 
+
+            The whole stream is read into memory first and then parsed as a buffer. 
+         */
         static JSON Parse(std::istream & s);
 
+        /** Parses the given buffer. 
+         */
+        static JSON Parse(char const * begin, char const * end);
+
         /** Returns an empty JSON object with no properties. 
          */
         static JSON Object() {
@@ -1057,13 +1070,17 @@ HELPERS_NAMESPACE_BEGIN
 
     // parser
     
+    /** Parser over a contiguous buffer. 
+
+        The input is accessed directly, strings without escape sequences are copied into their values in a single step and the string bodies are scanned 16 bytes at a time where SSE2 is available. The line and column of the current position are only calculated when an error is reported. 
+     */
     class JSON::Parser {
     public:
 
-        explicit Parser(std::istream & s):
-            line_(1),
-            col_(1),
-            input_(s) {
+        Parser(char const * begin, char const * end):
+            begin_{begin},
+            x_{begin},
+            end_{end} {
         }
 
         /** JSON := [ COMMENT ] ELEMENT
@@ -1118,7 +1135,7 @@ HELPERS_NAMESPACE_BEGIN
         JSON parseNumber() {
             int sign = condPop('-') ? -1 : 1;
             if (! IsDecimalDigit(top()))
-                THROW(JSONError(line_, col_)) << "Expected number, bool, null, string, array, or object but " << top() << " found";
+                THROW(errorAt(x_)) << "Expected number, bool, null, string, array, or object but " << top() << " found";
             if (sign == 1 && condPop('0') && condPop('x'))
                 return parseHexadecimalInteger();
             int value = 0;
@@ -1142,7 +1159,7 @@ HELPERS_NAMESPACE_BEGIN
             // the 0x has already been parsed
             int value = 0;
             if (!IsHexadecimalDigit(top()))
-                THROW(JSONError(line_, col_)) << "Expected hexadecimal number but " << top() << " found";
+                THROW(errorAt(x_)) << "Expected hexadecimal number but " << top() << " found";
             do {
                 value = value * 16 + HexCharToNumber(pop());
             } while (IsHexadecimalDigit(top()));
@@ -1152,77 +1169,89 @@ HELPERS_NAMESPACE_BEGIN
         /** STR := double quoted string
          */
         std::string parseStr() {
-            unsigned l = line_;
-            unsigned c = col_;
-            std::stringstream result;
+            char const * start = x_;
             pop('\"');
+            std::string result;
             while (true) {
-                if (input_.eof())
-                    THROW(JSONError(l, c)) << "Unterminated string";
-                char t = top();
-                if ( t == '"') {
-                    pop();
+                char const * run = x_;
+                x_ = findQuoteOrBackslash(x_);
+                result.append(run, x_);
+                if (x_ == end_)
+                    THROW(errorAt(start)) << "Unterminated string";
+                if (pop() == '"')
                     break;
+                // escape sequence
+                switch (top()) {
+                    case '\\':
+                    case '\'':
+                    case '"':
+                        result += pop();
+                        continue;
+                    case '\n':
+                        pop();
+                        continue;
+                    case 'n':
+                        result += '\n';
+                        pop();
+                        continue;
+                    case '\t':
+                        result += '\t';
+                        pop();
+                        continue;
+                    default:
+                        THROW(errorAt(x_)) << "Invalid escape sequence " << top();
                 }
-                if (t == '\\') {
-                    pop();
-                    switch (top()) {
-                        case '\\':
-                        case '\'':
-                        case '"':
-                            result << pop();
-                            continue;
-                        case '\n':
-                            pop();
-                            continue;
-                        case 'n':
-                            result << '\n';
-                            pop();
-                            continue;
-                        case '\t':
-                            result << '\t';
-                            pop();
-                            continue;
-                        default:
-                            THROW(JSONError(line_, col_)) << "Invalid escape sequence " << top();
-                    }
-                } else {
-                    result << pop();
-                }
             }
-            return result.str();
+            return result;
+        }
+
+        /** Returns the first double quote or backslash character at or after the given position, or the end of the input. 
+         */
+        char const * findQuoteOrBackslash(char const * x) const {
+#if (defined __SSE2__ || defined _M_X64)
+            __m128i quote = _mm_set1_epi8('"');
+            __m128i backslash = _mm_set1_epi8('\\');
+            while (end_ - x >= 16) {
+                __m128i v = _mm_loadu_si128(pointer_cast<__m128i const *>(x));
+                int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)));
+                if (mask != 0)
+                    return x + CountTrailingZeros(static_cast<uint32_t>(mask));
+                x += 16;
+            }
+#endif
+            while (x != end_ && *x != '"' && *x != '\\')
+                ++x;
+            return x;
         }
 
         /** COMMENT := C/Javascript single or multi-line style comment
          */
         std::string parseComment() {
             pop('/');
-            std::stringstream result;
+            char const * start = x_ + 1;
             switch (top()) {
                 case '/': {
                     pop();
-                    while (! input_.eof() && ! condPop('\n'))
-                        result << pop();
-                    break;
+                    while (x_ != end_ && *x_ != '\n')
+                        ++x_;
+                    std::string result{start, x_};
+                    condPop('\n');
+                    return Trim(result);
                 }
                 case '*': {
                     pop();
-                    while (! input_.eof()) {
-                        if (top() == '*') {
-                            pop();
-                            if (condPop('/'))
-                                break;
-                            result << '*';
-                        } else {
-                            result << pop();
+                    char const * commentEnd = end_;
+                    while (x_ != end_) {
+                        if (pop() == '*' && condPop('/')) {
+                            commentEnd = x_ - 2;
+                            break;
                         }
                     }
-                    break;
+                    return Trim(std::string{start, commentEnd});
                 }
                 default:
-                    THROW(JSONError(line_, col_)) << "Invalid comment detected";
+                    THROW(errorAt(x_)) << "Invalid comment detected";
             }
-            return Trim(result.str());
         }
 
         /** ARRAY := '[' [ JSON { ',' JSON } ] ']'
@@ -1232,11 +1261,11 @@ HELPERS_NAMESPACE_BEGIN
             JSON result(Kind::Array);
             skipWhitespace();
             if (top() != ']') {
-                result.add(parseJSON());
+                result.valueArray_.push_back(new JSON{parseJSON()});
                 skipWhitespace();
                 while (condPop(',')) {
                     skipWhitespace();
-                    result.add(parseJSON());
+                    result.valueArray_.push_back(new JSON{parseJSON()});
                     skipWhitespace();
                 }
             }
@@ -1250,17 +1279,17 @@ HELPERS_NAMESPACE_BEGIN
                 comment = parseComment();
                 skipWhitespace();
             }
-            unsigned l = line_;
-            unsigned c = col_;
+            char const * keyStart = x_;
             std::string key = parseStr();
-            if (result.hasKey(key))
-                THROW(JSONError(l, c)) << "Key " << key << " already exists";
+            // the key is inserted first so that duplicates are reported at their position, the value is owned by the result as soon as it is created
+            auto i = result.valueObject_.insert(std::make_pair(std::move(key), nullptr));
+            if (! i.second)
+                THROW(errorAt(keyStart)) << "Key " << i.first->first << " already exists";
             skipWhitespace();
             pop(':');
             skipWhitespace();
-            JSON value = parseElement();
-            value.setComment(comment);
-            result.add(key, std::move(value));
+            i.first->second = new JSON{parseElement()};
+            i.first->second->comment_ = std::move(comment);
         }
 
         /** OBJECT := '{' [ [ COMMENT ] STR ':' ELEMENT { ',' [COMMENT] STR ':' ELEMENT } ] }
@@ -1283,44 +1312,34 @@ HELPERS_NAMESPACE_BEGIN
         }
 
         char top() const {
-            if (input_.eof())
-                return 0;
-            return static_cast<char>(input_.peek());
+            return x_ == end_ ? 0 : *x_;
         }
 
         char pop() {
-            char x = top();
-            if (input_.get() == '\n') {
-                ++line_;
-                col_ = 1;
-            } else if (x >= 0) { // beginning of a character in UTF8
-                ++col_;
-            } 
-            return x;
+            return x_ == end_ ? 0 : *x_++;
         }
 
         char pop(char what) {
             char x = top();
             if (x != what)
-                THROW(JSONError(line_, col_)) << "Expected " << what << ", but " << x << " found";
+                THROW(errorAt(x_)) << "Expected " << what << ", but " << x << " found";
             return pop();
         }
 
         void pop(char const * what) {
             char const * w = what;
-            unsigned l = line_;
-            unsigned c = col_;
+            char const * start = x_;
             while (*w != 0) {
-                if (input_.eof())
-                    THROW(JSONError(l, c)) << "Expected " << what << ", but EOF found";
+                if (x_ == end_)
+                    THROW(errorAt(start)) << "Expected " << what << ", but EOF found";
                 pop(*w);
                 ++w;
             }
         }
 
         bool condPop(char what) {
-            if (top() == what) {
-                pop();
+            if (x_ != end_ && *x_ == what) {
+                ++x_;
                 return true;
             } else {
                 return false;
@@ -1328,24 +1347,50 @@ HELPERS_NAMESPACE_BEGIN
         }
 
         void skipWhitespace() {
-            while(IsWhitespace(top()))
-                pop();
+            while (x_ != end_ && IsWhitespace(*x_))
+                ++x_;
+        }
+
+        /** Creates the error for the given position in the input. 
+
+            Lines and columns are numbered from 1, columns count UTF8 characters. 
+         */
+        JSONError errorAt(char const * at) const {
+            unsigned line = 1;
+            unsigned col = 1;
+            for (char const * x = begin_; x != at; ++x) {
+                if (*x == '\n') {
+                    ++line;
+                    col = 1;
+                } else if ((*x & 0xc0) != 0x80) {
+                    ++col;
+                }
+            }
+            return JSONError{line, col};
         }
 
-        unsigned line_;
-        unsigned col_;
-        std::istream & input_;
+        char const * begin_;
+        char const * x_;
+        char const * end_;
 
     }; // JSON::Parser
 
-    inline JSON JSON::Parse(std::istream & s) {
-        Parser p(s);
+    inline JSON JSON::Parse(char const * begin, char const * end) {
+        Parser p(begin, end);
         JSON result = p.parseJSON();
         p.skipWhitespace();
-        if (! s.eof())
-            THROW(JSONError(p.line_, p.col_)) << "Unparsed contents";
+        if (p.x_ != end)
+            THROW(p.errorAt(p.x_)) << "Unparsed contents";
         return result;
     }
 
+    inline JSON JSON::Parse(std::istream & s) {
+        std::stringstream contents;
+        if (s.peek() != std::istream::traits_type::eof())
+            contents << s.rdbuf();
+        std::string const & str = contents.str();
+        return Parse(str.c_str(), str.c_str() + str.size());
+    }
+
 
 HELPERS_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <stack>
 #include <string>
+#include <cstring>
 #include <functional>
 #include <variant>
 
@@ -9,8 +10,13 @@
 
 HELPERS_NAMESPACE_BEGIN
 
+    /** The default value of each property is created only once per its declaration in the schema and is shared by all instances of the property (such as in array elements). 
+     */
 	#define CONFIG_PROPERTY(NAME, DESCRIPTION, DEFAULT_VALUE, ...) \
-	    Property<__VA_ARGS__> NAME{this, #NAME, DESCRIPTION, DEFAULT_VALUE}
+	    Property<__VA_ARGS__> NAME{this, #NAME, DESCRIPTION, []() { \
+		    static JSONConfig::Property<__VA_ARGS__>::DefaultValue defaultValue{DEFAULT_VALUE}; \
+			return & defaultValue; \
+		}()}
 
 	#define CONFIG_OBJECT(NAME, DESCRIPTION, ...) \
 	    class NAME ## Object : public Object { \
@@ -28,7 +34,10 @@ HELPERS_NAMESPACE_BEGIN
 			NAME ## _entry(JSONConfig * parent): Object{parent, "", ""} { \
             } \
         }; \
-        Array<NAME ## _entry> NAME{this, #NAME, DESCRIPTION, DEFAULT_VALUE}
+        Array<NAME ## _entry> NAME{this, #NAME, DESCRIPTION, []() { \
+		    static JSONConfig::DefaultValue defaultValue{DEFAULT_VALUE}; \
+			return & defaultValue; \
+		}()}
 
     class ArgumentError : public Exception {
     };
@@ -41,6 +50,7 @@ HELPERS_NAMESPACE_BEGIN
 
         - empty value == default value, by which the configuration is initialized
 
+        The configuration does not keep a JSON mirror of itself. Properties store their converted values and only the JSON they were updated with, so that the configuration can be saved. The JSON for the whole configuration is created on demand by toJSON().
         */
 
     class JSONConfig {
@@ -49,6 +59,8 @@ HELPERS_NAMESPACE_BEGIN
         class Root;
         class CmdArgsRoot;
 
+        class DefaultValue;
+
         class Object;
 
         template<typename T>
@@ -57,18 +69,7 @@ HELPERS_NAMESPACE_BEGIN
         template<typename T>
         class Property;
 
-        virtual ~JSONConfig() {
-            if (parent_ == nullptr)
-                delete json_;
-        }
-
-        JSON::Kind kind() const {
-            return json_->kind();
-        }
-
-        bool isBool() const {
-            return json_->kind() == JSON::Kind::Boolean;
-        }
+        virtual ~JSONConfig() = default;
 
         /** Returns the full name of the configuration option. 
          
@@ -85,7 +86,7 @@ HELPERS_NAMESPACE_BEGIN
          
             For default values, the description is also stored as a comment in the backing JSON object. 
          */
-        std::string const & description() const {
+        char const * description() const {
             return description_;
         }
 
@@ -112,30 +113,21 @@ HELPERS_NAMESPACE_BEGIN
          */
         virtual JSON toJSON(bool updatedOnly = true) const = 0;
 
+        /** Reloads the configuration from another configuration of the same schema, such as one freshly read from the settings file. 
+         
+            Only the values that differ are copied, together with their updated flags. Returns true if any value has changed. 
+         */
+        virtual bool reloadFrom(JSONConfig const & other) = 0;
+
     protected:
 
         friend class CmdArgRoot;
 
-        JSONConfig(JSONConfig * parent, std::string const & name, std::string const & description, JSON const & defaultValue):
+        JSONConfig(JSONConfig * parent, char const * name, char const * description):
             parent_{parent},
-            description_{description},
-            defaultValue_{defaultValue}{
+            description_{description} {
             if (parent_ != nullptr)
                 parent_->addChildProperty(name, this);
-            // if parent is null, then we are root and should create the root object 
-            else 
-                json_ = new JSON{JSON::Kind::Object};
-        }
-
-        JSONConfig(JSONConfig * parent, std::string const & name, std::string const & description, std::function<JSON()> defaultValue):
-            parent_{parent},
-            description_{description},
-            defaultValue_{defaultValue} {
-            if (parent_ != nullptr)
-                parent_->addChildProperty(name, this);
-            // if parent is null, then we are root and should create the root object 
-            else 
-                json_ = new JSON{JSON::Kind::Object};
         }
 
         /** Converts the given JSON to a value of specified type. 
@@ -157,24 +149,6 @@ HELPERS_NAMESPACE_BEGIN
          */
         virtual bool fillMissingValues() = 0;
 
-        /** Returns the default value for the property. 
-         
-            This can either be a static JSON object, or dynamically computed JSON value, in which case the associated function to determine the value is called and its result returned. 
-
-            In both cases the comment of the returned JSON is set to the description of the property.
-         */
-        JSON defaultValue() const {
-            if (std::holds_alternative<JSON>(defaultValue_)) {
-                JSON result = std::get<JSON>(defaultValue_);
-                result.setComment(description_);
-                return result;
-            } else {
-                JSON result = std::get<std::function<JSON()>>(defaultValue_)();
-                result.setComment(description_);
-                return result;
-            }
-        }
-
         /** Calls update on given config. 
          
             Required due to friend delcarations only valid on this object, so that subclasses have no way of calling update on other items than themselves.
@@ -183,7 +157,7 @@ HELPERS_NAMESPACE_BEGIN
             return config->update(value, errorHandler);
         }
 
-        virtual void addChildProperty(std::string const & name, JSONConfig * child) = 0;
+        virtual void addChildProperty(char const * name, JSONConfig * child) = 0;
 
         /** Returns the fully qualified name of the given child of the configuration element. 
          
@@ -211,12 +185,8 @@ HELPERS_NAMESPACE_BEGIN
 
         /** Parent configuration object. */
         JSONConfig * parent_ = nullptr;
-        /* The JSON object holding the configuration. */
-        JSON * json_ = nullptr;
 
-        std::string description_;
-
-        std::variant<JSON, std::function<JSON()>> defaultValue_;
+        char const * description_;
 
         bool updated_ = false;
 #ifndef NDEBUG
@@ -227,18 +197,49 @@ HELPERS_NAMESPACE_BEGIN
 
     }; 
 
+    /** Default value of a configuration property or array. 
+     
+        This can either be a static JSON object, or dynamically computed JSON value, in which case the associated function to determine the value is called each time the value is required. 
+     */
+    class JSONConfig::DefaultValue {
+    public:
+        DefaultValue(JSON const & value):
+            value_{value} {
+        }
+
+        DefaultValue(std::function<JSON()> value):
+            value_{value} {
+        }
+
+        /** Returns true if the default value is calculated. 
+         */
+        bool calculated() const {
+            return std::holds_alternative<std::function<JSON()>>(value_);
+        }
+
+        /** Returns the default value as JSON with the comment set to the given description.
+         */
+        JSON toJSON(char const * description) const {
+            JSON result = calculated() ? std::get<std::function<JSON()>>(value_)() : std::get<JSON>(value_);
+            result.setComment(description);
+            return result;
+        }
+
+    private:
+        std::variant<JSON, std::function<JSON()>> value_;
+    }; // JSONConfig::DefaultValue
+
     class JSONConfig::Object : public JSONConfig {
     public:
-        Object(JSONConfig * parent, std::string const & name, std::string const & description):
-            JSONConfig{parent, name, description, JSON::Object()} {
+        Object(JSONConfig * parent, char const * name, char const * description):
+            JSONConfig{parent, name, description} {
             //ASSERT(parent != nullptr) << "Use JSONConfig::Root for parent-less configuration objects";
         } 
 
         JSON toJSON(bool updatedOnly = true) const override {
-            ASSERT(json_ != nullptr);
             JSON result = JSON::Object();
-            result.setComment(json_->comment());
-            for (auto i : properties_) {
+            result.setComment(comment_);
+            for (auto & i : properties_) {
                 if (updatedOnly && ! i.second->updated_)
                     continue;
                 result.add(i.first, i.second->toJSON(updatedOnly));
@@ -246,27 +247,37 @@ HELPERS_NAMESPACE_BEGIN
             return result;
         }
 
+        bool reloadFrom(JSONConfig const & other) override {
+            Object const & from = static_cast<Object const &>(other);
+            ASSERT(properties_.size() == from.properties_.size());
+            bool result = false;
+            for (size_t i = 0, e = properties_.size(); i < e; ++i)
+                result = properties_[i].second->reloadFrom(* from.properties_[i].second) || result;
+            updated_ = from.updated_;
+            comment_ = from.comment_;
+            return result;
+        }
+
     protected:
 
         bool update(JSON const & value, std::function<void(JSONError &&)> errorHandler = [](JSONError && e) { throw std::move(e); }) override {
 #ifndef NDEBUG
             initialized_ = true;
 #endif
-            ASSERT(json_ != nullptr);
             if (value.kind() != JSON::Kind::Object) {
                 errorHandler(CREATE_EXCEPTION(JSONError())  << "Initializing " << name() << " with " << value << ", but object expected");
                 return false;
             }
             updated_ = true;
             bool result = false;
-            json_->setComment(value.comment());
+            comment_ = value.comment();
             // update the values
             for (auto i = value.begin(), e = value.end(); i != e; ++i) {
-                auto x = properties_.find(i.name());
-                if (x == properties_.end()) 
+                JSONConfig * x = property(i.name());
+                if (x == nullptr) 
                     errorHandler(CREATE_EXCEPTION(JSONError()) << "Unknown property " << i.name() << " in " << name());
                 else
-                    result = x->second->update(*i, errorHandler) || result;
+                    result = x->update(*i, errorHandler) || result;
             }
             return result;
         }
@@ -277,7 +288,7 @@ HELPERS_NAMESPACE_BEGIN
          */
         bool fillMissingValues() override {
             bool result = false;
-            for (auto i : properties_) {
+            for (auto & i : properties_) {
                 if (i.second->fillMissingValues()) {
                     result = true;
                     updated_ = true;
@@ -286,22 +297,34 @@ HELPERS_NAMESPACE_BEGIN
             return result;
         }
 
-        void addChildProperty(std::string const & name, JSONConfig * child) override {
-            if (properties_.insert(std::make_pair(name, child)).second == false)
+        void addChildProperty(char const * name, JSONConfig * child) override {
+            if (property(name) != nullptr)
                 THROW(JSONError()) << "Element " << name << " already exists in " << this->name();
-            // add the object placeholder to parent - this *will* be changed to parsed value, or to the default value before first parsed, but the object will allow nesting
-            child->json_ = & json_->add(name, JSON::Object());
+            properties_.push_back(std::make_pair(name, child));
         }
 
         std::string childName(JSONConfig const * child) const override {
             std::string result = (parent_ == nullptr) ? "" : (parent_->childName(this) + '.');
-            for (auto i : properties_)
+            for (auto & i : properties_)
                 if (i.second == child)
                     return result + i.first;
             UNREACHABLE;
         }
 
-        std::unordered_map<std::string, JSONConfig*> properties_;
+        /** Returns the child property of given name, or nullptr if not found. 
+         
+            Objects have only a handful of properties so a linear search in the order of their declaration is faster than hashing. 
+         */
+        JSONConfig * property(std::string const & name) const {
+            for (auto & i : properties_)
+                if (name == i.first)
+                    return i.second;
+            return nullptr;
+        }
+
+        std::vector<std::pair<char const *, JSONConfig*>> properties_;
+
+        std::string comment_;
 
     }; // JSONConfig::Object
 
@@ -346,16 +369,14 @@ HELPERS_NAMESPACE_BEGIN
 
         }; // JSONConfig::Array::ConstIterator
 
-        Array(JSONConfig * parent, std::string const & name, std::string const & description):
-            JSONConfig{parent, name, description, JSON::Array()} {
-        }
-
-        Array(JSONConfig * parent, std::string const & name, std::string const & description, JSON const & defaultValue):
-            JSONConfig{parent, name, description, defaultValue} {
+        Array(JSONConfig * parent, char const * name, char const * description, DefaultValue const * defaultValue):
+            JSONConfig{parent, name, description},
+            defaultValue_{defaultValue} {
         }
 
-        Array(JSONConfig * parent, std::string const & name, std::string const & description, std::function<JSON()> defaultValue):
-            JSONConfig{parent, name, description, defaultValue} {
+        ~Array() override {
+            for (auto i : elements_)
+                delete i;
         }
 
         size_t size() const {
@@ -382,9 +403,8 @@ HELPERS_NAMESPACE_BEGIN
 
         JSON toJSON(bool updatedOnly = true) const override {
             ASSERT(updated_ || ! updatedOnly);
-            ASSERT(json_ != nullptr);
             JSON result{JSON::Array()};
-            result.setComment(json_->comment());
+            result.setComment(comment_);
             for (auto i : elements_)
                 result.add(i->toJSON(updatedOnly));
             return result;
@@ -400,28 +420,51 @@ HELPERS_NAMESPACE_BEGIN
         void erase(JSONConfig const & element) {
             for (size_t i = 0, e = elements_.size(); i < e; ++i) {
                 if (elements_[i] == & element) {
+                    delete elements_[i];
                     elements_.erase(elements_.begin() + i);
-                    json_->erase(i);
                     return;
                 }
             }
         }
 
+        /** Reloads the array from other array. 
+         
+            If both arrays have the same number of elements, the elements are reloaded one by one so that only the changed values are copied. Otherwise the array is recreated from the other array's JSON. 
+         */
+        bool reloadFrom(JSONConfig const & other) override {
+            Array const & from = static_cast<Array const &>(other);
+            comment_ = from.comment_;
+            if (elements_.size() == from.elements_.size()) {
+                bool result = false;
+                for (size_t i = 0, e = elements_.size(); i < e; ++i)
+                    result = elements_[i]->reloadFrom(* from.elements_[i]) || result;
+                updated_ = from.updated_;
+                return result;
+            }
+            for (auto i : elements_)
+                delete i;
+            elements_.clear();
+            updated_ = false;
+            if (from.updated_)
+                update(from.toJSON());
+            fillMissingValues();
+            return true;
+        }
+
     protected:
 
         bool update(JSON const & value, std::function<void(JSONError &&)> errorHandler = [](JSONError && e) { throw std::move(e); }) override {
-            ASSERT(json_ != nullptr);
 #ifndef NDEBUG
             initialized_ = true;
 #endif
-            *json_ = JSON::Array();
+            comment_.clear();
             if (value.kind() != JSON::Kind::Array) {
                 errorHandler(CREATE_EXCEPTION(JSONError())  << "Initializing " << name() << " with " << value << ", but array expected");
                 return false;
             }
             bool result = false;
             updated_ = true;
-            json_->setComment(value.comment());
+            comment_ = value.comment();
             // delete previous value
             for (auto i : elements_)
                 delete i;
@@ -442,10 +485,10 @@ HELPERS_NAMESPACE_BEGIN
             bool result = false;
             // get default value JSON and update with it 
             if (!updated_) {
-                update(defaultValue());
+                update(defaultValue_->toJSON(description_));
                 // if the default value was calculated, return true as the value should be saved and keep the updated_ flag to true so that it is, 
                 // otherwise clear update_ flag and return false
-                if (std::holds_alternative<std::function<JSON()>>(defaultValue_))
+                if (defaultValue_->calculated())
                     result = true;
                 else
                     updated_ = false;
@@ -460,11 +503,10 @@ HELPERS_NAMESPACE_BEGIN
             return result;
         }
 
-        void addChildProperty(std::string const & name, JSONConfig * child) override {
+        void addChildProperty(char const * name, JSONConfig * child) override {
             MARK_AS_UNUSED(name);
-            ASSERT(name == "");
+            ASSERT(name[0] == 0);
             elements_.push_back(child);
-            child->json_ = & json_->add(JSON::Object());
         }
 
         std::string childName(JSONConfig const * child) const override {
@@ -477,18 +519,45 @@ HELPERS_NAMESPACE_BEGIN
 
         std::vector<JSONConfig*> elements_;
 
+        std::string comment_;
+
+        DefaultValue const * defaultValue_;
+
     }; // JSONConfig::Array
 
     template<typename T>
     class JSONConfig::Property : public JSONConfig {
     public:
 
-        Property(JSONConfig * parent, std::string name, std::string description, JSON const & defaultValue):
-            JSONConfig{parent, name, description, defaultValue} {
-        }
+        /** Default value of the property. 
+         
+            Static default values are converted to the property type only once when the default is created, so that filling in the default value is a simple copy. 
+         */
+        class DefaultValue : public JSONConfig::DefaultValue {
+        public:
+            DefaultValue(JSON const & value):
+                JSONConfig::DefaultValue{value},
+                value_{FromJSON<T>(value)} {
+            }
+
+            DefaultValue(std::function<JSON()> value):
+                JSONConfig::DefaultValue{value} {
+            }
+
+            /** Returns the converted static default value. 
+             */
+            T const & value() const {
+                ASSERT(! calculated());
+                return value_;
+            }
+
+        private:
+            T value_;
+        }; // JSONConfig::Property::DefaultValue
 
-        Property(JSONConfig * parent, std::string name, std::string description, std::function<JSON()> defaultValue):
-            JSONConfig{parent, name, description, defaultValue} {
+        Property(JSONConfig * parent, char const * name, char const * description, DefaultValue const * defaultValue):
+            JSONConfig{parent, name, description},
+            defaultValue_{defaultValue} {
         }
             
         /** Typecasts the configuration property to the property value type. 
@@ -503,20 +572,31 @@ HELPERS_NAMESPACE_BEGIN
         JSON toJSON(bool updatedOnly = true) const override {
             MARK_AS_UNUSED(updatedOnly);
             ASSERT(updated_ || ! updatedOnly);
-            ASSERT(json_ != nullptr);
-            return *json_;
+            return updated_ ? json_ : defaultValue_->toJSON(description_);
+        }
+
+        bool reloadFrom(JSONConfig const & other) override {
+            Property const & from = static_cast<Property const &>(other);
+#ifndef NDEBUG
+            initialized_ = from.initialized_;
+#endif
+            if (updated_ == from.updated_ && (! updated_ || json_ == from.json_))
+                return false;
+            value_ = from.value_;
+            json_ = from.json_;
+            updated_ = from.updated_;
+            return true;
         }
 
     protected:
 
         bool update(JSON const & value, std::function<void(JSONError &&)> errorHandler = [](JSONError && e) { throw std::move(e); }) override {
-            ASSERT(json_ != nullptr);
 #ifndef NDEBUG
             initialized_ = true;
 #endif
             try {
                 value_ = JSONConfig::FromJSON<T>(value);
-                *json_ = value;
+                json_ = value;
                 updated_ = true;
             } catch (std::exception const & e) {
                 errorHandler(CREATE_EXCEPTION(JSONError()) << "Error when parsing JSON value for " << name() << ": " << e.what());
@@ -527,14 +607,16 @@ HELPERS_NAMESPACE_BEGIN
         bool fillMissingValues() override {
             if (updated_)
                 return false;
-            // get default value JSON and update with it 
-            update(defaultValue());
-            // if the default value was calculated, return true as the value should be saved and keep the updated_ flag to true so that it is, 
-            // otherwise clear update_ flag and return false
-            if (std::holds_alternative<std::function<JSON()>>(defaultValue_)) {
+            // if the default value is calculated, update with it and return true as the value should be saved and keep the updated_ flag to true so that it is, 
+            // otherwise just copy the already converted default value
+            if (defaultValue_->calculated()) {
+                update(defaultValue_->toJSON(description_));
                 return true;
             } else {
-                updated_ = false;
+#ifndef NDEBUG
+                initialized_ = true;
+#endif
+                value_ = defaultValue_->value();
                 return false;
             }
         }
@@ -543,7 +625,7 @@ HELPERS_NAMESPACE_BEGIN
             JSONConfig::cmdArgUpdate(value, index);
         }
 
-        void addChildProperty(std::string const & name, JSONConfig * child) override {
+        void addChildProperty(char const * name, JSONConfig * child) override {
             MARK_AS_UNUSED(name);
             MARK_AS_UNUSED(child);
             UNREACHABLE;
@@ -556,6 +638,11 @@ HELPERS_NAMESPACE_BEGIN
 
         T value_;
 
+        /** The JSON the property was updated with, valid only if updated. */
+        JSON json_;
+
+        DefaultValue const * defaultValue_;
+
     }; 
 
     /** The root element of the JSON backed configuration. 
@@ -567,7 +654,7 @@ HELPERS_NAMESPACE_BEGIN
             Object{nullptr, "", "Configuration"} {
         }
 
-        explicit Root(std::string description):
+        explicit Root(char const * description):
             Object{ nullptr, "", description } {
         }
 
@@ -1,3 +1,5 @@
+#pragma once
+
 #include "helpers.h"
 
 HELPERS_NAMESPACE_BEGIN
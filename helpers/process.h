@@ -5,8 +5,12 @@
 #include <sys/wait.h>
 #include <sys/ioctl.h>
 #include <errno.h>
+#include <spawn.h>
+
+extern char ** environ;
 #endif
 
+#include <cstring>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -146,6 +150,14 @@ HELPERS_NAMESPACE_BEGIN
 
 		Command& operator = (Command const& other) = default;
 
+		bool operator == (Command const & other) const {
+			return command_ == other.command_ && args_ == other.args_ && workingDirectory_ == other.workingDirectory_;
+		}
+
+		bool operator != (Command const & other) const {
+			return ! (*this == other);
+		}
+
 		/** Quotes the given string for shell purposes. 
 
 		    Space and quotes are quoted, everything else stays as is. If there are no characters that need to be quoted in the string, returns the unchanged argument, otherwise returns the quoted argument in double quotes. 
@@ -222,6 +234,12 @@ HELPERS_NAMESPACE_BEGIN
 			}
 		}
 
+		/** Forgets any change to the given variable, which is then inherited from the current process. 
+		 */
+		void erase(std::string const& name) {
+			map_.erase(name);
+		}
+
 		/** Applies the changes in the environment to the actual environment of the current process. 
 		 */
 		void apply() {
@@ -237,6 +255,42 @@ HELPERS_NAMESPACE_BEGIN
 #endif
 		}
 
+#if (defined ARCH_UNIX)
+		/** Returns the environment of the current process with the changes applied as a list of `name=value` strings. 
+
+		    Unlike apply(), does not modify the current process, so the result can be passed to posix_spawn.
+		 */
+		std::vector<std::string> merged() const {
+			std::vector<std::string> result;
+			for (char ** x = environ; *x != nullptr; ++x) {
+				char const * eq = strchr(*x, '=');
+				if (eq == nullptr || map_.find(std::string(*x, eq - *x)) == map_.end())
+					result.push_back(*x);
+			}
+			for (auto i : map_)
+				if (! i.second.empty())
+					result.push_back(i.first + "=" + i.second);
+			return result;
+		}
+
+		/** Creates an environment which replaces the environment of the current process with the given list of `name=value` strings, i.e. the variables of the current process which are not in the list are unset. 
+		 */
+		static Environment Replacing(std::vector<std::string> const & entries) {
+			Environment result;
+			for (char ** x = environ; *x != nullptr; ++x) {
+				char const * eq = strchr(*x, '=');
+				if (eq != nullptr)
+					result.map_[std::string(*x, eq - *x)] = "";
+			}
+			for (std::string const & entry : entries) {
+				size_t eq = entry.find('=');
+				if (eq != std::string::npos && eq > 0)
+					result.map_[entry.substr(0, eq)] = entry.substr(eq + 1);
+			}
+			return result;
+		}
+#endif
+
 		/** Creates an empty environment. 
 		 */
 		Environment() = default;
@@ -380,9 +434,44 @@ HELPERS_NAMESPACE_BEGIN
         int       toCmd[2];
         int       fromCmd[2];
         OSCHECK(pipe(toCmd) == 0 && pipe(fromCmd) == 0) << "Cannot create pipes for command " << command;
-        // fork, create process and split between process and us (the reading)
         pid_t     pid;
-        switch (pid = fork()) {
+        /* Spawn the process if possible, which avoids copying the address space of the (potentially large) current process. Spawning cannot change the working directory unless posix_spawn_file_actions_addchdir_np is available, in which case fork is used instead.
+         */
+#if (defined __GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+        bool spawn = true;
+#else
+        bool spawn = command.workingDirectory().empty();
+#endif
+        if (spawn) {
+            posix_spawn_file_actions_t actions;
+            OSCHECK(
+                posix_spawn_file_actions_init(& actions) == 0 &&
+                posix_spawn_file_actions_adddup2(& actions, toCmd[0], STDIN_FILENO) == 0 &&
+                posix_spawn_file_actions_adddup2(& actions, fromCmd[1], STDOUT_FILENO) == 0 &&
+                posix_spawn_file_actions_adddup2(& actions, fromCmd[1], STDERR_FILENO) == 0 &&
+                posix_spawn_file_actions_addclose(& actions, toCmd[1]) == 0 &&
+                posix_spawn_file_actions_addclose(& actions, fromCmd[0]) == 0
+            ) << "Unable to change standard output for process " << command;
+#if (defined __GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+            if (!command.workingDirectory().empty())
+                OSCHECK(posix_spawn_file_actions_addchdir_np(& actions, command.workingDirectory().c_str()) == 0) << "Cannot change dir for command " << command;
+#endif
+            char** argv = command.toArgv();
+            int err = posix_spawnp(& pid, command.command().c_str(), & actions, nullptr, argv, environ);
+            delete [] argv;
+            posix_spawn_file_actions_destroy(& actions);
+            // report commands that cannot be executed the same way a shell does
+            if (err != 0) {
+                close(toCmd[0]);
+                close(toCmd[1]);
+                close(fromCmd[0]);
+                close(fromCmd[1]);
+                if (exitCode == nullptr)
+                    THROW(Exception()) << "Unable to execute command " << command << ", error " << err;
+                * exitCode = 127;
+                return std::string{};
+            }
+        } else switch (pid = fork()) {
             case -1:
                 OSCHECK(false) << "Cannot fork for command " << command;
                 /* The child patches the pipe to the standatd input and output and then executes the command.
@@ -416,10 +505,10 @@ HELPERS_NAMESPACE_BEGIN
             close(fromCmd[1]) == 0
         ) << "Unable to close pipes for command " << command;
         // now read the file
-        std::stringstream result;
-        char buffer[128];
+        std::string result;
+        char buffer[4096];
         while (true) {
-            int numBytes = ::read(fromCmd[0], buffer, 128);
+            ssize_t numBytes = ::read(fromCmd[0], buffer, sizeof(buffer));
             // end of file
             if (numBytes == 0)
                 break;
@@ -429,16 +518,18 @@ HELPERS_NAMESPACE_BEGIN
                 OSCHECK(false) << "Cannot read output of command " << command;
             }
             // otherwise add the read data to the result
-            result << std::string(buffer, numBytes);
+            result.append(buffer, numBytes);
         }
+        close(fromCmd[0]);
+        close(toCmd[1]);
         // now get the exit code
         ExitCode ec;
         OSCHECK(waitpid(pid, &ec, 0) == pid);
         if (exitCode != nullptr)
             * exitCode = WEXITSTATUS(ec);
         else if (ec != EXIT_SUCCESS)
-            THROW(Exception()) << "Command " << command << " exited with code " << ec << ", output:\n" << result.str();
-        return result.str();
+            THROW(Exception()) << "Command " << command << " exited with code " << ec << ", output:\n" << result;
+        return result;
 #endif
     }
 
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers.h"
+
+HELPERS_NAMESPACE_BEGIN
+
+    /** Records the phases of the application startup up to the first frame showing output of the program in the terminal.
+
+        The trace is always recorded as it is only a handful of events, its phases are marked with the StartupTrace::Phase RAII guard, or as instant events. The trace is complete when the first frame is rendered after the first output from the PTY has been received. At that point the completion handler (if any) is called, which can report the trace as a human readable summary, or in the Chrome trace event format (viewable in `chrome://tracing` or Perfetto). Once complete, the tracer ignores any further events so that its cost during the normal execution, such as a phase guarding each rendered frame, is a single atomic load.
+
+        The time is measured since the tracer singleton was created. The application should create it during its static initialization, in a single translation unit.
+     */
+    class StartupTrace {
+    public:
+
+        /** Single recorded event, either a phase with duration, or an instant.
+         */
+        struct Event {
+            char const * name;
+            /** Start of the event in microseconds since the tracer was created. */
+            long long start;
+            /** Duration in microseconds, -1 for instant events. */
+            long long duration;
+            unsigned thread;
+        }; // StartupTrace::Event
+
+        /** Marks a phase of the startup for the lifetime of the guard.
+         */
+        class Phase {
+        public:
+            explicit Phase(char const * name):
+                name_{nullptr},
+                start_{0} {
+                StartupTrace & trace = Instance();
+                if (! trace.complete()) {
+                    name_ = name;
+                    start_ = trace.now();
+                }
+            }
+
+            ~Phase() {
+                end();
+            }
+
+            /** Ends the phase before the guard goes out of scope. 
+             */
+            void end() {
+                if (name_ == nullptr)
+                    return;
+                StartupTrace & trace = Instance();
+                trace.record(name_, start_, trace.now() - start_);
+                name_ = nullptr;
+            }
+
+        private:
+            char const * name_;
+            long long start_;
+        }; // StartupTrace::Phase
+
+        static StartupTrace & Instance() {
+            static StartupTrace trace;
+            return trace;
+        }
+
+        /** Records an instant event.
+         */
+        static void Mark(char const * name) {
+            StartupTrace & trace = Instance();
+            trace.record(name, trace.now(), -1);
+        }
+
+        /** To be called whenever output from the PTY is received.
+         */
+        static void PTYOutputReceived() {
+            StartupTrace & trace = Instance();
+            if (trace.ptyOutput_.load(std::memory_order_relaxed) || trace.complete_.load(std::memory_order_relaxed))
+                return;
+            if (! trace.ptyOutput_.exchange(true))
+                Mark("first PTY output");
+        }
+
+        /** To be called whenever a frame has been rendered.
+         */
+        static void FrameRendered() {
+            StartupTrace & trace = Instance();
+            if (trace.complete_.load(std::memory_order_relaxed))
+                return;
+            if (! trace.frame_.exchange(true))
+                Mark("first frame");
+            if (trace.ptyOutput_ && ! trace.complete_.exchange(true)) {
+                Mark("first output frame");
+                std::function<void(StartupTrace &)> handler;
+                {
+                    std::lock_guard<std::mutex> g{trace.m_};
+                    handler = trace.onComplete_;
+                }
+                if (handler)
+                    handler(trace);
+            }
+        }
+
+        /** Returns true if the trace is complete and further events are ignored.
+         */
+        bool complete() const {
+            return complete_.load(std::memory_order_relaxed);
+        }
+
+        /** Sets the handler to be called when the trace is complete.
+         */
+        void setOnComplete(std::function<void(StartupTrace &)> handler) {
+            std::lock_guard<std::mutex> g{m_};
+            onComplete_ = handler;
+        }
+
+        std::vector<Event> events() const {
+            std::lock_guard<std::mutex> g{m_};
+            return events_;
+        }
+
+        /** Writes a human readable summary of the trace, one event per line in order of their start.
+         */
+        void writeSummary(std::ostream & s) const {
+            std::vector<Event> events{this->events()};
+            // phases are recorded when they end
+            std::stable_sort(events.begin(), events.end(), [](Event const & a, Event const & b) { return a.start < b.start; });
+            s << "Startup trace (ms since start):" << std::endl;
+            for (Event const & e : events) {
+                s << std::fixed << std::setprecision(2) << std::setw(10) << (e.start / 1000.0);
+                if (e.duration >= 0)
+                    s << " +" << std::setw(9) << (e.duration / 1000.0) << "  ";
+                else
+                    s << "             ";
+                s << e.name << std::endl;
+            }
+        }
+
+        /** Writes the trace in the Chrome trace event JSON format.
+         */
+        void writeChromeTrace(std::ostream & s) const {
+            std::vector<Event> events{this->events()};
+            s << "{\"traceEvents\":[";
+            for (size_t i = 0; i < events.size(); ++i) {
+                Event const & e = events[i];
+                s << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << e.name << "\",\"pid\":1,\"tid\":" << e.thread << ",\"ts\":" << e.start;
+                if (e.duration >= 0)
+                    s << ",\"ph\":\"X\",\"dur\":" << e.duration << "}";
+                else
+                    s << ",\"ph\":\"i\",\"s\":\"g\"}";
+            }
+            s << "\n]}\n";
+        }
+
+    private:
+
+        StartupTrace():
+            start_{std::chrono::steady_clock::now()} {
+        }
+
+        long long now() const {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_).count();
+        }
+
+        void record(char const * name, long long start, long long duration) {
+            if (complete_.load(std::memory_order_relaxed) && duration >= 0)
+                return;
+            std::lock_guard<std::mutex> g{m_};
+            // threads are numbered in the order they first recorded an event
+            auto i = threads_.find(std::this_thread::get_id());
+            if (i == threads_.end())
+                i = threads_.insert(std::make_pair(std::this_thread::get_id(), static_cast<unsigned>(threads_.size() + 1))).first;
+            events_.push_back(Event{name, start, duration, i->second});
+        }
+
+        std::chrono::steady_clock::time_point start_;
+        mutable std::mutex m_;
+        std::vector<Event> events_;
+        std::unordered_map<std::thread::id, unsigned> threads_;
+        std::function<void(StartupTrace &)> onComplete_;
+        std::atomic<bool> ptyOutput_{false};
+        std::atomic<bool> frame_{false};
+        std::atomic<bool> complete_{false};
+
+    }; // StartupTrace
+
+HELPERS_NAMESPACE_END
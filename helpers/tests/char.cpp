@@ -0,0 +1,103 @@
+#include "helpers/tests.h"
+
+#include "helpers/char.h"
+
+TEST(helpers_char, columnWidth) {
+    EXPECT_EQ(Char::ColumnWidth('a'), 1);
+    EXPECT_EQ(Char::ColumnWidth(0xe9), 1); // e acute
+    EXPECT_EQ(Char::ColumnWidth(0x44b), 1); // cyrillic yeru
+    EXPECT_EQ(Char::ColumnWidth(0x4e2d), 2); // CJK ideograph
+    EXPECT_EQ(Char::ColumnWidth(0xac00), 2); // hangul syllable
+    EXPECT_EQ(Char::ColumnWidth(0xff21), 2); // fullwidth A
+    EXPECT_EQ(Char::ColumnWidth(0x1f600), 2); // grinning face emoji
+    EXPECT_EQ(Char::ColumnWidth(0x2f800), 2); // CJK compatibility supplement
+}
+
+TEST(helpers_char, zeroWidth) {
+    EXPECT_EQ(Char::ColumnWidth(0x301), 0); // combining acute accent
+    EXPECT_EQ(Char::ColumnWidth(0x200b), 0); // zero width space
+    EXPECT_EQ(Char::ColumnWidth(0x200d), 0); // zero width joiner
+    EXPECT_EQ(Char::ColumnWidth(0xfe0f), 0); // variation selector 16
+    EXPECT_EQ(Char::ColumnWidth(0xad), 1); // soft hyphen is displayed
+}
+
+TEST(helpers_char, conjoiningJamoWidth) {
+    EXPECT_EQ(Char::ColumnWidth(0x1100), 2); // hangul choseong kiyeok
+    EXPECT_EQ(Char::ColumnWidth(0x1160), 1); // hangul jungseong filler
+    EXPECT_EQ(Char::ColumnWidth(0x1161), 1); // hangul jungseong a
+    EXPECT_EQ(Char::ColumnWidth(0x11a8), 1); // hangul jongseong kiyeok
+    EXPECT_EQ(Char::ColumnWidth(0xd7b0), 1); // hangul jungseong o-yeo
+    EXPECT_EQ(Char::ColumnWidth(0xd7fb), 1); // hangul jongseong phieuph-thieuth
+}
+
+TEST(helpers_char, fromUTF8AtEnd) {
+    std::string s{"a\xc3\xa9\xe6\x97\xa5\xf0\x9f\x98\x80"};
+    char const * i = s.c_str();
+    char const * e = i + s.size();
+    EXPECT(Char::FromUTF8(i, e).codepoint() == 'a');
+    EXPECT(Char::FromUTF8(i, e).codepoint() == 0xe9);
+    EXPECT(Char::FromUTF8(i, e).codepoint() == 0x65e5);
+    EXPECT(Char::FromUTF8(i, e).codepoint() == 0x1f600);
+    EXPECT(i == e);
+    EXPECT_THROWS(CharError, Char::FromUTF8(i, e));
+}
+
+TEST(helpers_char, compose) {
+    EXPECT(Char::Compose('e', 0x301) == 0xe9);
+    EXPECT(Char::Compose('A', 0x30a) == 0xc5);
+    EXPECT(Char::Compose(0x438, 0x306) == 0x439); // cyrillic short i
+    EXPECT(Char::Compose('x', 0x301) == 0);
+    EXPECT(Char::Compose('e', 'e') == 0);
+    // composition exclusions
+    EXPECT(Char::Compose(0x915, 0x93c) == 0); // devanagari qa is script specific exclusion
+    EXPECT(Char::Compose(0x5d9, 0x5b4) == 0); // hebrew yod with hiriq is script specific exclusion
+    EXPECT(Char::Compose(0x308, 0x301) == 0); // combining greek dialytika tonos is non-starter decomposition
+}
+
+namespace {
+
+    std::u32string Decode(std::string const & str, bool stopAtControl = false, bool final = true) {
+        char32_t buffer[256];
+        char const * x = str.c_str();
+        size_t n = Char::DecodeUTF8(x, str.c_str() + str.size(), buffer, 256, stopAtControl, final);
+        return std::u32string{buffer, n};
+    }
+
+} // anonymous namespace
+
+TEST(helpers_char, decodeUTF8) {
+    EXPECT(Decode("hello world, this is longer than 16 bytes") == U"hello world, this is longer than 16 bytes");
+    EXPECT(Decode("\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82") == U"\u043f\u0440\u0438\u0432\u0435\u0442");
+    EXPECT(Decode("\xe4\xb8\xad\xe6\x96\x87 text") == U"\u4e2d\u6587 text");
+    EXPECT(Decode("\xf0\x9f\x98\x80!") == U"\U0001f600!");
+}
+
+TEST(helpers_char, decodeUTF8Invalid) {
+    // unexpected continuation byte
+    EXPECT(Decode("a\x80z") == U"a\ufffdz");
+    // overlong encoding
+    EXPECT(Decode("\xc0\xaf") == U"\ufffd\ufffd");
+    EXPECT(Decode("\xe0\x80\xaf") == U"\ufffd\ufffd\ufffd");
+    // surrogates
+    EXPECT(Decode("\xed\xa0\x80") == U"\ufffd\ufffd\ufffd");
+    // above U+10FFFF
+    EXPECT(Decode("\xf4\x90\x80\x80") == U"\ufffd\ufffd\ufffd\ufffd");
+    // maximal subpart is replaced by single replacement character
+    EXPECT(Decode("\xe4\xb8z") == U"\ufffdz");
+    EXPECT(Decode("\xf0\x9f\x98z") == U"\ufffdz");
+}
+
+TEST(helpers_char, decodeUTF8Incomplete) {
+    std::string str{"ab\xe4\xb8"};
+    char32_t buffer[16];
+    char const * x = str.c_str();
+    EXPECT_EQ(Char::DecodeUTF8(x, str.c_str() + str.size(), buffer, 16, false, /* final */ false), 2);
+    EXPECT_EQ(x - str.c_str(), 2);
+    EXPECT(Decode(str) == U"ab\ufffd");
+}
+
+TEST(helpers_char, decodeUTF8StopAtControl) {
+    EXPECT(Decode("0123456789abcdef0123\x1b[0m", true) == U"0123456789abcdef0123");
+    EXPECT(Decode("\xd0\xbf\n", true) == U"\u043f");
+    EXPECT(Decode("\xd0\xbf\n", false) == U"\u043f\n");
+}
@@ -0,0 +1,54 @@
+#include <cstring>
+
+#include "../fsm.h"
+#include "../tests.h"
+
+TEST(helpers_fsm, longestMatch) {
+    MatchingFSM<int, char> fsm;
+    EXPECT(fsm.empty());
+    fsm.addMatch("\033[A", 1);
+    fsm.addMatch("\033[1;5A", 2);
+    fsm.addMatch("\033O", 3);
+    fsm.addMatch("\033[1", 4);
+    EXPECT(! fsm.empty());
+    char const * input = "\033[1;5Axyz";
+    char const * i = input;
+    int result = 0;
+    EXPECT(fsm.match(i, input + 9, result));
+    EXPECT_EQ(result, 2);
+    EXPECT_EQ(i, input + 6);
+    // partial match falls back to the longest complete one
+    input = "\033[1;5B";
+    i = input;
+    EXPECT(fsm.match(i, input + 6, result));
+    EXPECT_EQ(result, 4);
+    EXPECT_EQ(i, input + 3);
+}
+
+TEST(helpers_fsm, noMatch) {
+    MatchingFSM<int, char> fsm;
+    fsm.addMatch("\033[A", 1);
+    char const * input = "\033[B";
+    char const * i = input;
+    int result = 0;
+    EXPECT(! fsm.match(i, input + 3, result));
+    EXPECT_EQ(i, input);
+    // end of input is respected
+    EXPECT(! fsm.match(i, input + 2, result));
+    EXPECT_EQ(i, input);
+}
+
+TEST(helpers_fsm, insertionOrder) {
+    MatchingFSM<int, char> fsm;
+    char const * words[] = { "b", "ab", "abc", "c", "aa", "ba", "a", "bb", "cab" };
+    for (int j = 0; j < 9; ++j)
+        fsm.addMatch(words[j], j);
+    for (int j = 0; j < 9; ++j) {
+        char const * i = words[j];
+        char const * end = i + strlen(i);
+        int result = -1;
+        EXPECT(fsm.match(i, end, result));
+        EXPECT_EQ(result, j);
+        EXPECT_EQ(i, end);
+    }
+}
@@ -38,3 +38,32 @@ TEST(helpers_json, boolean) {
     i = j;
     EXPECT(i == false);
 }
+
+TEST(helpers_json, parse) {
+    JSON j = JSON::Parse("/* settings */ { \"a\" : [1, -2, 0x10, 1.5, true, null], // comment\n \"b\" : \"x\\\"y\\\\z\\n\" }");
+    EXPECT_EQ(j.comment(), "settings");
+    EXPECT_EQ(j["a"].numElements(), 6);
+    EXPECT_EQ(j["a"][1].toInt(), -2);
+    EXPECT_EQ(j["a"][2].toInt(), 16);
+    EXPECT_EQ(j["a"][3].toDouble(), 1.5);
+    EXPECT(j["a"][5].isNull());
+    EXPECT_EQ(j["b"].comment(), "comment");
+    EXPECT_EQ(j["b"].toString(), "x\"y\\z\n");
+    std::stringstream s;
+    s << j;
+    EXPECT(JSON::Parse(s) == j);
+}
+
+TEST(helpers_json, parseErrors) {
+    EXPECT_THROWS(JSONError, JSON::Parse("{ \"a\" : 1, \"a\" : 2 }"));
+    EXPECT_THROWS(JSONError, JSON::Parse("\"unterminated"));
+    EXPECT_THROWS(JSONError, JSON::Parse("[1, 2] 3"));
+    EXPECT_THROWS(JSONError, JSON::Parse(""));
+    try {
+        JSON::Parse("{\n \"\xc3\xa9\" : tru }");
+        // the parse must fail
+        EXPECT(false);
+    } catch (JSONError const & e) {
+        EXPECT(std::string{e.what()}.find("[2,11]") != std::string::npos);
+    }
+}
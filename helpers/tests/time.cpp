@@ -0,0 +1,53 @@
+#include "../time.h"
+#include "../tests.h"
+
+TEST(helpers_time, timerServiceOnce) {
+    std::atomic<int> calls{0};
+    TimerService::Token t = TimerService::Instance().schedule(std::chrono::milliseconds{1}, std::chrono::milliseconds{0}, [&calls](){
+        ++calls;
+        return true;
+    });
+    EXPECT(t != 0);
+    while (TimerService::Instance().active(t))
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(helpers_time, timerServicePeriodic) {
+    std::atomic<int> calls{0};
+    TimerService::Token t = TimerService::Instance().schedule(std::chrono::milliseconds{0}, std::chrono::milliseconds{1}, [&calls](){
+        return ++calls < 3;
+    });
+    while (TimerService::Instance().active(t))
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(helpers_time, timerServiceCancel) {
+    std::atomic<int> calls{0};
+    TimerService::Token t = TimerService::Instance().schedule(std::chrono::milliseconds{0}, std::chrono::milliseconds{1}, [&calls](){
+        ++calls;
+        return true;
+    });
+    while (calls == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    TimerService::Instance().cancel(t);
+    EXPECT(! TimerService::Instance().active(t));
+    int after = calls;
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_EQ(calls, after);
+}
+
+TEST(helpers_time, timer) {
+    std::atomic<int> calls{0};
+    Timer timer;
+    timer.setInterval(1);
+    timer.setHandler([&calls](){
+        return ++calls < 5;
+    });
+    timer.start();
+    EXPECT(calls > 0 || timer.running());
+    while (timer.running())
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    EXPECT_EQ(calls, 5);
+}
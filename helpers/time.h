@@ -1,12 +1,22 @@
 #pragma once
 #define __STDC_WANT_LIB_EXT1__ 1
+#if (defined ARCH_WINDOWS)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 #include "helpers.h"
 
@@ -110,132 +120,262 @@ HELPERS_NAMESPACE_BEGIN
 		size_t mutable value_;
 	};
 
+	/** Returns the CPU time (user and kernel) consumed by all threads of the process so far. 
+	 */
+	inline std::chrono::microseconds ProcessCPUTime() {
+#if (defined ARCH_WINDOWS)
+		FILETIME creation, exit, kernel, user;
+		if (! GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+			return std::chrono::microseconds{0};
+		// filetime is in 100ns units
+		uint64_t k = (static_cast<uint64_t>(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime;
+		uint64_t u = (static_cast<uint64_t>(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+		return std::chrono::microseconds{(k + u) / 10};
+#else
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return std::chrono::microseconds{0};
+		return std::chrono::seconds{usage.ru_utime.tv_sec + usage.ru_stime.tv_sec} + std::chrono::microseconds{usage.ru_utime.tv_usec + usage.ru_stime.tv_usec};
+#endif
+	}
+
+
+	/** Process-wide timer service.
+
+	    All timers of the process share a single thread which keeps the pending timers in a binary heap ordered by their deadlines and sleeps until the earliest of them expires, so that an idle application with many timers wakes up only when a timer actually expires and starting, or stopping a timer never creates a thread.
+
+	    The handlers are executed on the service thread and must therefore be short. Handlers that need to run in the UI thread should schedule the work in their event queue. A handler returns true if it should be called again after its interval, false to stop the timer.
+
+	    Each scheduled timer is identified by a token which can be used to cancel it. Cancelling a timer whose handler is currently executing waits for the handler to finish (unless cancelled from the handler itself) so that the handler never runs after its timer has been cancelled and may safely refer to the object that owns the timer.
+	 */
+	class TimerService {
+	public:
+
+		/** Identifies a scheduled timer, 0 is never a valid token. 
+		 */
+		using Token = size_t;
+
+		/** Returns the service singleton. 
+		
+		    The singleton is never deleted so that its thread may outlive the static destruction. 
+		 */
+		static TimerService & Instance() {
+			static TimerService * instance = new TimerService{};
+			return *instance;
+		}
+
+		/** Schedules the handler to be called after given delay and then after each interval for as long as the handler returns true. 
+		
+		    Interval of 0 means the handler is called only once. Returns token of the timer. 
+		 */
+		Token schedule(std::chrono::milliseconds delay, std::chrono::milliseconds interval, std::function<bool()> handler) {
+			std::lock_guard<std::mutex> g{m_};
+			if (! started_)
+				startThread();
+			Token token = ++lastToken_;
+			auto deadline = std::chrono::steady_clock::now() + delay;
+			timers_.insert(std::make_pair(token, Entry{deadline, interval, std::move(handler)}));
+			push(deadline, token);
+			return token;
+		}
+
+		/** Cancels the timer. 
+		
+		    If the timer's handler is executing at the moment and the cancel is not called from the handler itself, waits for the handler to finish. Cancelling timer that is no longer active does nothing. 
+		 */
+		void cancel(Token token) {
+			std::unique_lock<std::mutex> g{m_};
+			timers_.erase(token);
+			if (std::this_thread::get_id() != threadId_)
+				handlerDone_.wait(g, [this, token](){ return running_ != token; });
+		}
+
+		/** Returns true if the timer is active, i.e. it has not been cancelled and its handler has not yet stopped it. 
+		 */
+		bool active(Token token) const {
+			std::lock_guard<std::mutex> g{m_};
+			return timers_.find(token) != timers_.end();
+		}
+
+		/** Returns the number of times the service thread has woken up so far. 
+		
+		    Every wakeup costs the CPU leaving its idle state so the rate at which the counter grows while the application is idle should be as close to zero as possible. 
+		 */
+		uint64_t wakeups() const {
+			return wakeups_;
+		}
+
+	private:
+
+		class Entry {
+		public:
+			std::chrono::steady_clock::time_point deadline;
+			std::chrono::milliseconds interval;
+			std::function<bool()> handler;
+		}; // TimerService::Entry
+
+		/** Deadline in the heap. 
+		
+		    Cancelled timers are not removed from the heap, their deadlines are skipped when they expire instead. 
+		 */
+		using Deadline = std::pair<std::chrono::steady_clock::time_point, Token>;
+
+		TimerService() = default;
+
+		void push(std::chrono::steady_clock::time_point deadline, Token token) {
+			bool earliest = heap_.empty() || deadline < heap_.front().first;
+			heap_.push_back(Deadline{deadline, token});
+			std::push_heap(heap_.begin(), heap_.end(), std::greater<Deadline>{});
+			// wake up the thread only if it has to wait for a shorter time than before
+			if (earliest)
+				wakeup_.notify_one();
+		}
+
+		/** Starts the service thread, must be called under the lock. 
+		 */
+		void startThread() {
+			started_ = true;
+			std::thread t{[this](){
+				std::unique_lock<std::mutex> g{m_};
+				while (true) {
+					if (heap_.empty()) {
+						wakeup_.wait(g);
+						++wakeups_;
+						continue;
+					}
+					Deadline next = heap_.front();
+					auto now = std::chrono::steady_clock::now();
+					if (next.first > now) {
+						wakeup_.wait_until(g, next.first);
+						++wakeups_;
+						continue;
+					}
+					std::pop_heap(heap_.begin(), heap_.end(), std::greater<Deadline>{});
+					heap_.pop_back();
+					auto i = timers_.find(next.second);
+					// skip cancelled timers
+					if (i == timers_.end() || i->second.deadline != next.first)
+						continue;
+					std::function<bool()> handler = i->second.handler;
+					running_ = next.second;
+					g.unlock();
+					bool again = handler();
+					g.lock();
+					running_ = 0;
+					handlerDone_.notify_all();
+					// the timer might have been cancelled while its handler was executing
+					i = timers_.find(next.second);
+					if (i == timers_.end())
+						continue;
+					if (! again || i->second.interval.count() == 0) {
+						timers_.erase(i);
+						continue;
+					}
+					// keep the period, unless the handler is late by more than the interval
+					auto deadline = next.first + i->second.interval;
+					now = std::chrono::steady_clock::now();
+					if (deadline < now)
+						deadline = now + i->second.interval;
+					i->second.deadline = deadline;
+					push(deadline, next.second);
+				}
+			}};
+			threadId_ = t.get_id();
+			t.detach();
+		}
+
+		mutable std::mutex m_;
+		std::condition_variable wakeup_;
+		std::condition_variable handlerDone_;
+		bool started_ = false;
+		std::thread::id threadId_;
+		std::vector<Deadline> heap_;
+		std::unordered_map<Token, Entry> timers_;
+		Token lastToken_ = 0;
+		/** Token of the timer whose handler is being executed, 0 if none. */
+		Token running_ = 0;
+		std::atomic<uint64_t> wakeups_{0};
+
+	}; // TimerService
 
 	/** Very simple timer class.
 	 
-	    Executes the given handler with given duration. The handler is a function taking no arguments and returning bool. If the handlers returns true, it will be rescheduled after the specified interval, otherwise the timer will be stopped. 
+	    Executes the given handler with given duration. The handler is a function taking no arguments and returning bool. If the handlers returns true, it will be rescheduled after the specified interval, otherwise the timer will be stopped. The handler is first called immediately when the timer is started.
+
+	    The timer is executed by the TimerService. 
 	 */
 	class Timer {
 	public:
-		Timer():
-		    data_{new Data()} {
-			data_->attach();
-		}
+		Timer() = default;
 
 		~Timer() {
 			stop();
-			data_->detach();
 		}
 
 		bool running() const {
-			std::lock_guard<std::mutex> g(data_->m);
-			return data_->running;
+			std::lock_guard<std::mutex> g(m_);
+			return token_ != 0 && TimerService::Instance().active(token_);
 		}
 
 		size_t interval() const {
-			std::lock_guard<std::mutex> g(data_->m);
-			return data_->interval;
+			std::lock_guard<std::mutex> g(m_);
+			return interval_;
 		}
 
+		/** Sets the interval in milliseconds. 
+		
+		    If the timer is running, the new interval takes effect when the timer is started again. 
+		 */
 		void setInterval(size_t ms) {
-			std::lock_guard<std::mutex> g(data_->m);
-			data_->interval = ms;
+			std::lock_guard<std::mutex> g(m_);
+			interval_ = ms;
 		}
 
 		void setHandler(std::function<bool()> handler) {
-			std::lock_guard<std::mutex> g(data_->m);
-			data_->handler = handler;
+			std::lock_guard<std::mutex> g(m_);
+			handler_ = handler;
 		}
 
 		/** Starts the timer. 
-		 
-		    If the timer is already running, terminates the old thread first. This is perhaps not completely efficient, but saves us a lot of concurrency worries. 
+		
+		    If the timer is already running, it is restarted. 
 		 */
 		void start() {
-			std::lock_guard<std::mutex> g(data_->m);
-			if (data_->running)
-			    data_->threadId = data_->threadId + 1;
-			size_t tid = data_->threadId;
-			data_->attach();
-			Data * data = data_;
-			std::thread t{[data, tid](){
-				size_t interval = 0;
+			stop();
+			std::lock_guard<std::mutex> g(m_);
+			// the interval must not be 0 as the service would call the handler only once
+			token_ = TimerService::Instance().schedule(std::chrono::milliseconds{0}, std::chrono::milliseconds{std::max<size_t>(interval_, 1)}, [this](){
 				std::function<bool()> handler;
-				while (true) {
-					{
-						std::lock_guard<std::mutex> g(data->m);
-						// we have been stopped, exit the thread
-						if (data->threadId != tid)
-						    return;
-						interval = data->interval;
-						handler = data->handler;
-					}
-					// if the handler indicates termination, terminate the thread
-					if (! handler()) {
-						std::lock_guard<std::mutex> g(data->m);
-						// indicate we have stopped and exit the thread
-						if (data->threadId == tid)
-						    data->running = false;
-						return;
-					}
-					// otherwise sleep for the requested period
-					std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+				{
+					std::lock_guard<std::mutex> g(m_);
+					handler = handler_;
 				}
-				data->detach();
-			}};
-			t.detach();
-			data_->running = true;
+				return handler();
+			});
 		}
 
 		/** Stops the timer. 
+		
+		    When the method returns, the handler is guaranteed not to be executing, unless stop is called from the handler itself. 
 		 */
 		void stop() {
-			std::lock_guard<std::mutex> g(data_->m);
-			if (data_->running)
-			    data_->threadId = data_->threadId + 1;
+			TimerService::Token token;
+			{
+				std::lock_guard<std::mutex> g(m_);
+				token = token_;
+				token_ = 0;
+			}
+			// cancel without holding the lock as the handler may be waiting for it
+			if (token != 0)
+				TimerService::Instance().cancel(token);
 		}
 
 	private:
 
-		/** Internal data of the timer. 
-		 
-		    The data is allocated on heap and is reference counted, which is a simple way to make sure that if the timer is deleted we do not have to wait for the timer thread to terminate as well (this could be painful if the interval is large). 
-		 */
-	    class Data {
-		public:
-		    std::mutex m;
-		    volatile size_t threadId;
-			volatile size_t interval;
-			bool running;
-    	    std::function<bool()> handler;
-
-			Data():
-			    threadId{0},
-				interval{1000},
-				running{false},
-				ptrCount_{0} {
-			}
-
-			void attach() {
-				++ptrCount_;
-			}
-
-			void detach() {
-				m.lock();
-				--ptrCount_;
-				if (--ptrCount_ == 0) {
-					m.unlock();
-				    delete this;
-				} else {
-				    m.unlock();
-				}
-			}
-		private:
-			size_t ptrCount_;
-
-		};
-
-		Data * data_;
+		mutable std::mutex m_;
+		size_t interval_ = 1000;
+		std::function<bool()> handler_;
+		TimerService::Token token_ = 0;
 
 	}; 
 
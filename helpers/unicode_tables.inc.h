@@ -0,0 +1,387 @@
+/* AUTOGENERATED FILE, DO NOT EDIT! 
+   This file was produced by the following command:
+   unicodeTablesCpp helpers/unicode_tables.inc.h UnicodeData.txt EastAsianWidth.txt CompositionExclusions.txt
+
+   Unicode version 14.0.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+HELPERS_NAMESPACE_BEGIN
+
+    class UnicodeTables {
+    public:
+        static constexpr char const * Version = "14.0.0";
+
+        // index of the width block for each 256 codepoints
+        static constexpr uint8_t WidthIndex[4352] = {
+            0,0,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,0,16,0,0,0,17,18,19,20,21,22,23,0,0,
+            24,0,0,25,0,26,27,28,0,0,0,29,30,31,32,33,34,35,36,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,38,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,39,0,40,0,41,42,43,44,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,45,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,37,46,0,0,47,48,
+            0,49,50,51,0,0,0,0,0,0,52,0,0,53,54,55,56,57,58,59,60,61,62,63,64,65,66,0,67,68,69,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,71,72,0,0,0,73,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,74,37,37,37,37,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,37,78,79,0,0,0,0,0,0,0,0,0,80,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,82,83,0,0,0,0,0,0,0,84,0,0,0,0,0,
+            85,72,86,0,0,0,0,0,87,88,0,0,0,0,0,0,89,90,91,92,93,94,95,96,0,97,98,0,0,0,0,0,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,99,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+            37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,99,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            100,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        };
+
+        // widths of the codepoints in each block, 2 bits per codepoint
+        static constexpr uint8_t WidthBlocks[102][64] = {
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x41,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x0,0x0,0x40,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x0,0x0,0x0,0x0,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x14,0x0,0x14,0x4,0x50,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x0,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x0,0x55,0x55,0x51,},
+            {0x55,0x55,0x55,0x55,0x55,0x5,0x10,0x0,0x0,0x1,0x1,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,},
+            {0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x54,0x1,0x0,0x54,0x51,0x1,0x0,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x1,0x54,0x55,0x51,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x45,},
+            {0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x41,0x15,0x14,0x50,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x51,0x55,0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x1,0x10,0x54,0x51,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x5,0x0,},
+            {0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x1,0x54,0x55,0x51,0x55,0x41,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x54,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x4,0x54,0x5,0x4,0x50,0x55,0x41,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x55,0x45,0x55,0x50,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x1,0x54,0x55,0x51,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x5,0x44,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x0,0x40,0x55,0x55,0x15,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x0,0x0,0x54,0x55,0x55,0x0,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x11,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x0,0x0,0x40,0x0,0x4,0x55,0x1,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x4,0x0,0x41,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x5,0x54,0x55,0x55,0x55,0x1,0x54,0x55,0x55,0x45,0x41,0x55,0x51,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x5,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x10,0x0,0x50,0x55,0x45,0x1,0x0,0x0,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x15,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x15,0x54,0x55,0x45,0x55,0x1,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x15,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x0,0x40,0x44,0x1,0x0,0x54,0x15,0x0,0x0,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x4,0x40,0x54,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x0,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x50,0x10,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x50,0x11,0x50,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x0,0x0,0x0,0x4,0x0,0x54,0x51,0x55,0x54,0x50,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,},
+            {0x55,0x55,0x15,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x4,0x0,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0xa5,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xa9,0x56,0x96,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x69,},
+            {0x55,0x55,0x55,0x55,0x55,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x59,0x55,0xa5,0x55,0x55,0x55,0x55,0x69,0x55,0x5a,0x55,0x65,0x55,0x56,0x55,0x55,0x55,0x55,0x65,0x55,0xa5,0x59,0x65,0x59,},
+            {0x55,0x59,0xa5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x95,0x9a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xa9,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x95,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x95,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x59,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa,0xa0,0xaa,0xaa,0xaa,0x6a,0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x81,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,},
+            {0x55,0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x0,0x0,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,},
+            {0x45,0x45,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x50,0x55,0x55,0x15,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x50,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x0,0x50,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x5,0x50,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x40,0x41,0x41,0x55,0x55,0x15,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x4,0x14,0x54,0x5,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x45,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x54,0x51,0x55,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x0,0x0,0x0,0xaa,0xaa,0x5a,0x55,0x0,0x0,0x0,0x0,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,},
+            {0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x6a,0x55,0x55,0x55,0x55,0x1,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x1,0x41,0x55,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x0,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x54,0x55,0x15,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x41,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x1,0x0,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x40,0x55,0x55,0x1,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x4,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x15,0x0,0x40,0x55,0x55,0x55,0x55,0x55,},
+            {0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x54,0x0,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x5,0x44,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x44,0x15,0x4,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x50,0x55,0x10,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x40,0x11,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x51,0x0,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x5,0x10,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x0,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x44,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x5,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x1,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x0,0x14,0x40,0x55,0x15,0x55,0x55,0x1,0x40,0x1,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x0,0x40,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x40,0x0,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x4,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x1,0x40,0x45,0x10,0x0,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x11,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x54,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x54,0x55,0x55,0x5a,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0xaa,0xaa,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xa9,0xaa,0x69,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x6a,0x55,0x55,0x55,0x55,0xaa,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0x0,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x55,0x15,0x0,0x0,0x0,0x40,0x1,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x5,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,0x55,0x51,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x15,0x0,0x1,0x0,0x0,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x40,0x0,0x0,0x0,0x0,0x14,0x0,0x10,0x4,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x65,0xa9,0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x6a,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0xaa,0xaa,0x56,0x55,0x5a,0x55,0x55,0x55,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0xa9,0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa6,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x95,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0x56,0x56,0xaa,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xa6,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x96,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x55,0x95,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,0xaa,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x56,0x6a,0xa9,0x55,0xa9,0x55,0x55,0x95,0x56,0x55,0xaa,0xaa,0x56,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0x55,0x56,0x55,0x55,0x55,},
+            {0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,},
+            {0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x56,0xaa,0x56,0xaa,0x6a,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0xaa,0xaa,0x6a,0x55,0xaa,0x5a,0x55,0x55,0xaa,0xaa,0x5a,0x55,0xaa,0xaa,0x55,0x55,0xaa,0x6a,0x55,0x55,},
+            {0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,},
+            {0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,},
+            {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x55,0x55,0x55,},
+        };
+
+        // canonical compositions as (base << 42) | (mark << 21) | composed, sorted
+        static constexpr uint64_t Compositions[941] = {
+            0xf0006700226e,0xf40067002260,0xf8006700226f,0x10400600000c0,0x10400602000c1,0x10400604000c2,0x10400606000c3,0x1040060800100,
+            0x1040060c00102,0x1040060e00226,0x10400610000c4,0x1040061201ea2,0x10400614000c5,0x10400618001cd,0x1040061e00200,0x1040062200202,
+            0x1040064601ea0,0x1040064a01e00,0x1040065000104,0x1080060e01e02,0x1080064601e04,0x1080066201e06,0x10c0060200106,0x10c0060400108,
+            0x10c0060e0010a,0x10c006180010c,0x10c0064e000c7,0x1100060e01e0a,0x110006180010e,0x1100064601e0c,0x1100064e01e10,0x1100065a01e12,
+            0x1100066201e0e,0x11400600000c8,0x11400602000c9,0x11400604000ca,0x1140060601ebc,0x1140060800112,0x1140060c00114,0x1140060e00116,
+            0x11400610000cb,0x1140061201eba,0x114006180011a,0x1140061e00204,0x1140062200206,0x1140064601eb8,0x1140064e00228,0x1140065000118,
+            0x1140065a01e18,0x1140066001e1a,0x1180060e01e1e,0x11c00602001f4,0x11c006040011c,0x11c0060801e20,0x11c0060c0011e,0x11c0060e00120,
+            0x11c00618001e6,0x11c0064e00122,0x1200060400124,0x1200060e01e22,0x1200061001e26,0x120006180021e,0x1200064601e24,0x1200064e01e28,
+            0x1200065c01e2a,0x12400600000cc,0x12400602000cd,0x12400604000ce,0x1240060600128,0x124006080012a,0x1240060c0012c,0x1240060e00130,
+            0x12400610000cf,0x1240061201ec8,0x12400618001cf,0x1240061e00208,0x124006220020a,0x1240064601eca,0x124006500012e,0x1240066001e2c,
+            0x1280060400134,0x12c0060201e30,0x12c00618001e8,0x12c0064601e32,0x12c0064e00136,0x12c0066201e34,0x1300060200139,0x130006180013d,
+            0x1300064601e36,0x1300064e0013b,0x1300065a01e3c,0x1300066201e3a,0x1340060201e3e,0x1340060e01e40,0x1340064601e42,0x13800600001f8,
+            0x1380060200143,0x13800606000d1,0x1380060e01e44,0x1380061800147,0x1380064601e46,0x1380064e00145,0x1380065a01e4a,0x1380066201e48,
+            0x13c00600000d2,0x13c00602000d3,0x13c00604000d4,0x13c00606000d5,0x13c006080014c,0x13c0060c0014e,0x13c0060e0022e,0x13c00610000d6,
+            0x13c0061201ece,0x13c0061600150,0x13c00618001d1,0x13c0061e0020c,0x13c006220020e,0x13c00636001a0,0x13c0064601ecc,0x13c00650001ea,
+            0x1400060201e54,0x1400060e01e56,0x1480060200154,0x1480060e01e58,0x1480061800158,0x1480061e00210,0x1480062200212,0x1480064601e5a,
+            0x1480064e00156,0x1480066201e5e,0x14c006020015a,0x14c006040015c,0x14c0060e01e60,0x14c0061800160,0x14c0064601e62,0x14c0064c00218,
+            0x14c0064e0015e,0x1500060e01e6a,0x1500061800164,0x1500064601e6c,0x1500064c0021a,0x1500064e00162,0x1500065a01e70,0x1500066201e6e,
+            0x15400600000d9,0x15400602000da,0x15400604000db,0x1540060600168,0x154006080016a,0x1540060c0016c,0x15400610000dc,0x1540061201ee6,
+            0x154006140016e,0x1540061600170,0x15400618001d3,0x1540061e00214,0x1540062200216,0x15400636001af,0x1540064601ee4,0x1540064801e72,
+            0x1540065000172,0x1540065a01e76,0x1540066001e74,0x1580060601e7c,0x1580064601e7e,0x15c0060001e80,0x15c0060201e82,0x15c0060400174,
+            0x15c0060e01e86,0x15c0061001e84,0x15c0064601e88,0x1600060e01e8a,0x1600061001e8c,0x1640060001ef2,0x16400602000dd,0x1640060400176,
+            0x1640060601ef8,0x1640060800232,0x1640060e01e8e,0x1640061000178,0x1640061201ef6,0x1640064601ef4,0x1680060200179,0x1680060401e90,
+            0x1680060e0017b,0x168006180017d,0x1680064601e92,0x1680066201e94,0x18400600000e0,0x18400602000e1,0x18400604000e2,0x18400606000e3,
+            0x1840060800101,0x1840060c00103,0x1840060e00227,0x18400610000e4,0x1840061201ea3,0x18400614000e5,0x18400618001ce,0x1840061e00201,
+            0x1840062200203,0x1840064601ea1,0x1840064a01e01,0x1840065000105,0x1880060e01e03,0x1880064601e05,0x1880066201e07,0x18c0060200107,
+            0x18c0060400109,0x18c0060e0010b,0x18c006180010d,0x18c0064e000e7,0x1900060e01e0b,0x190006180010f,0x1900064601e0d,0x1900064e01e11,
+            0x1900065a01e13,0x1900066201e0f,0x19400600000e8,0x19400602000e9,0x19400604000ea,0x1940060601ebd,0x1940060800113,0x1940060c00115,
+            0x1940060e00117,0x19400610000eb,0x1940061201ebb,0x194006180011b,0x1940061e00205,0x1940062200207,0x1940064601eb9,0x1940064e00229,
+            0x1940065000119,0x1940065a01e19,0x1940066001e1b,0x1980060e01e1f,0x19c00602001f5,0x19c006040011d,0x19c0060801e21,0x19c0060c0011f,
+            0x19c0060e00121,0x19c00618001e7,0x19c0064e00123,0x1a00060400125,0x1a00060e01e23,0x1a00061001e27,0x1a0006180021f,0x1a00064601e25,
+            0x1a00064e01e29,0x1a00065c01e2b,0x1a00066201e96,0x1a400600000ec,0x1a400602000ed,0x1a400604000ee,0x1a40060600129,0x1a4006080012b,
+            0x1a40060c0012d,0x1a400610000ef,0x1a40061201ec9,0x1a400618001d0,0x1a40061e00209,0x1a4006220020b,0x1a40064601ecb,0x1a4006500012f,
+            0x1a40066001e2d,0x1a80060400135,0x1a800618001f0,0x1ac0060201e31,0x1ac00618001e9,0x1ac0064601e33,0x1ac0064e00137,0x1ac0066201e35,
+            0x1b0006020013a,0x1b0006180013e,0x1b00064601e37,0x1b00064e0013c,0x1b00065a01e3d,0x1b00066201e3b,0x1b40060201e3f,0x1b40060e01e41,
+            0x1b40064601e43,0x1b800600001f9,0x1b80060200144,0x1b800606000f1,0x1b80060e01e45,0x1b80061800148,0x1b80064601e47,0x1b80064e00146,
+            0x1b80065a01e4b,0x1b80066201e49,0x1bc00600000f2,0x1bc00602000f3,0x1bc00604000f4,0x1bc00606000f5,0x1bc006080014d,0x1bc0060c0014f,
+            0x1bc0060e0022f,0x1bc00610000f6,0x1bc0061201ecf,0x1bc0061600151,0x1bc00618001d2,0x1bc0061e0020d,0x1bc006220020f,0x1bc00636001a1,
+            0x1bc0064601ecd,0x1bc00650001eb,0x1c00060201e55,0x1c00060e01e57,0x1c80060200155,0x1c80060e01e59,0x1c80061800159,0x1c80061e00211,
+            0x1c80062200213,0x1c80064601e5b,0x1c80064e00157,0x1c80066201e5f,0x1cc006020015b,0x1cc006040015d,0x1cc0060e01e61,0x1cc0061800161,
+            0x1cc0064601e63,0x1cc0064c00219,0x1cc0064e0015f,0x1d00060e01e6b,0x1d00061001e97,0x1d00061800165,0x1d00064601e6d,0x1d00064c0021b,
+            0x1d00064e00163,0x1d00065a01e71,0x1d00066201e6f,0x1d400600000f9,0x1d400602000fa,0x1d400604000fb,0x1d40060600169,0x1d4006080016b,
+            0x1d40060c0016d,0x1d400610000fc,0x1d40061201ee7,0x1d4006140016f,0x1d40061600171,0x1d400618001d4,0x1d40061e00215,0x1d40062200217,
+            0x1d400636001b0,0x1d40064601ee5,0x1d40064801e73,0x1d40065000173,0x1d40065a01e77,0x1d40066001e75,0x1d80060601e7d,0x1d80064601e7f,
+            0x1dc0060001e81,0x1dc0060201e83,0x1dc0060400175,0x1dc0060e01e87,0x1dc0061001e85,0x1dc0061401e98,0x1dc0064601e89,0x1e00060e01e8b,
+            0x1e00061001e8d,0x1e40060001ef3,0x1e400602000fd,0x1e40060400177,0x1e40060601ef9,0x1e40060800233,0x1e40060e01e8f,0x1e400610000ff,
+            0x1e40061201ef7,0x1e40061401e99,0x1e40064601ef5,0x1e8006020017a,0x1e80060401e91,0x1e80060e0017c,0x1e8006180017e,0x1e80064601e93,
+            0x1e80066201e95,0x2a00060001fed,0x2a00060200385,0x2a00068401fc1,0x3080060001ea6,0x3080060201ea4,0x3080060601eaa,0x3080061201ea8,
+            0x31000608001de,0x31400602001fa,0x31800602001fc,0x31800608001e2,0x31c0060201e08,0x3280060001ec0,0x3280060201ebe,0x3280060601ec4,
+            0x3280061201ec2,0x33c0060201e2e,0x3500060001ed2,0x3500060201ed0,0x3500060601ed6,0x3500061201ed4,0x3540060201e4c,0x354006080022c,
+            0x3540061001e4e,0x358006080022a,0x36000602001fe,0x37000600001db,0x37000602001d7,0x37000608001d5,0x37000618001d9,0x3880060001ea7,
+            0x3880060201ea5,0x3880060601eab,0x3880061201ea9,0x39000608001df,0x39400602001fb,0x39800602001fd,0x39800608001e3,0x39c0060201e09,
+            0x3a80060001ec1,0x3a80060201ebf,0x3a80060601ec5,0x3a80061201ec3,0x3bc0060201e2f,0x3d00060001ed3,0x3d00060201ed1,0x3d00060601ed7,
+            0x3d00061201ed5,0x3d40060201e4d,0x3d4006080022d,0x3d40061001e4f,0x3d8006080022b,0x3e000602001ff,0x3f000600001dc,0x3f000602001d8,
+            0x3f000608001d6,0x3f000618001da,0x4080060001eb0,0x4080060201eae,0x4080060601eb4,0x4080061201eb2,0x40c0060001eb1,0x40c0060201eaf,
+            0x40c0060601eb5,0x40c0061201eb3,0x4480060001e14,0x4480060201e16,0x44c0060001e15,0x44c0060201e17,0x5300060001e50,0x5300060201e52,
+            0x5340060001e51,0x5340060201e53,0x5680060e01e64,0x56c0060e01e65,0x5800060e01e66,0x5840060e01e67,0x5a00060201e78,0x5a40060201e79,
+            0x5a80061001e7a,0x5ac0061001e7b,0x5fc0060e01e9b,0x6800060001edc,0x6800060201eda,0x6800060601ee0,0x6800061201ede,0x6800064601ee2,
+            0x6840060001edd,0x6840060201edb,0x6840060601ee1,0x6840061201edf,0x6840064601ee3,0x6bc0060001eea,0x6bc0060201ee8,0x6bc0060601eee,
+            0x6bc0061201eec,0x6bc0064601ef0,0x6c00060001eeb,0x6c00060201ee9,0x6c00060601eef,0x6c00061201eed,0x6c00064601ef1,0x6dc00618001ee,
+            0x7a800608001ec,0x7ac00608001ed,0x89800608001e0,0x89c00608001e1,0x8a00060c01e1c,0x8a40060c01e1d,0x8b80060800230,0x8bc0060800231,
+            0xa4800618001ef,0xe440060001fba,0xe440060200386,0xe440060801fb9,0xe440060c01fb8,0xe440062601f08,0xe440062801f09,0xe440068a01fbc,
+            0xe540060001fc8,0xe540060200388,0xe540062601f18,0xe540062801f19,0xe5c0060001fca,0xe5c0060200389,0xe5c0062601f28,0xe5c0062801f29,
+            0xe5c0068a01fcc,0xe640060001fda,0xe64006020038a,0xe640060801fd9,0xe640060c01fd8,0xe6400610003aa,0xe640062601f38,0xe640062801f39,
+            0xe7c0060001ff8,0xe7c006020038c,0xe7c0062601f48,0xe7c0062801f49,0xe840062801fec,0xe940060001fea,0xe94006020038e,0xe940060801fe9,
+            0xe940060c01fe8,0xe9400610003ab,0xe940062801f59,0xea40060001ffa,0xea4006020038f,0xea40062601f68,0xea40062801f69,0xea40068a01ffc,
+            0xeb00068a01fb4,0xeb80068a01fc4,0xec40060001f70,0xec400602003ac,0xec40060801fb1,0xec40060c01fb0,0xec40062601f00,0xec40062801f01,
+            0xec40068401fb6,0xec40068a01fb3,0xed40060001f72,0xed400602003ad,0xed40062601f10,0xed40062801f11,0xedc0060001f74,0xedc00602003ae,
+            0xedc0062601f20,0xedc0062801f21,0xedc0068401fc6,0xedc0068a01fc3,0xee40060001f76,0xee400602003af,0xee40060801fd1,0xee40060c01fd0,
+            0xee400610003ca,0xee40062601f30,0xee40062801f31,0xee40068401fd6,0xefc0060001f78,0xefc00602003cc,0xefc0062601f40,0xefc0062801f41,
+            0xf040062601fe4,0xf040062801fe5,0xf140060001f7a,0xf1400602003cd,0xf140060801fe1,0xf140060c01fe0,0xf1400610003cb,0xf140062601f50,
+            0xf140062801f51,0xf140068401fe6,0xf240060001f7c,0xf2400602003ce,0xf240062601f60,0xf240062801f61,0xf240068401ff6,0xf240068a01ff3,
+            0xf280060001fd2,0xf280060200390,0xf280068401fd7,0xf2c0060001fe2,0xf2c00602003b0,0xf2c0068401fe7,0xf380068a01ff4,0xf4800602003d3,
+            0xf4800610003d4,0x10180061000407,0x10400060c004d0,0x104000610004d2,0x104c0060200403,0x10540060000400,0x10540060c004d6,0x10540061000401,
+            0x10580060c004c1,0x105800610004dc,0x105c00610004de,0x1060006000040d,0x106000608004e2,0x10600060c00419,0x106000610004e4,0x1068006020040c,
+            0x107800610004e6,0x108c00608004ee,0x108c0060c0040e,0x108c00610004f0,0x108c00616004f2,0x109c00610004f4,0x10ac00610004f8,0x10b400610004ec,
+            0x10c00060c004d1,0x10c000610004d3,0x10cc0060200453,0x10d40060000450,0x10d40060c004d7,0x10d40061000451,0x10d80060c004c2,0x10d800610004dd,
+            0x10dc00610004df,0x10e0006000045d,0x10e000608004e3,0x10e00060c00439,0x10e000610004e5,0x10e8006020045c,0x10f800610004e7,0x110c00608004ef,
+            0x110c0060c0045e,0x110c00610004f1,0x110c00616004f3,0x111c00610004f5,0x112c00610004f9,0x113400610004ed,0x11580061000457,0x11d00061e00476,
+            0x11d40061e00477,0x136000610004da,0x136400610004db,0x13a000610004ea,0x13a400610004eb,0x189c00ca600622,0x189c00ca800623,0x189c00caa00625,
+            0x192000ca800624,0x192800ca800626,0x1b0400ca8006c2,0x1b4800ca8006d3,0x1b5400ca8006c0,0x24a00127800929,0x24c00127800931,0x24cc0127800934,
+            0x271c0137c009cb,0x271c013ae009cc,0x2d1c0167c00b4b,0x2d1c016ac00b48,0x2d1c016ae00b4c,0x2e48017ae00b94,0x2f180177c00bca,0x2f18017ae00bcc,
+            0x2f1c0177c00bcb,0x3118018ac00c48,0x32fc019aa00cc0,0x33180198400cca,0x3318019aa00cc7,0x3318019ac00cc8,0x3328019aa00ccb,0x351801a7c00d4a,
+            0x351801aae00d4c,0x351c01a7c00d4b,0x376401b9400dda,0x376401b9e00ddc,0x376401bbe00dde,0x377001b9400ddd,0x40940205c01026,0x6c140366a01b06,
+            0x6c1c0366a01b08,0x6c240366a01b0a,0x6c2c0366a01b0c,0x6c340366a01b0e,0x6c440366a01b12,0x6ce80366a01b3b,0x6cf00366a01b3d,0x6cf80366a01b40,
+            0x6cfc0366a01b41,0x6d080366a01b43,0x78d80060801e38,0x78dc0060801e39,0x79680060801e5c,0x796c0060801e5d,0x79880060e01e68,0x798c0060e01e69,
+            0x7a800060401eac,0x7a800060c01eb6,0x7a840060401ead,0x7a840060c01eb7,0x7ae00060401ec6,0x7ae40060401ec7,0x7b300060401ed8,0x7b340060401ed9,
+            0x7c000060001f02,0x7c000060201f04,0x7c000068401f06,0x7c000068a01f80,0x7c040060001f03,0x7c040060201f05,0x7c040068401f07,0x7c040068a01f81,
+            0x7c080068a01f82,0x7c0c0068a01f83,0x7c100068a01f84,0x7c140068a01f85,0x7c180068a01f86,0x7c1c0068a01f87,0x7c200060001f0a,0x7c200060201f0c,
+            0x7c200068401f0e,0x7c200068a01f88,0x7c240060001f0b,0x7c240060201f0d,0x7c240068401f0f,0x7c240068a01f89,0x7c280068a01f8a,0x7c2c0068a01f8b,
+            0x7c300068a01f8c,0x7c340068a01f8d,0x7c380068a01f8e,0x7c3c0068a01f8f,0x7c400060001f12,0x7c400060201f14,0x7c440060001f13,0x7c440060201f15,
+            0x7c600060001f1a,0x7c600060201f1c,0x7c640060001f1b,0x7c640060201f1d,0x7c800060001f22,0x7c800060201f24,0x7c800068401f26,0x7c800068a01f90,
+            0x7c840060001f23,0x7c840060201f25,0x7c840068401f27,0x7c840068a01f91,0x7c880068a01f92,0x7c8c0068a01f93,0x7c900068a01f94,0x7c940068a01f95,
+            0x7c980068a01f96,0x7c9c0068a01f97,0x7ca00060001f2a,0x7ca00060201f2c,0x7ca00068401f2e,0x7ca00068a01f98,0x7ca40060001f2b,0x7ca40060201f2d,
+            0x7ca40068401f2f,0x7ca40068a01f99,0x7ca80068a01f9a,0x7cac0068a01f9b,0x7cb00068a01f9c,0x7cb40068a01f9d,0x7cb80068a01f9e,0x7cbc0068a01f9f,
+            0x7cc00060001f32,0x7cc00060201f34,0x7cc00068401f36,0x7cc40060001f33,0x7cc40060201f35,0x7cc40068401f37,0x7ce00060001f3a,0x7ce00060201f3c,
+            0x7ce00068401f3e,0x7ce40060001f3b,0x7ce40060201f3d,0x7ce40068401f3f,0x7d000060001f42,0x7d000060201f44,0x7d040060001f43,0x7d040060201f45,
+            0x7d200060001f4a,0x7d200060201f4c,0x7d240060001f4b,0x7d240060201f4d,0x7d400060001f52,0x7d400060201f54,0x7d400068401f56,0x7d440060001f53,
+            0x7d440060201f55,0x7d440068401f57,0x7d640060001f5b,0x7d640060201f5d,0x7d640068401f5f,0x7d800060001f62,0x7d800060201f64,0x7d800068401f66,
+            0x7d800068a01fa0,0x7d840060001f63,0x7d840060201f65,0x7d840068401f67,0x7d840068a01fa1,0x7d880068a01fa2,0x7d8c0068a01fa3,0x7d900068a01fa4,
+            0x7d940068a01fa5,0x7d980068a01fa6,0x7d9c0068a01fa7,0x7da00060001f6a,0x7da00060201f6c,0x7da00068401f6e,0x7da00068a01fa8,0x7da40060001f6b,
+            0x7da40060201f6d,0x7da40068401f6f,0x7da40068a01fa9,0x7da80068a01faa,0x7dac0068a01fab,0x7db00068a01fac,0x7db40068a01fad,0x7db80068a01fae,
+            0x7dbc0068a01faf,0x7dc00068a01fb2,0x7dd00068a01fc2,0x7df00068a01ff2,0x7ed80068a01fb7,0x7efc0060001fcd,0x7efc0060201fce,0x7efc0068401fcf,
+            0x7f180068a01fc7,0x7fd80068a01ff7,0x7ff80060001fdd,0x7ff80060201fde,0x7ff80068401fdf,0x8640006700219a,0x8648006700219b,0x865000670021ae,
+            0x874000670021cd,0x874800670021cf,0x875000670021ce,0x880c0067002204,0x88200067002209,0x882c006700220c,0x888c0067002224,0x88940067002226,
+            0x88f00067002241,0x890c0067002244,0x89140067002247,0x89200067002249,0x8934006700226d,0x89840067002262,0x89900067002270,0x89940067002271,
+            0x89c80067002274,0x89cc0067002275,0x89d80067002278,0x89dc0067002279,0x89e80067002280,0x89ec0067002281,0x89f000670022e0,0x89f400670022e1,
+            0x8a080067002284,0x8a0c0067002285,0x8a180067002288,0x8a1c0067002289,0x8a4400670022e2,0x8a4800670022e3,0x8a8800670022ac,0x8aa000670022ad,
+            0x8aa400670022ae,0x8aac00670022af,0x8ac800670022ea,0x8acc00670022eb,0x8ad000670022ec,0x8ad400670022ed,0xc1180613203094,0xc12c061320304c,
+            0xc134061320304e,0xc13c0613203050,0xc1440613203052,0xc14c0613203054,0xc1540613203056,0xc15c0613203058,0xc164061320305a,0xc16c061320305c,
+            0xc174061320305e,0xc17c0613203060,0xc1840613203062,0xc1900613203065,0xc1980613203067,0xc1a00613203069,0xc1bc0613203070,0xc1bc0613403071,
+            0xc1c80613203073,0xc1c80613403074,0xc1d40613203076,0xc1d40613403077,0xc1e00613203079,0xc1e0061340307a,0xc1ec061320307c,0xc1ec061340307d,
+            0xc274061320309e,0xc29806132030f4,0xc2ac06132030ac,0xc2b406132030ae,0xc2bc06132030b0,0xc2c406132030b2,0xc2cc06132030b4,0xc2d406132030b6,
+            0xc2dc06132030b8,0xc2e406132030ba,0xc2ec06132030bc,0xc2f406132030be,0xc2fc06132030c0,0xc30406132030c2,0xc31006132030c5,0xc31806132030c7,
+            0xc32006132030c9,0xc33c06132030d0,0xc33c06134030d1,0xc34806132030d3,0xc34806134030d4,0xc35406132030d6,0xc35406134030d7,0xc36006132030d9,
+            0xc36006134030da,0xc36c06132030dc,0xc36c06134030dd,0xc3bc06132030f7,0xc3c006132030f8,0xc3c406132030f9,0xc3c806132030fa,0xc3f406132030fe,
+            0x44264221741109a,0x4426c221741109c,0x4429422174110ab,0x444c42224e1112e,0x444c82224e1112f,0x44d1c2267c1134b,0x44d1c226ae1134c,0x452e422960114bc,
+            0x452e422974114bb,0x452e42297a114be,0x456e022b5e115ba,0x456e422b5e115bb,0x464d42326011938,
+        };
+    }; // UnicodeTables
+
+HELPERS_NAMESPACE_END
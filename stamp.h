@@ -0,0 +1,17 @@
+/* AUTOGENERATED FILE, DO NOT EDIT! 
+   This file was produced by the following command:
+  /root/repo/_gate_none/stamp-generator /root/repo/stamp.h
+ */
+#pragma once
+#include<string_view>
+namespace stamp {
+    std::string_view constexpr version               = "0.8.4";
+    std::string_view constexpr arch                  = "Linux";
+    std::string_view constexpr arch_size             = "64";
+    std::string_view constexpr arch_compiler         = "GNU";
+    std::string_view constexpr arch_compiler_version = "12.2.0";
+    std::string_view constexpr build                 = "debug";
+    std::string_view constexpr build_time            = "2026-10-18T14:35:10Z";
+    std::string_view constexpr commit                = "2d8dc20042d9c4b247549cc1db44a9eb941c4a55";
+    bool             constexpr dirty                 = true;
+} // namespace stamp
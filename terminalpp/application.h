@@ -3,6 +3,7 @@
 #include "helpers/helpers.h"
 #include "helpers/json.h"
 #include "helpers/curl.h"
+#include "helpers/process.h"
 
 #include "stamp.h"
 
@@ -70,6 +71,33 @@ namespace tpp {
          */
         virtual void mainLoop() = 0;
 
+        /** \name Single Process Mode
+
+            In single process mode the first instance of the terminal listens for requests from later launches to open new windows, so that all windows share the same process, settings, fonts and glyph caches. Later launches only ask the running instance to open a window and exit immediately. 
+
+            Single process mode is optional and the default implementation does not support it. 
+         */
+        //@{
+
+        /** Starts listening for requests to open new windows, which are opened by calling the provided function in the main thread. 
+
+            The function is given the working directory and the environment of the process which requested the window, so that the new window's session starts where it would start if the process opened the window itself. 
+         */
+        virtual void serveWindowRequests(std::function<void(std::string const & workingDirectory, Environment const & env)> openWindow) {
+            MARK_AS_UNUSED(openWindow);
+        }
+
+        //@}
+
+        /** Starts watching the given settings file, calling the provided function in the main thread whenever the file has been saved. 
+
+            Watching the settings is optional and the default implementation does nothing, in which case the settings changes only take effect after restart. 
+         */
+        virtual void watchSettings(std::string const & filename, std::function<void()> onChange) {
+            MARK_AS_UNUSED(filename);
+            MARK_AS_UNUSED(onChange);
+        }
+
         /** Determines the latest versions available for specified channels. 
          
             Downloads the `https://terminalpp.com/versions.json` file which contains a list of latest versions available in various channels.
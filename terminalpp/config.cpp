@@ -1,6 +1,11 @@
 #include <fstream>
 
+#if (defined ARCH_UNIX && defined RENDERER_NATIVE)
+#include <fontconfig/fontconfig.h>
+#endif
+
 #include "helpers/filesystem.h"
+#include "helpers/startup_trace.h"
 
 #include "application.h"
 #include "config.h"
@@ -8,8 +13,6 @@
 namespace tpp {
 
     Config & Config::Setup(int argc, char * argv[]) {
-        MARK_AS_UNUSED(argc);
-        MARK_AS_UNUSED(argv);
         Config & config = Instance();
         bool saveSettings = false;
         bool backupSettings = false;
@@ -22,7 +25,10 @@ namespace tpp {
             if (f.good()) {
 				try {
 					try {
-						JSON settings{JSON::Parse(f)};
+						JSON settings = [&f]() {
+							StartupTrace::Phase phase{"JSON parse"};
+							return JSON::Parse(f);
+						}();
 						VerifyConfigurationVersion(settings);
 						// specify, check errors, make copy if wrong
 						saveSettings = config.update(settings, [& saveSettings, & filename](JSONError && e){
@@ -70,9 +76,45 @@ namespace tpp {
         }
         // parse command line arguments and update the configuration accordingly
         config.parseCommandLine(argc, argv);
+        config.settingsFile_ = filename;
+        config.argc_ = argc;
+        config.argv_ = argv;
         return config;
     }
 
+    Config::Changes Config::reload() {
+        Changes result;
+        Config fresh;
+        try {
+            std::ifstream f{settingsFile_};
+            if (! f.good())
+                THROW(IOError()) << "Unable to read the settings file " << settingsFile_;
+            JSON settings = JSON::Parse(f);
+            // unlike the setup, invalid settings are not fixed, but ignored as they are likely to be fixed by the user in the next save
+            fresh.update(settings);
+            fresh.fillMissingValues();
+            fresh.patchSessions();
+            fresh.parseCommandLine(argc_, argv_);
+        } catch (std::exception const & e) {
+            LOG() << "Settings not reloaded: " << e.what();
+            return result;
+        }
+        // the renderer groups are reloaded first so that the final reload of the whole configuration only reports the remaining changes
+        result.fps = renderer.fps.reloadFrom(fresh.renderer.fps);
+        result.font = renderer.font.reloadFrom(fresh.renderer.font);
+        result.hyperlinks = renderer.hyperlinks.reloadFrom(fresh.renderer.hyperlinks);
+        result.terminal = renderer.flowControl.reloadFrom(fresh.renderer.flowControl);
+        result.terminal = renderer.fastForward.reloadFrom(fresh.renderer.fastForward) || result.terminal;
+        result.terminal = renderer.window.historyLimit.reloadFrom(fresh.renderer.window.historyLimit) || result.terminal;
+        result.terminal = renderer.window.diskHistoryLimit.reloadFrom(fresh.renderer.window.diskHistoryLimit) || result.terminal;
+        result.terminal = sequences.reloadFrom(fresh.sequences) || result.terminal;
+        result.sessions = sessionDefaults.reloadFrom(fresh.sessionDefaults);
+        result.sessions = sessions.reloadFrom(fresh.sessions) || result.sessions;
+        result.sessions = defaultSession.reloadFrom(fresh.defaultSession) || result.sessions;
+        result.other = reloadFrom(fresh);
+        return result;
+    }
+
 	std::string Config::GetSettingsFolder() {
         return JoinPath(LocalSettingsFolder(), "terminalpp");
 	}
@@ -141,7 +183,7 @@ namespace tpp {
     }
 
     bool Config::addSession(JSON const & session) {
-        for (auto existing : sessions)
+        for (auto const & existing : sessions)
             if (existing.name() == session["name"].toString())
                 return false;
         sessions.addElement(session);
@@ -165,9 +207,23 @@ namespace tpp {
 		char const * fonts[] = { "Monospace", "DejaVu Sans Mono", "Nimbus Mono", "Liberation Mono", nullptr };
 		char const ** f = fonts;
 		while (*f != nullptr) {
+#if (defined RENDERER_NATIVE)
+			// query fontconfig directly instead of running fc-list for each candidate
+			FcPattern * pattern = FcPatternBuild(nullptr, FC_FAMILY, FcTypeString, *f, nullptr);
+			FcObjectSet * properties = FcObjectSetBuild(FC_FAMILY, nullptr);
+			FcFontSet * found = FcFontList(nullptr, pattern, properties);
+			bool exists = found != nullptr && found->nfont > 0;
+			if (found != nullptr)
+				FcFontSetDestroy(found);
+			FcObjectSetDestroy(properties);
+			FcPatternDestroy(pattern);
+			if (exists)
+				return JSON{*f};
+#else
 			std::string found{Exec(Command("fc-list", { *f }))};
 			if (! found.empty())
 			    return JSON{*f};
+#endif
 			++f;
 		}
 		Application::Instance()->alert("Cannot guess valid font - please specify manually for best results");
@@ -247,6 +247,12 @@ namespace tpp {
                 JSON{true},
                 bool
             );
+            CONFIG_PROPERTY(
+                singleProcess,
+                "If true, all windows are opened in a single process. Launching the terminal without arguments while it is already running only opens a new window in the running instance, which shares the settings, fonts and glyph caches. Supported only by the native X11 renderer.",
+                JSON{false},
+                bool
+            );
         );
         CONFIG_OBJECT(
             telemetry,
@@ -279,6 +285,18 @@ namespace tpp {
 				JSON{60},
 			    unsigned
 			);
+            CONFIG_PROPERTY(
+                flowControl,
+                "Maximum number of bytes of the terminal output parsed per frame. When the limit is reached, the output is paused until the terminal is repainted so that user input and repaints are serviced promptly and Ctrl+C discards the output not yet parsed. Use 0 to disable the flow control.",
+                JSON{0},
+                unsigned
+            );
+            CONFIG_PROPERTY(
+                fastForward,
+                "If true, terminal output which scrolls more than a screenful of lines at once is fast-forwarded, i.e. lines are appended to the history directly and only the final screen is displayed. Disabled by default as hyperlinks are not detected in the lines fast-forwarded to the history.",
+                JSON{false},
+                bool
+            );
             CONFIG_OBJECT(
                 hyperlinks,
                 "Settings for displaying hyperlinks",
@@ -417,6 +435,18 @@ namespace tpp {
                     JSON{10000},
                     int
                 );
+                CONFIG_PROPERTY(
+                    diskHistoryLimit,
+                    "Maximum size of the history stored on disk in megabytes. If greater than 0, history lines over the historyLimit are moved to temporary files, which are deleted when the session closes, instead of being discarded, and historyLimit only determines the lines kept in memory. Not supported on Windows. If set to 0, the history is kept in memory only.",
+                    JSON{0},
+                    unsigned
+                );
+                CONFIG_PROPERTY(
+                    compactIdleSessions,
+                    "Number of seconds after which the history of a hidden session that received no output is compacted to save memory. The history is expanded again when the session is shown. If set to 0, the history is never compacted.",
+                    JSON{60},
+                    unsigned
+                );
             );
         );
         CONFIG_OBJECT(
@@ -464,6 +494,58 @@ namespace tpp {
                 JSON{true},
                 bool
             );
+            CONFIG_ARRAY(
+                triggers,
+                "Patterns in the terminal output, such as build failures, or password prompts, the terminal reacts to by sending a notification, or highlighting the matched text",
+                JSON::Array(),
+                CONFIG_PROPERTY(
+                    pattern,
+                    "Text to match, case sensitive",
+                    JSON{""},
+                    std::string
+                );
+                CONFIG_PROPERTY(
+                    notify,
+                    "If true, a notification is sent when the pattern is matched",
+                    JSON{false},
+                    bool
+                );
+                CONFIG_PROPERTY(
+                    foreground,
+                    "Foreground color of the matched text (blended over existing)",
+                    JSON{"#00000000"},
+                    ui::Color
+                );
+                CONFIG_PROPERTY(
+                    background,
+                    "Background color of the matched text (blended over existing)",
+                    JSON{"#00000000"},
+                    ui::Color
+                );
+                CONFIG_PROPERTY(
+                    font,
+                    "Font attributes of the matched text, space separated 'underline', 'dashed', 'italic' and 'bold' are supported",
+                    JSON{""},
+                    config::FontAttributes
+                );
+                /** Returns the trigger as used by the terminal.
+                 */
+                ui::AnsiTerminal::Trigger operator () () const {
+                    ui::AnsiTerminal::Trigger result;
+                    result.pattern = pattern();
+                    result.notify = notify();
+                    result.style = ui::Hyperlink::Style{foreground(), background(), font()};
+                    return result;
+                }
+            );
+            /** Returns the triggers as used by the terminal.
+             */
+            std::vector<ui::AnsiTerminal::Trigger> allTriggers() const {
+                std::vector<ui::AnsiTerminal::Trigger> result;
+                for (size_t i = 0, e = triggers.size(); i < e; ++i)
+                    result.push_back(triggers[i]());
+                return result;
+            }
         );
         CONFIG_OBJECT(
             remoteFiles,
@@ -560,6 +642,12 @@ namespace tpp {
             JSON{"default"},
             std::string
         );
+        CONFIG_PROPERTY(
+            preSpawnedSessions,
+            "Number of idle shells running the default session's command kept ready in the background so that new default sessions open instantly. Use 0 to disable.",
+            JSON{0},
+            unsigned
+        );
         /* The list of sessings and their override settings.
          */
         CONFIG_ARRAY(
@@ -707,6 +795,40 @@ namespace tpp {
             THROW(Exception()) << "Session " << sessionName << " not found";
         }
 
+        /** Configuration changes found when the settings are reloaded, grouped by what has to be updated in the running terminal windows. 
+         */
+        class Changes {
+        public:
+            /** The maximum FPS of the renderer. */
+            bool fps = false;
+            /** The font family, size, or spacing. */
+            bool font = false;
+            /** The hyperlink styles. */
+            bool hyperlinks = false;
+            /** Flow control, fast forwarding, history limits, the escape sequences behavior, or the triggers. */
+            bool terminal = false;
+            /** Session defaults, or the sessions themselves (palettes, cursors). */
+            bool sessions = false;
+            /** Any other settings, which only take effect for new windows, or after restart. */
+            bool other = false;
+
+            bool any() const {
+                return fps || font || hyperlinks || terminal || sessions || other;
+            }
+        }; // Config::Changes
+
+        /** Reloads the configuration from the settings file the configuration was set up from. 
+
+            The file is read into a fresh configuration with the same command line arguments applied, which is then compared to the current configuration and only the changed values are copied. If the settings cannot be read, or are invalid, the current configuration is kept as is and no changes are reported. 
+         */
+        Changes reload();
+
+        /** Returns the settings file the configuration was read from. 
+         */
+        std::string const & settingsFile() const {
+            return settingsFile_;
+        }
+
         std::string familyForFont(ui::Font font) const {
             if (font.doubleWidth()) {
                 if (font.bold() && renderer.font.doubleWidthBoldFamily.updated())
@@ -769,6 +891,11 @@ namespace tpp {
 
     private:
 
+        /** The settings file and command line arguments used by Setup() so that the configuration can be reloaded. */
+        std::string settingsFile_;
+        int argc_ = 0;
+        char ** argv_ = nullptr;
+
         /** Verifies the configuration version stored in the settings.
 
             If the version is different than current version of the program, clears the version info so that it gets regenerated. If the old version is lower than the MIN_COMPATIBLE_VERSION, displays a warning that settings will be updated.
@@ -189,7 +189,7 @@ namespace tpp {
 		// and get system font collection
 		OSCHECK(SUCCEEDED(dwFactory_->GetSystemFontCollection(&systemFontCollection_, false))) << "Unable to get system font collection";
 		// start the blinker thread
-		DirectWriteWindow::StartBlinkerThread();
+		DirectWriteWindow::InitializeBlinker();
 
         dummy_ = CreateWindowExW(
             WS_EX_LEFT, // the default
@@ -68,10 +68,10 @@ namespace tpp {
 
         void registerDummyClass();
 
-        /** Executes single user event from the event queue, if any. 
+        /** Executes a batch of user events from the event queue, if any. 
          */
         void userEvent() {
-            eventQueue_.processEvent();
+            eventQueue_.processEvents();
         }
 
         /* Default locale for the user. */
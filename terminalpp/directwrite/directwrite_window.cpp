@@ -301,6 +301,8 @@ namespace tpp {
 			   It is ok if no terminal window is associated with the handle as the message can be sent from the WM_CREATE when window is resized to account for the window border which has to be calculated.
 			 */
 			case WM_SIZE: {
+				if (window != nullptr)
+					window->setMapped(wParam != SIZE_MINIMIZED);
 				if (wParam == SIZE_MINIMIZED)
 					break;
 				if (window != nullptr) {
@@ -50,8 +50,8 @@ namespace tpp {
 
         /** Schedules the event and notifies the main thread that an event is ready. 
          */
-        void schedule(std::function<void()> event, Widget * widget) override {
-            RendererWindow::schedule(event, widget);
+        void schedule(Task event, Widget * widget) override {
+            RendererWindow::schedule(std::move(event), widget);
             PostMessage(DirectWriteApplication::Instance()->dummy_, WM_USER, 0, 0);
         }
 
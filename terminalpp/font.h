@@ -129,6 +129,20 @@ namespace tpp {
             return i->second;
         }
 
+        /** Deletes all cached fonts so that they are created anew with the current font settings. 
+         
+            Must be called from the UI thread as the renderers obtain their fonts from the cache for every frame they render. 
+         */
+        static void ClearCache() {
+            for (auto & i : Fonts_)
+                delete i.second;
+            Fonts_.clear();
+            for (auto & i : FallbackFonts_)
+                for (T * f : i.second)
+                    delete f;
+            FallbackFonts_.clear();
+        }
+
         /** Returns a font that provides fallback for given character codepoint.
 
             Always returns a font, but if a suitable callback cannot be found, the returned font will not render the character properly.  
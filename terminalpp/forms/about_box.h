@@ -8,14 +8,17 @@ namespace tpp {
 
     class AboutBox : public ui::Dialog::Cancel {
     public:
-        AboutBox():
+        /** Creates the about box, optionally with diagnostic information, one line each, displayed below the version.
+         */
+        explicit AboutBox(std::vector<std::string> diagnostics = {}):
             Cancel{"Terminal++"},
             btnNewIssue_{new Button{" new issue "}},
-            btnWWW_{new Button{" www "}} {
+            btnWWW_{new Button{" www "}},
+            diagnostics_{std::move(diagnostics)} {
             setWidthHint(SizeHint::Manual());
             setHeightHint(SizeHint::Manual());
             //setSemanticStyle(SemanticStyle::Primary);
-            resize(Size{65,8});
+            resize(Size{65, 8 + static_cast<int>(diagnostics_.size())});
             btnNewIssue_->onExecuted.setHandler([](VoidEvent::Payload & e) {
                 Application::Instance()->createNewIssue("", "Please check that a similar bug has not been already filed. If not, fill in the description and titke of the bug, keeping the version information below. Thank you!");
                 e.stop();
@@ -50,8 +53,11 @@ namespace tpp {
 #else
             canvas.textOut(Point{3, 6}, STR("platform: " << ARCH << "(native) " << ARCH_SIZE << " " << ARCH_COMPILER << " " << ARCH_COMPILER_VERSION << " " << stamp::build));
 #endif
+            int row = 8;
+            for (std::string const & line : diagnostics_)
+                canvas.textOut(Point{3, row++}, line);
             canvas.font().setBlink(true);
-            canvas.textOut(Point{20, 8}, "Hit esc to dismiss");
+            canvas.textOut(Point{20, row}, "Hit esc to dismiss");
             canvas.setFont(ui::Font{});
         }
 
@@ -64,6 +70,7 @@ namespace tpp {
 
         Button * btnNewIssue_;
         Button * btnWWW_;
+        std::vector<std::string> diagnostics_;
 
     }; // tpp::AboutBox
 
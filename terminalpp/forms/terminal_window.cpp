@@ -1,3 +1,5 @@
+#include <iomanip>
+
 #include "terminal_window.h"
 
 
@@ -5,25 +7,58 @@ namespace tpp {
 
     using namespace ui;
 
-    void TerminalWindow::newSession(Config::sessions_entry const & session) {
+    std::unordered_set<TerminalWindow *> TerminalWindow::Windows_;
+
+    std::unique_ptr<LocalPTYPool> TerminalWindow::SessionPool_;
+
+    LocalPTYPool * TerminalWindow::SessionPool(Config const & config) {
+        UI_THREAD_ONLY;
+        if (config.preSpawnedSessions() == 0) {
+            SessionPool_.reset();
+            return nullptr;
+        }
+        Config::sessions_entry const & session = config.sessionByName(config.defaultSession());
+        Command cmd = session.command();
+        cmd.setWorkingDirectory(session.workingDirectory());
+        // the idle shells of an outdated pool are terminated
+        if (SessionPool_ != nullptr && (SessionPool_->command() != cmd || SessionPool_->size() != config.preSpawnedSessions()))
+            SessionPool_.reset();
+        if (SessionPool_ == nullptr)
+            SessionPool_.reset(new LocalPTYPool{cmd, config.preSpawnedSessions()});
+        return SessionPool_.get();
+    }
+
+    void TerminalWindow::newSession(Config::sessions_entry const & session, std::string const & workingDirectory, Environment const * env) {
         Config const & config = Config::Instance();
         std::unique_ptr<SessionInfo> si{new SessionInfo{session}};
         // create the pty
         PTYMaster * pty = nullptr;
-        // sets the working directory of the command to the specified working directory of the session,
+        // sets the working directory of the command to the specified working directory of the session, or the given one
         Command cmd = session.command();
-        cmd.setWorkingDirectory(session.workingDirectory());
+        cmd.setWorkingDirectory(session.workingDirectory().empty() ? workingDirectory : session.workingDirectory());
+        {
+            StartupTrace::Phase phase{"session spawn"};
 #if (ARCH_WINDOWS)
-        if (session.pty() != "bypass") 
-            pty = new LocalPTYMaster(cmd);
-        else
-            pty = new BypassPTYMaster(cmd);
+            MARK_AS_UNUSED(env);
+            if (session.pty() != "bypass") 
+                pty = new LocalPTYMaster(cmd);
+            else
+                pty = new BypassPTYMaster(cmd);
 #else
-        pty = new LocalPTYMaster{cmd};
+            // the pre-spawned sessions have the terminal's environment
+            LocalPTYPool * pool = SessionPool(config);
+            if (pool != nullptr && pool->command() == cmd && env == nullptr)
+                pty = pool->acquire();
+            if (pty == nullptr)
+                pty = env == nullptr ? new LocalPTYMaster{cmd} : new LocalPTYMaster{cmd, *env};
 #endif
+        }
         // and the terminal
         si->terminal = new AnsiTerminal{pty, session.palette()};
         si->terminal->setMaxHistoryRows(config.renderer.window.historyLimit());
+        si->terminal->setMaxDiskHistoryBytes(static_cast<size_t>(config.renderer.window.diskHistoryLimit()) * 1024 * 1024);
+        si->terminal->setFlowControl(config.renderer.flowControl());
+        si->terminal->setFastForward(config.renderer.fastForward());
         si->terminal->setBoldIsBright(config.sequences.boldIsBright());
         si->terminal->setDisplayBold(config.sequences.displayBold());
         si->terminal->setCursor(session.cursor());
@@ -31,6 +66,7 @@ namespace tpp {
         si->terminal->setAllowCursorChanges(config.sequences.allowCursorChanges());
         si->terminal->setAllowOSCHyperlinks(config.sequences.allowOSCHyperlinks());
         si->terminal->setDetectHyperlinks(config.sequences.detectHyperlinks());
+        si->terminal->setTriggers(config.sequences.allTriggers());
         si->terminal->setNormalHyperlinkStyle(config.renderer.hyperlinks.normal());
         si->terminal->setActiveHyperlinkStyle(config.renderer.hyperlinks.active());
         // register the session and set it as active page
@@ -48,6 +84,115 @@ namespace tpp {
         t->onKeyDown.setHandler(&TerminalWindow::terminalKeyDown, this);
         t->onHyperlinkOpen.setHandler(&TerminalWindow::hyperlinkOpen, this);
         t->onHyperlinkCopy.setHandler(&TerminalWindow::hyperlinkCopy, this);
+        updateIdleChecker();
+    }
+
+    void TerminalWindow::configReloaded(Config::Changes const & changes) {
+        Config const & config = Config::Instance();
+        if (changes.fps)
+            window_->setFps(config.renderer.fps());
+        if (changes.font)
+            window_->fontSettingsChanged();
+        for (auto & i : sessions_) {
+            SessionInfo * si = i.second;
+            AnsiTerminal * t = si->terminal;
+            if (changes.hyperlinks) {
+                t->setNormalHyperlinkStyle(config.renderer.hyperlinks.normal());
+                t->setActiveHyperlinkStyle(config.renderer.hyperlinks.active());
+            }
+            if (changes.terminal) {
+                t->setMaxHistoryRows(config.renderer.window.historyLimit());
+                t->setMaxDiskHistoryBytes(static_cast<size_t>(config.renderer.window.diskHistoryLimit()) * 1024 * 1024);
+                t->setFlowControl(config.renderer.flowControl());
+                t->setFastForward(config.renderer.fastForward());
+                t->setBoldIsBright(config.sequences.boldIsBright());
+                t->setDisplayBold(config.sequences.displayBold());
+                t->setAllowCursorChanges(config.sequences.allowCursorChanges());
+                t->setAllowOSCHyperlinks(config.sequences.allowOSCHyperlinks());
+                t->setDetectHyperlinks(config.sequences.detectHyperlinks());
+                t->setTriggers(config.sequences.allTriggers());
+            }
+            if (changes.sessions) {
+                // sessions no longer present in the settings keep their current appearance
+                for (auto const & session : config.sessions) {
+                    if (session.name() != si->name)
+                        continue;
+                    t->setPalette(session.palette());
+                    t->setCursor(session.cursor());
+                    t->setInactiveCursorColor(session.cursor.inactiveColor());
+                    break;
+                }
+            }
+            t->repaint();
+        }
+        if (changes.sessions && activeSession_ != nullptr)
+            setBackground(activeSession_->terminal->palette().defaultBackground());
+        updateIdleChecker();
+    }
+
+    void TerminalWindow::compactIdleSessions() {
+        std::chrono::seconds after{Config::Instance().renderer.window.compactIdleSessions()};
+        if (after.count() == 0)
+            return;
+        auto now = std::chrono::steady_clock::now();
+        for (auto & i : sessions_) {
+            SessionInfo * si = i.second;
+            if (si == activeSession_ || now - si->lastActive < after)
+                continue;
+            if (si->terminal->idleTime() >= after)
+                si->terminal->compactHistory();
+        }
+    }
+
+    /** Only the active session is visible, so there are hidden sessions whenever there is more than one. 
+     */
+    void TerminalWindow::updateIdleChecker() {
+        bool enabled = Config::Instance().renderer.window.compactIdleSessions() != 0 && sessions_.size() > 1;
+        if (enabled == (idleChecker_ != 0))
+            return;
+        if (enabled) {
+            std::chrono::milliseconds idleCheckInterval{std::chrono::seconds{IDLE_CHECK_INTERVAL}};
+            idleChecker_ = TimerService::Instance().schedule(idleCheckInterval, idleCheckInterval, [this](){
+                schedule([this](){
+                    compactIdleSessions();
+                });
+                return true;
+            });
+        } else {
+            TimerService::Instance().cancel(idleChecker_);
+            idleChecker_ = 0;
+        }
+    }
+
+    void TerminalWindow::measureActivity() {
+        ActivitySample now;
+        now.time = std::chrono::steady_clock::now();
+        now.wakeups = TimerService::Instance().wakeups();
+        now.frames = window_->framesRendered();
+        now.cpu = ProcessCPUTime();
+        if (lastActivity_.time != std::chrono::steady_clock::time_point{}) {
+            double seconds = std::chrono::duration<double>(now.time - lastActivity_.time).count();
+            double cpu = std::chrono::duration<double>(now.cpu - lastActivity_.cpu).count();
+            // the wakeups and CPU time are process wide, the frames are of this window only
+            activity_ = STR("Last " << static_cast<int>(seconds + 0.5) << " s: " << std::fixed << std::setprecision(1)
+                << (now.wakeups - lastActivity_.wakeups) / seconds << " wakeups/s, "
+                << (now.frames - lastActivity_.frames) / seconds << " frames/s, "
+                << cpu * 100 / seconds << "% CPU");
+        }
+        lastActivity_ = now;
+    }
+
+    std::vector<std::string> TerminalWindow::diagnostics() {
+        measureActivity();
+        std::vector<std::string> result;
+        if (! activity_.empty())
+            result.push_back(activity_);
+        for (auto & i : sessions_) {
+            SessionInfo * si = i.second;
+            AnsiTerminal::MemoryUsage usage{si->terminal->memoryUsage()};
+            result.push_back(STR(si->name << ": " << (usage.total() + 1023) / 1024 << " KB, " << usage.historyRows << " history rows (" << usage.compactedLines << " compacted lines, " << (usage.disk + 1023) / 1024 << " KB on disk)"));
+        }
+        return result;
     }
 
 } // namespace tpp
@@ -127,20 +127,85 @@ namespace tpp {
                 }
             }};
 
+            // the first sample against which the activity shown in the about box is measured
+            measureActivity();
+
             setFocusable(true);
 
             //setName("TerminalWindow");
+            Windows_.insert(this);
         }
 
         ~TerminalWindow() override {
+            Windows_.erase(this);
+            // the idle shells are not needed without windows
+            if (Windows_.empty())
+                SessionPool_.reset();
+            if (idleChecker_ != 0)
+                TimerService::Instance().cancel(idleChecker_);
             versionChecker_.join();
             delete remoteFiles_;
         }
 
-        void newSession(Config::sessions_entry const & session);
+        /** Opens new session in the window. 
+
+            The workingDirectory is used if the session does not specify its own. If env is not null, the session uses the given environment instead of the terminal's. 
+         */
+        void newSession(Config::sessions_entry const & session, std::string const & workingDirectory = std::string{}, Environment const * env = nullptr);
+
+        /** Applies the changes of the reloaded configuration to all terminal windows. 
+         
+            Must be called from the UI thread. 
+         */
+        static void ConfigReloaded(Config::Changes const & changes) {
+            UI_THREAD_ONLY;
+            for (TerminalWindow * tw : Windows_)
+                tw->configReloaded(changes);
+            // the default session, or the number of pre-spawned sessions may have changed
+            if (SessionPool_ != nullptr && (changes.sessions || changes.other))
+                SessionPool(Config::Instance());
+        }
 
 
     private:
+        /** Updates the window and its sessions with the reloaded configuration. 
+         
+            Only the changed parts are updated, the terminals keep their contents and history. 
+         */
+        void configReloaded(Config::Changes const & changes);
+
+        /** Interval in seconds in which the hidden sessions are checked for being idle. 
+         */
+        static constexpr unsigned IDLE_CHECK_INTERVAL = 10;
+
+        /** Compacts the history of hidden sessions that have been idle for longer than the configured time. 
+         */
+        void compactIdleSessions();
+
+        /** Schedules the idle check if there are hidden sessions and their compaction is enabled, cancels it otherwise. 
+
+            Must be called whenever the sessions or the configuration change so that windows with a single session, or with the compaction disabled do not wake up periodically. 
+         */
+        void updateIdleChecker();
+
+        /** Samples the wakeups, frames and CPU time of the application since the previous sample. 
+         */
+        void measureActivity();
+
+        /** Returns the diagnostic lines for the about box, i.e. the activity since the previous time the about box was shown (or since the window was created) and a line describing the memory used by each session. 
+         */
+        std::vector<std::string> diagnostics();
+
+        /** Activity counters at the time of an idle check. 
+         */
+        class ActivitySample {
+        public:
+            std::chrono::steady_clock::time_point time;
+            uint64_t wakeups = 0;
+            uint64_t frames = 0;
+            std::chrono::microseconds cpu{0};
+        };
+
         class SessionInfo {
         public:
             std::string name;
@@ -151,6 +216,9 @@ namespace tpp {
              */
             bool notification = false;
             PasteDialog * pendingPaste = nullptr;
+            /** The last time the session was active, i.e. visible. 
+             */
+            std::chrono::steady_clock::time_point lastActive;
 
             explicit SessionInfo(Config::sessions_entry const & session):
                 name{session.name()},
@@ -193,7 +261,7 @@ namespace tpp {
                 if (window_->zoom() > 1)
                     window_->setZoom(std::max(1.0, window_->zoom() / 1.25));
             } else if (*e == SHORTCUT_ABOUT && ! window_->isModal()) {
-                showModal(new AboutBox{});
+                showModal(new AboutBox{diagnostics()});
             } else {
                 return;
             }
@@ -215,6 +283,7 @@ namespace tpp {
             sessions_.erase(session->terminal);
             pager_->removePage(session->terminal);
             delete session;
+            updateIdleChecker();
             // if this was the last session, close the window
             if (sessions_.empty())
                 window_->requestClose();
@@ -261,6 +330,8 @@ namespace tpp {
         }
 
         void activeSessionChanged(ui::Event<Widget*>::Payload & e) {
+            if (activeSession_ != nullptr)
+                activeSession_->lastActive = std::chrono::steady_clock::now();
             activeSession_ = *e == nullptr ? nullptr : sessionInfo(*e);
             // set own background to the session's terminal background so that it propagates to the window's background
             if (activeSession_ != nullptr) {
@@ -412,6 +483,28 @@ namespace tpp {
 
         std::thread versionChecker_;
 
+        /** Periodically schedules the check for idle sessions, 0 if not scheduled. 
+         */
+        TimerService::Token idleChecker_ = 0;
+
+        ActivitySample lastActivity_;
+        /** Activity between the last two idle checks, empty until measured. */
+        std::string activity_;
+
+        /** All terminal windows, so that configuration changes can be applied to them. Only accessed from the UI thread. 
+         */
+        static std::unordered_set<TerminalWindow *> Windows_;
+
+        /** Returns the pool of pre-spawned ptys for the default session, or nullptr if pre-spawning is disabled. 
+
+            The pool is created with the first session so that the shells do not compete with the startup of the terminal itself. If the default session, or the number of pre-spawned sessions changes, the pool is replaced. 
+         */
+        static LocalPTYPool * SessionPool(Config const & config);
+
+        /** The pool of pre-spawned ptys, owned by the terminal windows, i.e. deleted with the last window. Only accessed from the UI thread. 
+         */
+        static std::unique_ptr<LocalPTYPool> SessionPool_;
+
     };
 
 } // namespace tpp
@@ -1,11 +1,13 @@
 ﻿#include <iostream>
 #include <thread>
+#include <fstream>
 
 #include "helpers/char.h"
 #include "helpers/time.h"
 #include "helpers/filesystem.h"
 #include "helpers/curl.h"
 #include "helpers/telemetry.h"
+#include "helpers/startup_trace.h"
 
 #include "config.h"
 
@@ -44,6 +46,10 @@
 
 #include "helpers/filesystem.h"
 
+/** Makes sure the startup tracer's clock starts during the static initialization.
+ */
+static StartupTrace & StartupTraceInitializer_ = StartupTrace::Instance();
+
 void reportError(std::string const & message) {
 #if (defined ARCH_WINDOWS)
     utf16_string text = UTF8toUTF16(message);
@@ -76,6 +82,53 @@ void SendTelemetry(Telemetry & telemetry) {
     }
 }
 
+/** Opens new terminal window with the default session. 
+
+    If given, the working directory is used unless the session specifies its own and the environment replaces the environment of the terminal for the session. 
+ */
+tpp::Window * OpenWindow(tpp::Config const & config, std::string const & workingDirectory = std::string{}, Environment const * env = nullptr) {
+    tpp::Window * w = nullptr;
+    {
+        StartupTrace::Phase phase{"createWindow"};
+        w = tpp::Application::Instance()->createWindow("Foobar", config.renderer.window.cols(), config.renderer.window.rows());
+        if (config.renderer.window.fullscreen())
+            w->setFullscreen(true);
+    }
+    // currently owned by the window, when multiple sessions are available this might change
+    tpp::TerminalWindow * tw = nullptr;
+    {
+        StartupTrace::Phase phase{"TerminalWindow"};
+        tw = new tpp::TerminalWindow{w};
+    }
+    tw->newSession(config.sessionByName(config.defaultSession()), workingDirectory, env);
+    return w;
+}
+
+/** Enables reporting of the startup trace. 
+
+    With `--startup-benchmark` the summary is printed and the application terminates once the first frame with the shell's output has been rendered. Alternatively, the `TPP_STARTUP_TRACE` environment variable can be set to a filename, in which case the summary is printed and the trace is saved to the file in the Chrome trace event format. 
+ */
+void ReportStartupTrace(bool startupBenchmark, tpp::Window * w) {
+    char const * traceFile = getenv("TPP_STARTUP_TRACE");
+    if (! startupBenchmark && traceFile == nullptr)
+        return;
+    std::string filename{traceFile == nullptr ? "" : traceFile};
+    StartupTrace::Instance().setOnComplete([startupBenchmark, filename, w](StartupTrace & trace) {
+        trace.writeSummary(std::cout);
+        if (! filename.empty()) {
+            std::ofstream f{filename};
+            trace.writeChromeTrace(f);
+            if (! f.good())
+                std::cout << "Unable to write startup trace to " << filename << std::endl;
+        }
+        if (startupBenchmark) {
+            w->schedule([w](){
+                w->requestClose();
+            });
+        }
+    });
+}
+
 // https://www.codeguru.com/cpp/misc/misc/graphics/article.php/c16139/Introduction-to-DirectWrite.htm
 
 // https://docs.microsoft.com/en-us/windows/desktop/gdi/windows-gdi
@@ -96,25 +149,49 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	int argc = __argc;
 	char** argv = __argv;
     CheckVersion(argc, argv, PrintVersion);
-	tpp::APPLICATION_CLASS::Initialize(argc, argv, hInstance);
+    {
+        StartupTrace::Phase phase{"Application::Initialize"};
+        tpp::APPLICATION_CLASS::Initialize(argc, argv, hInstance);
+    }
 #elif (defined ARCH_WINDOWS && defined RENDERER_QT)
 int main(int argc, char* argv[]) {
     CheckVersion(argc, argv, PrintVersion);
-	tpp::APPLICATION_CLASS::Initialize(argc, argv);
+    {
+        StartupTrace::Phase phase{"Application::Initialize"};
+        tpp::APPLICATION_CLASS::Initialize(argc, argv);
+    }
 #else
 int main(int argc, char* argv[]) {
     CheckVersion(argc, argv, PrintVersion);
-	tpp::APPLICATION_CLASS::Initialize(argc, argv);
+#if (defined ARCH_UNIX && defined RENDERER_NATIVE)
+    // in single process mode, the running instance opens the window for us 
+    if (argc == 1 && tpp::X11Application::RequestWindow())
+        return EXIT_SUCCESS;
 #endif
+    {
+        StartupTrace::Phase phase{"Application::Initialize"};
+        tpp::APPLICATION_CLASS::Initialize(argc, argv);
+    }
+#endif
+    // with --startup-benchmark the terminal reports the startup trace and exits
+    bool startupBenchmark = argc == 2 && strcmp(argv[1], "--startup-benchmark") == 0;
+    if (startupBenchmark)
+        argc = 1;
     // create the telemetry manager and its handler. 
     Telemetry telemetry(SendTelemetry);
     try {
         //tpp::Config const & config = tpp::Config::Setup(argc, argv);
-        tpp::Config const & config = tpp::Config::Setup(argc, argv);
+        tpp::Config const & config = [argc, argv]() -> tpp::Config const & {
+            StartupTrace::Phase phase{"Config::Setup"};
+            return tpp::Config::Setup(argc, argv);
+        }();
         // open the telemetry and add the registered logs
-        telemetry.open(config.telemetry.dir() + "/" + TimeInDashed());
-        for (auto & i : config.telemetry.events())
-            telemetry.addLog(i);
+        {
+            StartupTrace::Phase phase{"telemetry open"};
+            telemetry.open(config.telemetry.dir() + "/" + TimeInDashed());
+            for (auto & i : config.telemetry.events())
+                telemetry.addLog(i);
+        }
 
 		Log::Enable(Log::StdOutWriter(), { 
 			Log::Default(),
@@ -123,15 +200,23 @@ int main(int argc, char* argv[]) {
 			ui::AnsiTerminal::SEQ_UNKNOWN
 		});
 
-        tpp::Window * w = tpp::Application::Instance()->createWindow("Foobar", config.renderer.window.cols(), config.renderer.window.rows());
-        if (config.renderer.window.fullscreen())
-            w->setFullscreen(true);
-        // currently owned by the window, when multiple sessions are available this might change
-        tpp::TerminalWindow * tw = new tpp::TerminalWindow{w};
-        tw->newSession(config.sessionByName(config.defaultSession()));
+        tpp::Window * w = OpenWindow(config);
+        ReportStartupTrace(startupBenchmark, w);
         //tw->newSession(config.sessions[0]);
         //new tpp::Session{w, config.sessionByName(config.defaultSession())};
         w->show();
+        // command line arguments apply to the first window only, so only instances started without them can open other windows
+        if (config.application.singleProcess() && argc == 1 && ! startupBenchmark) {
+            tpp::Application::Instance()->serveWindowRequests([&config](std::string const & workingDirectory, Environment const & env){
+                OpenWindow(config, workingDirectory, & env)->show();
+            });
+        }
+        // settings changes are applied to the running windows as soon as the file is saved
+        tpp::Application::Instance()->watchSettings(config.settingsFile(), [](){
+            tpp::Config::Changes changes = tpp::Config::Instance().reload();
+            if (changes.any())
+                tpp::TerminalWindow::ConfigReloaded(changes);
+        });
 #if (defined ARCH_WINDOWS && defined RENDERER_NATIVE)
         // TODO se how fast this is and perhaps execute in separate thread?
         w->schedule([](){
@@ -34,7 +34,7 @@ namespace tpp {
         ASSERT(QFile::exists(":/icon_32x32.png"));
         ASSERT(QFile::exists(":/icon-notification_32x32.png"));
 
-		QtWindow::StartBlinkerThread();
+		QtWindow::InitializeBlinker();
     }
 
     Window * QtApplication::createWindow(std::string const & title, int cols, int rows) {
@@ -69,7 +69,7 @@ namespace tpp {
     }
 
     void QtApplication::userEvent() {
-        eventQueue_.processEvent();        
+        eventQueue_.processEvents();        
     }
 
     void QtApplication::selectionChanged() {
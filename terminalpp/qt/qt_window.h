@@ -42,8 +42,8 @@ namespace tpp {
             QWidget::close();
         }
 
-        void schedule(std::function<void()> event, Widget * widget) override {
-            Super::schedule(event, widget);
+        void schedule(Task event, Widget * widget) override {
+            Super::schedule(std::move(event), widget);
             emit QtApplication::Instance()->tppUserEvent();
         }
 
@@ -142,6 +142,18 @@ namespace tpp {
             windowResized(ev->size().width(), ev->size().height());
         }
 
+        /** Qt's show and hide events, which are also sent when the window is restored, or minimized. 
+         */
+        void showEvent(QShowEvent * ev) override {
+            QWidget::showEvent(ev);
+            setMapped(true);
+        }
+
+        void hideEvent(QHideEvent * ev) override {
+            QWidget::hideEvent(ev);
+            setMapped(false);
+        }
+
         void closeEvent(QCloseEvent * ev) override {
             if (closing_) {
                 QWidget::closeEvent(ev);
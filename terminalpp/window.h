@@ -5,6 +5,7 @@
 #include <mutex>
 
 #include "helpers/time.h"
+#include "helpers/startup_trace.h"
 
 #include "ui/canvas.h"
 
@@ -31,6 +32,8 @@ namespace tpp {
             Notification,
         }; // Window::Icon
 
+        using Renderer::setFps;
+
 
         std::string const & title() const {
             return title_;
@@ -63,6 +66,10 @@ namespace tpp {
                 zoom_ = value;
         }
 
+        /** Re-resolves the fonts after the font settings have changed, keeping the current zoom. 
+         */
+        virtual void fontSettingsChanged() = 0;
+
         bool fullscreen() const {
             return fullscreen_;
         }
@@ -131,6 +138,70 @@ namespace tpp {
 
         //@}
 
+    /** \name Power State
+     
+        The window is Active when it is visible and focused, Unfocused when it is visible, but not focused and Hidden when it is minimized, unmapped, or fully obscured by other windows. Hidden windows do not paint, or render anything and are skipped by the blinker, unfocused windows do not blink their cursor so that a window which is not being interacted with does not wake the application up, unless it has blinking text on the screen. 
+
+        The subclasses report the visibility changes as their windowing systems provide them, the focus is tracked by the window itself. 
+     */
+    //@{
+    public:
+        enum class PowerState {
+            Active,
+            Unfocused,
+            Hidden,
+        }; // Window::PowerState
+
+        PowerState powerState() const {
+            return powerState_;
+        }
+
+    protected:
+
+        /** Called when the window is mapped (shown, or restored) or unmapped (hidden, or minimized). 
+         */
+        void setMapped(bool value) {
+            mapped_ = value;
+            updatePowerState();
+        }
+
+        /** Called when the window becomes fully obscured by other windows, or at least partially visible again. 
+         */
+        void setObscured(bool value) {
+            obscured_ = value;
+            updatePowerState();
+        }
+
+        void focusIn() override {
+            Renderer::focusIn();
+            updatePowerState();
+        }
+
+        void focusOut() override {
+            Renderer::focusOut();
+            updatePowerState();
+        }
+
+    private:
+
+        void updatePowerState() {
+            PowerState state = (! mapped_ || obscured_) ? PowerState::Hidden : (rendererFocused() ? PowerState::Active : PowerState::Unfocused);
+            if (state == powerState_)
+                return;
+            bool wasHidden = powerState_ == PowerState::Hidden;
+            powerState_ = state;
+            setRendererVisible(state != PowerState::Hidden);
+            // the cursor blinks only in active windows, so it must be redrawn when focus changes (becoming visible repaints the whole window already)
+            if (! wasHidden && state != PowerState::Hidden)
+                repaint();
+        }
+
+        bool mapped_ = true;
+        bool obscured_ = false;
+        std::atomic<PowerState> powerState_{PowerState::Unfocused};
+
+        //@}
+
     protected:
         Window(int width, int height, FontMetrics const & font, EventQueue & eq):
             Renderer{Size{width, height}, eq},
@@ -231,6 +302,18 @@ namespace tpp {
             }
         }
 
+        /** The cached fonts are discarded so that the base font size is determined anew, exactly as when the window was created, and the cell size for the current zoom is then updated the same way setZoom() does it. 
+         */
+        void fontSettingsChanged() override {
+            IMPLEMENTATION::Font::ClearCache();
+            baseFontSize_ = IMPLEMENTATION::Font::Get(ui::Font(), tpp::Config::Instance().renderer.font.size())->cellSize();
+            typename IMPLEMENTATION::Font * f = IMPLEMENTATION::Font::Get(ui::Font(), static_cast<int>(baseFontSize_.height() * zoom_));
+            cellSize_ = f->cellSize();
+            resizePx(sizePx_);
+            // the number of cells may stay the same, but they must be rendered with the new font
+            repaint();
+        }
+
     protected:
 
         /** Resizes the renderer's winow based on its pixel dimensions. 
@@ -251,6 +334,10 @@ namespace tpp {
         Cell state_;
         Point lastCursorPos_;
 
+        /** True if the last rendered frame contained blinking text, or a blinking cursor. Read by the blinker. 
+         */
+        std::atomic<bool> blinking_{false};
+
         static IMPLEMENTATION * GetWindowForHandle(NATIVE_HANDLE handle) {
             ASSERT(GlobalState_ != nullptr);
             std::lock_guard<std::mutex> g(GlobalState_->mWindows);
@@ -289,38 +376,59 @@ namespace tpp {
         }
 
 
-        /** Starts the blinker thread that runs for the duration of the application and periodically repaints all windows so that blinking text is properly displayed. 
+        /** Initializes the global state of the windows and the blinker. 
          
             The method must be called by the Application instance startup.  
          */
-        static void StartBlinkerThread() {
+        static void InitializeBlinker() {
             GlobalState_ = new GlobalState{};
-            std::thread t([](){
-                GlobalState_->blinkVisible = true;
-                while (true) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(GlobalState_->blinkSpeed));
-                    GlobalState_->blinkVisible = ! GlobalState_->blinkVisible;
-                    {
-                        std::lock_guard<std::mutex> g(GlobalState_->mWindows);
-                        for (auto i : GlobalState_->windows)
-                            i.second->repaint();
-                    }
+            GlobalState_->blinkVisible = true;
+        }
+
+        /** Starts the blinker timer unless it is already running. 
+
+            The blinker periodically repaints all windows that are not hidden and have blinking text, or cursor on the screen. When there are no such windows, the blinker stops itself and is started again by the next frame with blinking contents, so that an application without anything to blink does not wake up at all. 
+         */
+        static void StartBlinker() {
+            ASSERT(GlobalState_ != nullptr);
+            std::lock_guard<std::mutex> g(GlobalState_->mWindows);
+            if (GlobalState_->blinkerRunning)
+                return;
+            GlobalState_->blinkerRunning = true;
+            std::chrono::milliseconds blinkSpeed{GlobalState_->blinkSpeed};
+            TimerService::Instance().schedule(blinkSpeed, blinkSpeed, [](){
+                std::lock_guard<std::mutex> g(GlobalState_->mWindows);
+                bool blinking = false;
+                for (auto i : GlobalState_->windows)
+                    if (i.second->blinking_ && i.second->powerState() != PowerState::Hidden)
+                        blinking = true;
+                if (! blinking) {
+                    // leave the blinking text visible so that it is displayed when its window is shown again
+                    GlobalState_->blinkVisible = true;
+                    GlobalState_->blinkerRunning = false;
+                    return false;
                 }
+                GlobalState_->blinkVisible = ! GlobalState_->blinkVisible;
+                for (auto i : GlobalState_->windows)
+                    if (i.second->blinking_ && i.second->powerState() != PowerState::Hidden)
+                        i.second->repaint();
+                return true;
             });
-            t.detach();
         }
 
         /** Global state for the window management and rendering. 
          
-            Because the blinker thread is detached, the global state must be heap allocated so that the objects here are never deallocated in case the blinker thread will execute after the main function ends. 
+            Because the blinker timer may execute after the main function ends, the global state must be heap allocated so that the objects here are never deallocated. 
          */
         struct GlobalState {
             /** A map which points from the native handles to the windows. */
             std::unordered_map<NATIVE_HANDLE, IMPLEMENTATION *> windows;
-            /** Guard for the list of windows (ui thread and the blinker thread). */
+            /** Guard for the list of windows and the blinker state (ui thread and the blinker timer). */
             std::mutex mWindows;
             /** Current visibility of the blinking text. */
             std::atomic<bool> blinkVisible;
+            /** True if the blinker timer is scheduled. */
+            bool blinkerRunning = false;
             /** The speed of the blinking text, same for all windows in the application. */
             unsigned blinkSpeed = DEFAULT_BLINK_SPEED;
         }; // tpp::RendererWindow::BlinkInfo
@@ -345,6 +453,7 @@ namespace tpp {
             // then actually render the entire window
             Stopwatch t;
             t.start();
+            StartupTrace::Phase phase{"render"};
             // shorthand to the buffer
             Buffer const & buffer = this->buffer();
             // initialize the drawing and set the state for the first cell
@@ -354,48 +463,52 @@ namespace tpp {
             changeFg(state_.fg());
             changeBg(state_.bg());
             changeDecor(state_.decor());
+            bool blinking = false;
             // loop over the buffer and draw the cells
             for (int row = 0, re = height(); row < re; ++row) {
                 initializeGlyphRun(0, row);
                 for (int col = 0, ce = width(); col < ce; ) {
                     Cell const & c = buffer.at(col, row);
-                    // detect if there were changes in the font & colors and update the state & draw the glyph run if present. The code looks a bit ugly as we have to first draw the glyph run and only then change the state.
-                    bool drawRun = true;
-                    if (state_.font() != c.font()) {
-                        if (drawRun) {
-                            drawGlyphRun();
-                            initializeGlyphRun(col, row);
-                            drawRun = false;
+                    blinking = blinking || c.font().blink();
+                    // detect if there were changes in the font & colors and update the state & draw the glyph run if present. Cells with identical style, which is the common case, are detected by a single comparison. The code looks a bit ugly as we have to first draw the glyph run and only then change the state.
+                    if (! state_.sameStyle(c)) {
+                        bool drawRun = true;
+                        if (state_.font() != c.font()) {
+                            if (drawRun) {
+                                drawGlyphRun();
+                                initializeGlyphRun(col, row);
+                                drawRun = false;
+                            }
+                            changeFont(c.font());
+                            state_.setFont(c.font());
                         }
-                        changeFont(c.font());
-                        state_.setFont(c.font());
-                    }
-                    if (state_.fg() != c.fg()) {
-                        if (drawRun) {
-                            drawGlyphRun();
-                            initializeGlyphRun(col, row);
-                            drawRun = false;
+                        if (state_.fg() != c.fg()) {
+                            if (drawRun) {
+                                drawGlyphRun();
+                                initializeGlyphRun(col, row);
+                                drawRun = false;
+                            }
+                            changeFg(c.fg());
+                            state_.setFg(c.fg());
                         }
-                        changeFg(c.fg());
-                        state_.setFg(c.fg());
-                    }
-                    if (state_.bg() != c.bg()) {
-                        if (drawRun) {
-                            drawGlyphRun();
-                            initializeGlyphRun(col, row);
-                            drawRun = false;
+                        if (state_.bg() != c.bg()) {
+                            if (drawRun) {
+                                drawGlyphRun();
+                                initializeGlyphRun(col, row);
+                                drawRun = false;
+                            }
+                            changeBg(c.bg());
+                            state_.setBg(c.bg());
                         }
-                        changeBg(c.bg());
-                        state_.setBg(c.bg());
-                    }
-                    if (state_.decor() != c.decor()) {
-                        if (drawRun) {
-                            drawGlyphRun();
-                            initializeGlyphRun(col, row);
-                            drawRun = false;
+                        if (state_.decor() != c.decor()) {
+                            if (drawRun) {
+                                drawGlyphRun();
+                                initializeGlyphRun(col, row);
+                                drawRun = false;
+                            }
+                            changeDecor(c.decor());
+                            state_.setDecor(c.decor());
                         }
-                        changeDecor(c.decor());
-                        state_.setDecor(c.decor());
                     }
                     // we don't care about the border at this stage
                     // draw the cell
@@ -406,10 +519,12 @@ namespace tpp {
                 drawGlyphRun();
             }
             
-            // determine the cursor, its visibility and its position and draw it if necessary. The cursor is drawn when it is not blinking, when its position has changed since last time it was drawn with blink on or if it is blinking and blink is visible. This prevents the cursor for disappearing while moving
+            // determine the cursor, its visibility and its position and draw it if necessary. The cursor is drawn when it is not blinking, when its position has changed since last time it was drawn with blink on or if it is blinking and blink is visible. This prevents the cursor for disappearing while moving. The cursor only blinks in active windows, otherwise it is always drawn
             Point cursorPos = buffer.cursorPosition();
             Canvas::Cursor cursor = buffer.cursor();
-            if (buffer.contains(cursorPos) && cursor.visible() && (! cursor.blink() || BlinkVisible() || cursorPos != lastCursorPos_)) {
+            bool cursorBlinks = buffer.contains(cursorPos) && cursor.visible() && cursor.blink() && powerState() == PowerState::Active;
+            blinking = blinking || cursorBlinks;
+            if (buffer.contains(cursorPos) && cursor.visible() && (! cursorBlinks || BlinkVisible() || cursorPos != lastCursorPos_)) {
                 state_.setCodepoint(cursor.codepoint());
                 state_.setFg(cursor.color());
                 state_.setBg(Color::None);
@@ -441,6 +556,11 @@ namespace tpp {
                 }
             }
             finalizeDraw();
+            blinking_ = blinking;
+            if (blinking)
+                StartBlinker();
+            phase.end();
+            StartupTrace::FrameRendered();
         }
 
         #undef initializeDraw
@@ -1,5 +1,12 @@
 #if (defined ARCH_UNIX && defined RENDERER_NATIVE)
+#include <climits>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 
+#include "helpers/char.h"
 #include "helpers/filesystem.h"
 #include "helpers/time.h"
 
@@ -17,6 +24,94 @@ namespace tpp {
             return 0;
         }
 
+        /** Request header sent by the client and the response of the server in single process mode. 
+
+            The header is followed by the size of the payload in bytes and a newline. The payload is the working directory of the client followed by its environment variables as `name=value`, each terminated by a NUL character. 
+         */
+        constexpr char const * WINDOW_REQUEST = "window ";
+        constexpr char const * WINDOW_RESPONSE = "ok\n";
+
+        /** Maximum size of the window request payload in bytes. 
+         */
+        constexpr size_t MAX_WINDOW_REQUEST_SIZE = 1024 * 1024;
+
+        /** Environment variables which describe the terminal the window was requested from and therefore do not apply to the new window, whose local PTY sets them itself. 
+         */
+        constexpr char const * TERMINAL_VARIABLES[] = { "TERM", "COLORTERM", "COLUMNS", "LINES", "TERMCAP" };
+
+        /** Timeout for the window request exchange, in milliseconds. 
+         */
+        constexpr int WINDOW_REQUEST_TIMEOUT = 500;
+
+        /** Reads up to size bytes from the socket, waiting at most WINDOW_REQUEST_TIMEOUT for each chunk. 
+
+            Only used by the client, which has no UI yet, the server reads the requests asynchronously. 
+         */
+        std::string ReadWithTimeout(int socket, size_t size) {
+            std::string result;
+            char buffer[64];
+            while (result.size() < size) {
+                pollfd p{socket, POLLIN, 0};
+                int ready = poll(& p, 1, WINDOW_REQUEST_TIMEOUT);
+                if (ready < 0 && errno == EINTR)
+                    continue;
+                if (ready <= 0)
+                    break;
+                ssize_t n = ::read(socket, buffer, std::min(sizeof(buffer), size - result.size()));
+                if (n <= 0)
+                    break;
+                result.append(buffer, n);
+            }
+            return result;
+        }
+
+        bool WriteAll(int socket, std::string const & what) {
+            for (size_t i = 0; i < what.size(); ) {
+                ssize_t n = ::send(socket, what.c_str() + i, what.size() - i, MSG_NOSIGNAL);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    return false;
+                i += n;
+            }
+            return true;
+        }
+
+        /** Returns true if the process on the other end of the unix socket runs under the same user. 
+         */
+        bool SameUser(int socket) {
+#if (defined SO_PEERCRED)
+            ucred cred;
+            socklen_t len = sizeof(cred);
+            return getsockopt(socket, SOL_SOCKET, SO_PEERCRED, & cred, & len) == 0 && cred.uid == getuid();
+#else
+            uid_t uid;
+            gid_t gid;
+            return getpeereid(socket, & uid, & gid) == 0 && uid == getuid();
+#endif
+        }
+
+        /** Returns the total size of the window request (header and payload), 0 if the header has not been received completely yet, or std::string::npos if the request is invalid. 
+         */
+        size_t WindowRequestSize(std::string const & received) {
+            size_t prefix = strlen(WINDOW_REQUEST);
+            if (received.compare(0, prefix, WINDOW_REQUEST, std::min(prefix, received.size())) != 0)
+                return std::string::npos;
+            size_t nl = received.find('\n', prefix);
+            // the size has at most 7 digits
+            if (nl == std::string::npos)
+                return received.size() > prefix + 7 ? std::string::npos : 0;
+            if (nl == prefix || nl > prefix + 7)
+                return std::string::npos;
+            size_t size = 0;
+            for (size_t i = prefix; i < nl; ++i) {
+                if (! IsDecimalDigit(received[i]))
+                    return std::string::npos;
+                size = size * 10 + DecCharToNumber(received[i]);
+            }
+            return size > MAX_WINDOW_REQUEST_SIZE ? std::string::npos : nl + 1 + size;
+        }
+
     } // anonymous namespace
 
     X11Application::X11Application():
@@ -86,7 +181,7 @@ namespace tpp {
     XSetClassHint(xDisplay_, broadcastWindow_, classHint);
     XFree(classHint);
 
-		X11Window::StartBlinkerThread();
+		X11Window::InitializeBlinker();
     }
 
 	X11Application::~X11Application() {
@@ -151,6 +246,8 @@ namespace tpp {
         mainLoopRunning_ = true;
         try {
             while (true) { 
+                if (server_ != -1 || settingsWatch_ != -1)
+                    waitForXEvent();
                 XNextEvent(xDisplay_, &e);
                 processXEvent(e);
             }
@@ -158,6 +255,235 @@ namespace tpp {
             // don't do anything
         }
         mainLoopRunning_ = false;
+        // the process is about to end, stop accepting window requests
+        if (server_ != -1) {
+            close(server_);
+            server_ = -1;
+            unlink(ServerSocketPath().c_str());
+        }
+        for (WindowRequest & r : windowRequests_)
+            close(r.socket);
+        windowRequests_.clear();
+        if (settingsWatch_ != -1) {
+            close(settingsWatch_);
+            settingsWatch_ = -1;
+        }
+    }
+
+    void X11Application::serveWindowRequests(std::function<void(std::string const & workingDirectory, Environment const & env)> openWindow) {
+        std::string path{ServerSocketPath()};
+        if (path.empty()) {
+            LOG() << "No private directory for the socket, single process mode disabled";
+            return;
+        }
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) {
+            LOG() << "Socket path " << path << " too long, single process mode disabled";
+            return;
+        }
+        strcpy(addr.sun_path, path.c_str());
+        int s = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        // the socket may exist either because another instance is listening, in which case it is not ours to remove, or because a previous instance crashed
+        if (s != -1 && connect(s, reinterpret_cast<sockaddr *>(& addr), sizeof(addr)) == 0) {
+            LOG() << "Another instance already listens on " << path;
+            close(s);
+            return;
+        }
+        if (s != -1)
+            close(s);
+        unlink(path.c_str());
+        s = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        // only the current user may ask for new windows, the socket is created with the right permissions so that nobody else can connect before they are set
+        mode_t mask = umask(S_IXUSR | S_IRWXG | S_IRWXO);
+        bool bound = s != -1 && bind(s, reinterpret_cast<sockaddr *>(& addr), sizeof(addr)) == 0;
+        umask(mask);
+        if (! bound || listen(s, 8) != 0) {
+            LOG() << "Unable to listen on " << path << ", errno " << errno;
+            if (s != -1)
+                close(s);
+            return;
+        }
+        server_ = s;
+        openWindow_ = openWindow;
+    }
+
+    bool X11Application::RequestWindow() {
+        std::string path{ServerSocketPath()};
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(addr.sun_path))
+            return false;
+        strcpy(addr.sun_path, path.c_str());
+        char cwd[PATH_MAX];
+        if (getcwd(cwd, sizeof(cwd)) == nullptr)
+            return false;
+        std::string payload{cwd};
+        payload.push_back('\0');
+        for (char ** x = environ; *x != nullptr; ++x) {
+            payload.append(*x);
+            payload.push_back('\0');
+        }
+        if (payload.size() > MAX_WINDOW_REQUEST_SIZE)
+            return false;
+        int s = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (s == -1)
+            return false;
+        // the environment is only sent to a terminal of the same user
+        bool result = connect(s, reinterpret_cast<sockaddr *>(& addr), sizeof(addr)) == 0
+            && SameUser(s)
+            && WriteAll(s, STR(WINDOW_REQUEST << payload.size() << "\n") + payload)
+            && ReadWithTimeout(s, strlen(WINDOW_RESPONSE)) == WINDOW_RESPONSE;
+        close(s);
+        return result;
+    }
+
+    /** XDG_RUNTIME_DIR is private to the user. Otherwise a directory in the temporary directory, which everyone can write to, is used. If the directory already exists, it must be a real directory owned by the user and inaccessible to others, so that nobody else could have created the socket. 
+     */
+    std::string X11Application::ServerSocketPath() {
+        // the display name may contain host and screen, but none of these are invalid in filenames, except the path separator
+        char const * display = getenv("DISPLAY");
+        std::string name{STR("terminalpp-" << getuid() << "-" << (display == nullptr ? "" : display) << ".sock")};
+        std::replace(name.begin(), name.end(), '/', '_');
+        char const * runtimeDir = getenv("XDG_RUNTIME_DIR");
+        if (runtimeDir != nullptr && runtimeDir[0] != 0)
+            return JoinPath(runtimeDir, name);
+        std::string dir{JoinPath(TempDir(), STR("terminalpp-" << getuid()))};
+        if (mkdir(dir.c_str(), S_IRWXU) != 0 && errno != EEXIST)
+            return std::string{};
+        struct stat s;
+        if (lstat(dir.c_str(), & s) != 0 || ! S_ISDIR(s.st_mode) || s.st_uid != getuid() || (s.st_mode & (S_IRWXG | S_IRWXO)) != 0) {
+            LOG() << "Directory " << dir << " is not private to the user";
+            return std::string{};
+        }
+        return JoinPath(dir, name);
+    }
+
+    void X11Application::watchSettings(std::string const & filename, std::function<void()> onChange) {
+        std::filesystem::path path{filename};
+        std::string dir = path.has_parent_path() ? path.parent_path().string() : std::string{"."};
+        int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd == -1 || inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1) {
+            LOG() << "Unable to watch " << dir << " for settings changes, errno " << errno;
+            if (fd != -1)
+                close(fd);
+            return;
+        }
+        settingsWatch_ = fd;
+        settingsFilename_ = path.filename().string();
+        onSettingsChange_ = onChange;
+    }
+
+    void X11Application::waitForXEvent() {
+        std::vector<pollfd> fds;
+        // events already read from the connection are not visible to poll
+        while (XPending(xDisplay_) == 0) {
+            // negative descriptors are ignored by poll
+            fds.clear();
+            fds.push_back(pollfd{ConnectionNumber(xDisplay_), POLLIN, 0});
+            fds.push_back(pollfd{server_, POLLIN, 0});
+            fds.push_back(pollfd{settingsWatch_, POLLIN, 0});
+            // wait for the pending window requests at most until the earliest of them times out
+            int timeout = -1;
+            auto now = std::chrono::steady_clock::now();
+            for (WindowRequest const & r : windowRequests_) {
+                fds.push_back(pollfd{r.socket, POLLIN, 0});
+                int remaining = static_cast<int>(std::max<long long>(0, std::chrono::duration_cast<std::chrono::milliseconds>(r.deadline - now).count()));
+                timeout = timeout < 0 ? remaining : std::min(timeout, remaining);
+            }
+            if (poll(fds.data(), fds.size(), timeout) < 0) {
+                if (errno == EINTR)
+                    continue;
+                // XNextEvent blocks until there is an X event
+                LOG() << "Unable to poll, errno " << errno;
+                return;
+            }
+            now = std::chrono::steady_clock::now();
+            for (size_t i = 3; i < fds.size(); ++i) {
+                WindowRequest & r = windowRequests_[i - 3];
+                if (fds[i].revents != 0) {
+                    readWindowRequest(r);
+                } else if (now >= r.deadline) {
+                    LOG() << "Window request timed out";
+                    close(r.socket);
+                    r.socket = -1;
+                }
+            }
+            windowRequests_.erase(std::remove_if(windowRequests_.begin(), windowRequests_.end(), [](WindowRequest const & r) { return r.socket == -1; }), windowRequests_.end());
+            if (fds[1].revents & POLLIN)
+                acceptWindowRequest();
+            if (fds[2].revents & POLLIN)
+                processSettingsEvents();
+        }
+    }
+
+    void X11Application::processSettingsEvents() {
+        alignas(inotify_event) char buffer[4096];
+        bool changed = false;
+        while (true) {
+            ssize_t n = read(settingsWatch_, buffer, sizeof(buffer));
+            if (n <= 0)
+                break;
+            for (char * i = buffer; i < buffer + n; ) {
+                inotify_event * e = reinterpret_cast<inotify_event *>(i);
+                if (e->len > 0 && settingsFilename_ == e->name)
+                    changed = true;
+                i += sizeof(inotify_event) + e->len;
+            }
+        }
+        // a single save may produce several events, the settings are reloaded only once
+        if (changed)
+            onSettingsChange_();
+    }
+
+    void X11Application::acceptWindowRequest() {
+        int client = accept4(server_, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+        if (client == -1)
+            return;
+        if (! SameUser(client)) {
+            LOG() << "Window request from another user refused";
+            close(client);
+            return;
+        }
+        windowRequests_.push_back(WindowRequest{client, "", std::chrono::steady_clock::now() + std::chrono::milliseconds{WINDOW_REQUEST_TIMEOUT}});
+    }
+
+    bool X11Application::readWindowRequest(WindowRequest & request) {
+        char buffer[4096];
+        ssize_t n = ::read(request.socket, buffer, sizeof(buffer));
+        if (n < 0 && (errno == EAGAIN || errno == EINTR))
+            return false;
+        size_t size = std::string::npos;
+        if (n > 0) {
+            request.received.append(buffer, n);
+            size = WindowRequestSize(request.received);
+            if (size == 0 || (size != std::string::npos && request.received.size() < size))
+                return false;
+        }
+        // the payload is the working directory followed by the environment, each terminated by NUL
+        std::vector<std::string> payload;
+        bool valid = size == request.received.size() && request.received.back() == '\0';
+        if (valid) {
+            size_t start = request.received.find('\n') + 1;
+            for (size_t end; start < size; start = end + 1) {
+                end = request.received.find('\0', start);
+                payload.push_back(request.received.substr(start, end - start));
+            }
+            valid = ! payload.empty();
+        }
+        if (valid)
+            WriteAll(request.socket, WINDOW_RESPONSE);
+        close(request.socket);
+        request.socket = -1;
+        if (valid) {
+            Environment env{Environment::Replacing(std::vector<std::string>{payload.begin() + 1, payload.end()})};
+            for (char const * name : TERMINAL_VARIABLES)
+                env.erase(name);
+            openWindow_(payload[0], env);
+        } else {
+            LOG() << "Invalid window request";
+        }
+        return true;
     }
 
     void X11Application::xSendEvent(X11Window * window, XEvent & e, long mask) {
@@ -260,7 +586,7 @@ namespace tpp {
             case ClientMessage:
                 if (e.xany.window == broadcastWindow_) {
                     if (static_cast<unsigned long>(e.xclient.message_type) == xAppEvent_) 
-                        eventQueue_.processEvent();
+                        eventQueue_.processEvents();
                     break;
                 }
                 // fallthrough
@@ -2,6 +2,8 @@
 #if (defined ARCH_UNIX && defined RENDERER_NATIVE)
 
 #include <atomic>
+#include <chrono>
+#include <vector>
 
 #include "x11.h"
 #include "../application.h"
@@ -60,6 +62,22 @@ namespace tpp {
 
         void mainLoop() override;
 
+        /** Listens on a unix socket specific to the user and X display. 
+
+            The socket is created in XDG_RUNTIME_DIR, or in a directory only accessible by the user in the temporary directory. Connections of other users are refused. 
+         */
+        void serveWindowRequests(std::function<void(std::string const & workingDirectory, Environment const & env)> openWindow) override;
+
+        /** Asks the terminal already running in single process mode on the same X display to open new window. 
+
+            The request contains the current working directory and environment of the process. Returns true if the request has been accepted, false if there is no such terminal, or if it does not run under the same user. Does not require the application to be initialized so that it is cheap to call at startup. 
+         */
+        static bool RequestWindow();
+
+        /** Watches the directory of the settings file with inotify, so that the file is detected whether it is rewritten in place, or replaced by a rename as many editors do. 
+         */
+        void watchSettings(std::string const & filename, std::function<void()> onChange) override;
+
     private:
 
         friend class X11Font;
@@ -69,6 +87,14 @@ namespace tpp {
 
         };
 
+        /* Connection of a client whose window request has not yet been received. */
+        class WindowRequest {
+        public:
+            int socket;
+            std::string received;
+            std::chrono::steady_clock::time_point deadline;
+        }; // X11Application::WindowRequest
+
         X11Application();
 
         /** Sends given X event. 
@@ -81,6 +107,32 @@ namespace tpp {
 
         void processXEvent(XEvent & e);
 
+        /** Waits until there is an X event to process, serving window requests and settings changes in the meantime. 
+         */
+        void waitForXEvent();
+
+        /** Accepts single window request connection on the server socket. 
+
+            The request itself is read when the client sends it so that a slow, or misbehaving client does not block the UI thread. 
+         */
+        void acceptWindowRequest();
+
+        /** Reads the window request from the client and once it has been received, replies and opens new window. 
+
+            Closes the connection and returns true if the request has been served, or is invalid. 
+         */
+        bool readWindowRequest(WindowRequest & request);
+
+        /** Reads the pending inotify events and calls the settings change handler once if any of them concerns the settings file. 
+         */
+        void processSettingsEvents();
+
+        /** Returns the path of the single process mode socket for current user and X display. 
+
+            Returns empty string if there is no directory in which the socket would be safe from other users. 
+         */
+        static std::string ServerSocketPath();
+
         
 		/* X11 display. */
 	    Display* xDisplay_;
@@ -120,6 +172,17 @@ namespace tpp {
         std::string selection_;
         X11Window * selectionOwner_;
 
+        /* Listening socket for window requests in single process mode, -1 if not listening. */
+        int server_ = -1;
+        std::function<void(std::string const & workingDirectory, Environment const & env)> openWindow_;
+        /* Accepted connections waiting for their requests. */
+        std::vector<WindowRequest> windowRequests_;
+
+        /* Inotify descriptor watching the settings directory, -1 if not watching. */
+        int settingsWatch_ = -1;
+        std::string settingsFilename_;
+        std::function<void()> onSettingsChange_;
+
 
     }; // X11Application
 
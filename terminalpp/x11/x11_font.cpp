@@ -1,10 +1,95 @@
 #if (defined ARCH_LINUX && defined RENDERER_NATIVE)
 #include <cmath>
+#include <sys/stat.h>
+
+#include "helpers/filesystem.h"
+#include "helpers/startup_trace.h"
 
 #include "x11_font.h"
 
 namespace tpp {
 
+    X11FontCache::X11FontCache(Display * display):
+        filename_{JoinPath(Config::GetSettingsFolder(), "font-cache.json")},
+        stamp_{Stamp(display)},
+        fonts_{JSON::Object()} {
+        std::ifstream f{filename_};
+        if (! f.good())
+            return;
+        try {
+            JSON cache{JSON::Parse(f)};
+            if (cache.hasKey("stamp") && cache["stamp"].toString() == stamp_ && cache.hasKey("fonts"))
+                fonts_ = cache["fonts"];
+            else 
+                LOG() << "Font cache " << filename_ << " is stale";
+        } catch (std::exception const & e) {
+            LOG() << "Unable to read font cache " << filename_ << ": " << e.what();
+        }
+    }
+
+    X11FontCache::~X11FontCache() {
+        TimerService::Token timer;
+        {
+            std::lock_guard<std::mutex> g{m_};
+            timer = saveTimer_;
+            saveTimer_ = 0;
+        }
+        // cancel without holding the lock as the timer may be waiting for it
+        if (timer != 0)
+            TimerService::Instance().cancel(timer);
+        std::lock_guard<std::mutex> g{m_};
+        save();
+    }
+
+    void X11FontCache::add(std::string const & key, JSON && entry) {
+        std::lock_guard<std::mutex> g{m_};
+        fonts_.add(key, std::move(entry));
+        dirty_ = true;
+        if (saveTimer_ == 0)
+            saveTimer_ = TimerService::Instance().schedule(std::chrono::milliseconds{SAVE_DELAY}, std::chrono::milliseconds{0}, [this](){
+                std::lock_guard<std::mutex> g{m_};
+                saveTimer_ = 0;
+                save();
+                return false;
+            });
+    }
+
+    void X11FontCache::save() {
+        if (! dirty_)
+            return;
+        dirty_ = false;
+        JSON cache{JSON::Object()};
+        cache.add("stamp", JSON{stamp_});
+        cache.add("fonts", fonts_);
+        CreatePath(Config::GetSettingsFolder());
+        std::ofstream f{filename_};
+        if (f.good())
+            f << cache;
+        else 
+            LOG() << "Unable to write font cache " << filename_;
+    }
+
+    std::string X11FontCache::Stamp(Display * display) {
+        // newest modification time of the fontconfig configuration files and font directories
+        long long newest = 0;
+        size_t files = 0;
+        for (FcStrList * list : { FcConfigGetConfigFiles(nullptr), FcConfigGetFontDirs(nullptr) }) {
+            if (list == nullptr)
+                continue;
+            while (FcChar8 * path = FcStrListNext(list)) {
+                struct stat s;
+                if (stat(pointer_cast<char const *>(path), & s) == 0)
+                    newest = std::max(newest, static_cast<long long>(s.st_mtime));
+                ++files;
+            }
+            FcStrListDone(list);
+        }
+        // X resources determine the rendering settings (dpi, hinting, antialiasing) which are part of the matched patterns
+        char const * resources = XResourceManagerString(display);
+        size_t resourcesHash = std::hash<std::string>{}(resources == nullptr ? "" : resources);
+        return STR(FcGetVersion() << "-" << newest << "-" << files << "-" << resourcesHash);
+    }
+
     std::unordered_map<XftFont*, unsigned> X11Font::ActiveFontsMap_;
     
     X11Font::X11Font(ui::Font font, int cellHeight, int cellWidth):
@@ -35,6 +120,47 @@ namespace tpp {
     }
 
     void X11Font::initializeFromPattern() {
+        StartupTrace::Phase phase{"font matching"};
+        // the requested pattern together with the cell width constraint determines the result
+        FcChar8 * name = FcNameUnparse(pattern_);
+        std::string key = STR(pointer_cast<char const *>(name) << "/" << fontSize_.width());
+        free(name);
+        if (! initializeFromCache(key)) {
+            matchPattern();
+            FcChar8 * matched = FcNameUnparse(xftFont_->pattern);
+            JSON entry{JSON::Object()};
+            entry.add("pattern", JSON{pointer_cast<char const *>(matched)});
+            entry.add("width", JSON{fontSize_.width()});
+            entry.add("offsetX", JSON{offset_.x()});
+            entry.add("offsetY", JSON{offset_.y()});
+            free(matched);
+            Cache().add(key, std::move(entry));
+        }
+        // now that we have correct font, initialize the rest of the properties
+        ascent_ = xftFont_->ascent;
+        // add underline and strikethrough metrics
+        underlineOffset_ = ascent_ + 1;
+        underlineThickness_ = font_.size();
+        strikethroughOffset_ = ascent_ * 2 / 3;
+        strikethroughThickness_ = font_.size();
+    }
+
+    bool X11Font::initializeFromCache(std::string const & key) {
+        JSON const * entry = Cache().find(key);
+        if (entry == nullptr)
+            return false;
+        FcPattern * matched = FcNameParse(pointer_cast<FcChar8 const *>((*entry)["pattern"].toString().c_str()));
+        if (matched == nullptr)
+            return false;
+        xftFont_ = OpenFont(matched);
+        if (xftFont_ == nullptr)
+            return false;
+        fontSize_.setWidth((*entry)["width"].toInt());
+        offset_ = ui::Point{(*entry)["offsetX"].toInt(), (*entry)["offsetY"].toInt()};
+        return true;
+    }
+
+    void X11Font::matchPattern() {
         X11Application * app = X11Application::Instance();
         double fontHeight = fontSize_.height();
         xftFont_ = MatchFont(pattern_);
@@ -79,13 +205,6 @@ namespace tpp {
             xftFont_ = MatchFont(pattern_);
             offset_.setY((fontSize_.height() - h) / 2);
         }
-        // now that we have correct font, initialize the rest of the properties
-        ascent_ = xftFont_->ascent;
-        // add underline and strikethrough metrics
-        underlineOffset_ = ascent_ + 1;
-        underlineThickness_ = font_.size();
-        strikethroughOffset_ = ascent_ * 2 / 3;
-        strikethroughThickness_ = font_.size();
     }
 
     XftFont * X11Font::MatchFont(FcPattern * pattern) {
@@ -97,20 +216,31 @@ namespace tpp {
         XftDefaultSubstitute(app->xDisplay_, app->xScreen_, configured);
         FcResult fcr;
         FcPattern * matched = FcFontMatch(nullptr, configured, & fcr);
-        if (matched == nullptr) {
-            FcPatternDestroy(configured);
+        FcPatternDestroy(configured);
+        if (matched == nullptr)
+            return nullptr;
+        return OpenFont(matched);
+    }
+
+    XftFont * X11Font::OpenFont(FcPattern * matched) {
+        XftFont * font = XftFontOpenPattern(X11Application::Instance()->xDisplay_, matched);
+        if (font == nullptr) {
+            FcPatternDestroy(matched);
             return nullptr;
         }
-        XftFont * font = XftFontOpenPattern(app->xDisplay_, matched);
         auto i = ActiveFontsMap_.find(font);
         if (i == ActiveFontsMap_.end())
             ActiveFontsMap_.insert(std::make_pair(font, 1));
         else 
             ++(i->second);
-        FcPatternDestroy(configured);
         return font;
     }
 
+    X11FontCache & X11Font::Cache() {
+        static X11FontCache cache{X11Application::Instance()->xDisplay_};
+        return cache;
+    }
+
 
     void X11Font::CloseFont(XftFont * font) {
         auto i = ActiveFontsMap_.find(font);
@@ -1,9 +1,12 @@
 #pragma once
 #if (defined ARCH_UNIX && defined RENDERER_NATIVE)
 
+#include <mutex>
 #include <unordered_map>
 
 #include "helpers/helpers.h"
+#include "helpers/json.h"
+#include "helpers/time.h"
 
 #include "x11.h"
 
@@ -14,6 +17,54 @@
 
 namespace tpp {
 
+    /** Persistent cache of matched fonts and their metrics. 
+
+        Matching a font pattern with fontconfig and opening it repeatedly until the font fits the cell is the most expensive part of the X11 renderer's startup. The cache remembers for each requested pattern (including fallback fonts for particular codepoints) the fully matched pattern and the cell metrics so that on a warm start the font can be opened directly. 
+        
+        The cache is stored in the settings folder and is keyed by a stamp of the fontconfig configuration (config files and font directories modification times) and the X resources, so that any change to the installed fonts, or their rendering settings invalidates it. 
+
+        Opening a window typically adds several entries at once (the font, its variants and fallback fonts), so the cache file is not written with each of them, but SAVE_DELAY after the first unsaved change, or when the cache is destroyed. 
+     */
+    class X11FontCache {
+    public:
+
+        /** Delay in milliseconds after which the added entries are saved. 
+         */
+        static constexpr size_t SAVE_DELAY = 1000;
+
+        explicit X11FontCache(Display * display);
+
+        ~X11FontCache();
+
+        /** Returns the cached entry for given key, or nullptr if not found. 
+         */
+        JSON const * find(std::string const & key) const {
+            return fonts_.hasKey(key) ? & fonts_[key] : nullptr;
+        }
+
+        /** Adds new entry to the cache and schedules saving of the cache file. 
+         */
+        void add(std::string const & key, JSON && entry);
+
+    private:
+
+        /** Writes the cache file if there are unsaved entries. Must be called with the mutex held. 
+         */
+        void save();
+
+        static std::string Stamp(Display * display);
+
+        std::string filename_;
+        std::string stamp_;
+        JSON fonts_;
+
+        /** Guards the entries against the timer saving them. */
+        std::mutex m_;
+        bool dirty_ = false;
+        TimerService::Token saveTimer_ = 0;
+
+    }; // tpp::X11FontCache
+
     class X11Font : public Font<X11Font> {
     public:
 
@@ -39,11 +90,25 @@ namespace tpp {
 
         void initializeFromPattern();
 
+        /** Opens the font from the cache entry for given key, if present. 
+         */
+        bool initializeFromCache(std::string const & key);
+
+        /** Matches the font pattern and adjusts its size so that the font fits the cell. 
+         */
+        void matchPattern();
+
         XftFont * xftFont_;
         FcPattern * pattern_;
 
         static XftFont * MatchFont(FcPattern * pattern);
 
+        /** Opens the already matched pattern, taking its ownership. 
+         */
+        static XftFont * OpenFont(FcPattern * matched);
+
+        static X11FontCache & Cache();
+
         static void CloseFont(XftFont * font);
 
         static std::unordered_map<XftFont*, unsigned> ActiveFontsMap_;
@@ -180,8 +180,8 @@ namespace tpp {
             NOT_IMPLEMENTED;        
     }
 
-    void X11Window::schedule(std::function<void()> event, Widget * widget) {
-        RendererWindow::schedule(event, widget);
+    void X11Window::schedule(Task event, Widget * widget) {
+        RendererWindow::schedule(std::move(event), widget);
         XEvent e;
         memset(&e, 0, sizeof(XEvent));
         e.type = ClientMessage;
@@ -408,6 +408,24 @@ namespace tpp {
 				ASSERT(window != nullptr);
 				window->focusOut();
 				break;
+            /* The window has been shown, or restored from being minimized. 
+             */
+            case MapNotify:
+                if (window != nullptr)
+                    window->setMapped(true);
+                break;
+            /* The window has been hidden, or minimized, in which case it does not have to render anything. 
+             */
+            case UnmapNotify:
+                if (window != nullptr)
+                    window->setMapped(false);
+                break;
+            /* The window has been fully obscured by other windows, or became at least partially visible. Compositing window managers may never report the window as obscured. 
+             */
+            case VisibilityNotify:
+                if (window != nullptr)
+                    window->setObscured(e.xvisibility.state == VisibilityFullyObscured);
+                break;
             /* Handles window resize, which should change the terminal size accordingly. 
              */  
             case ConfigureNotify: {
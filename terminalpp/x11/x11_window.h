@@ -37,7 +37,7 @@ namespace tpp {
             XDestroyWindow(display_, window_);
         }
 
-        void schedule(std::function<void()> event, Widget * widget) override;
+        void schedule(Task event, Widget * widget) override;
 
     protected:
 
@@ -0,0 +1,250 @@
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <map>
+#include <algorithm>
+
+#include "helpers/helpers.h"
+
+/** Simple tool which reads the Unicode Character Database files and produces a C++ header with lookup tables used by the `Char` class in helpers/char.h.
+
+    Two tables are generated:
+
+    - column widths of all codepoints stored as a two-level table. The codepoints are split into blocks of 256, the first level maps each block to its unique contents, which are stored in the second level with 2 bits per codepoint. Combining marks and format characters have width of 0, East Asian Wide and Fullwidth characters (which includes emoji with default emoji presentation) have width of 2, everything else is 1.
+    - canonical compositions of a base character and a combining mark, sorted so that they can be binary searched. As in NFC, characters with the Full_Composition_Exclusion property are never composed, i.e. those listed in CompositionExclusions.txt, singletons and non-starter decompositions. 
+
+    Usage:
+
+        unicodeTablesCpp output.inc.h UnicodeData.txt EastAsianWidth.txt CompositionExclusions.txt
+ */
+
+namespace {
+
+    static constexpr char32_t MAX_CODEPOINT = 0x110000;
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    std::string Trim(std::string const & str) {
+        size_t start = str.find_first_not_of(" \t\r\n");
+        if (start == std::string::npos)
+            return std::string{};
+        size_t end = str.find_last_not_of(" \t\r\n");
+        return str.substr(start, end - start + 1);
+    }
+
+    std::vector<std::string> Split(std::string const & str, char delimiter) {
+        std::vector<std::string> result;
+        std::stringstream s{str};
+        std::string item;
+        while (std::getline(s, item, delimiter))
+            result.push_back(item);
+        // trailing empty field
+        if (!str.empty() && str.back() == delimiter)
+            result.push_back(std::string{});
+        return result;
+    }
+
+    char32_t ParseCodepoint(std::string const & str) {
+        return static_cast<char32_t>(std::stoul(Trim(str), nullptr, 16));
+    }
+
+    /** Sets the width for codepoint ranges which are not explicitly listed in EastAsianWidth.txt, but default to wide as per the file's header.
+     */
+    void SetDefaultWideRanges(std::vector<uint8_t> & widths) {
+        std::pair<char32_t, char32_t> ranges[] = {
+            { 0x3400, 0x4dbf },
+            { 0x4e00, 0x9fff },
+            { 0xf900, 0xfaff },
+            { 0x20000, 0x2fffd },
+            { 0x30000, 0x3fffd },
+        };
+        for (auto & range : ranges)
+            for (char32_t cp = range.first; cp <= range.second; ++cp)
+                widths[cp] = 2;
+    }
+
+    /** Prepended concatenation marks are format characters, but are displayed and should therefore occupy a column.
+     */
+    bool IsDisplayedFormatCharacter(char32_t cp) {
+        return cp == 0xad || (cp >= 0x600 && cp <= 0x605) || cp == 0x6dd || cp == 0x70f || cp == 0x890 || cp == 0x891 || cp == 0x8e2 || cp == 0x110bd || cp == 0x110cd;
+    }
+
+} // anonymous namespace
+
+int main(int argc, char * argv[]) {
+    if (argc != 5) {
+        std::cerr << "Invalid arguments, usage:" << std::endl << std::endl;
+        std::cerr << "unicodeTablesCpp output.inc.h UnicodeData.txt EastAsianWidth.txt CompositionExclusions.txt" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string output = argv[1];
+    std::string unicodeData = argv[2];
+    std::string eastAsianWidth = argv[3];
+    std::string compositionExclusions = argv[4];
+    std::vector<uint8_t> widths(MAX_CODEPOINT, 1);
+    // canonical combining classes, used to exclude the non-starter decompositions
+    std::vector<uint8_t> combiningClasses(MAX_CODEPOINT, 0);
+    // (base, mark) -> composed
+    std::map<std::pair<char32_t, char32_t>, char32_t> compositions;
+    std::vector<bool> excluded(MAX_CODEPOINT, false);
+    std::string version = "unknown";
+    // east asian widths first
+    {
+        std::ifstream input(eastAsianWidth);
+        if (! input.good()) {
+            std::cerr << "Unable to open " << eastAsianWidth << std::endl;
+            return EXIT_FAILURE;
+        }
+        SetDefaultWideRanges(widths);
+        std::string line;
+        while (std::getline(input, line)) {
+            // the first line contains the version, i.e. # EastAsianWidth-14.0.0.txt
+            if (line.find("# EastAsianWidth-") == 0)
+                version = line.substr(17, line.find(".txt") - 17);
+            line = Trim(line.substr(0, line.find('#')));
+            if (line.empty())
+                continue;
+            std::vector<std::string> fields = Split(line, ';');
+            if (fields.size() < 2)
+                continue;
+            std::string kind = Trim(fields[1]);
+            size_t range = fields[0].find("..");
+            char32_t first = ParseCodepoint(fields[0].substr(0, range));
+            char32_t last = range == std::string::npos ? first : ParseCodepoint(fields[0].substr(range + 2));
+            for (char32_t cp = first; cp <= last; ++cp)
+                widths[cp] = (kind == "W" || kind == "F") ? 2 : 1;
+        }
+    }
+    // composition exclusions, which only contain the script specific and post composition version exclusions, the rest of Full_Composition_Exclusion is derived from the unicode data below
+    {
+        std::ifstream input(compositionExclusions);
+        if (! input.good()) {
+            std::cerr << "Unable to open " << compositionExclusions << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string line;
+        while (std::getline(input, line)) {
+            line = Trim(line.substr(0, line.find('#')));
+            if (line.empty())
+                continue;
+            size_t range = line.find("..");
+            char32_t first = ParseCodepoint(line.substr(0, range));
+            char32_t last = range == std::string::npos ? first : ParseCodepoint(line.substr(range + 2));
+            for (char32_t cp = first; cp <= last; ++cp)
+                excluded[cp] = true;
+        }
+    }
+    // zero width characters and compositions from unicode data
+    {
+        std::ifstream input(unicodeData);
+        if (! input.good()) {
+            std::cerr << "Unable to open " << unicodeData << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::string line;
+        char32_t rangeStart = 0;
+        while (std::getline(input, line)) {
+            line = Trim(line);
+            if (line.empty())
+                continue;
+            std::vector<std::string> fields = Split(line, ';');
+            if (fields.size() < 6)
+                continue;
+            char32_t cp = ParseCodepoint(fields[0]);
+            std::string const & name = fields[1];
+            std::string const & category = fields[2];
+            // ranges are given as two lines, <..., First> and <..., Last>
+            char32_t first = cp;
+            if (name.find(", First>") != std::string::npos) {
+                rangeStart = cp;
+                continue;
+            } else if (name.find(", Last>") != std::string::npos) {
+                first = rangeStart;
+            }
+            if (category == "Mn" || category == "Me" || (category == "Cf" && ! IsDisplayedFormatCharacter(cp)))
+                for (char32_t x = first; x <= cp; ++x)
+                    widths[x] = 0;
+            combiningClasses[cp] = static_cast<uint8_t>(std::stoul(fields[3]));
+            // canonical decompositions of two codepoints are the compositions, singletons are never composed
+            std::string decomposition = Trim(fields[5]);
+            if (! decomposition.empty() && decomposition[0] != '<' && ! excluded[cp]) {
+                std::vector<std::string> parts = Split(decomposition, ' ');
+                if (parts.size() == 2)
+                    compositions[std::make_pair(ParseCodepoint(parts[0]), ParseCodepoint(parts[1]))] = cp;
+            }
+        }
+        // non-starter decompositions, i.e. where either the composed character, or its first character is not a starter, are excluded as well, which can only be checked once all combining classes are known
+        for (auto i = compositions.begin(); i != compositions.end(); ) {
+            if (combiningClasses[i->second] != 0 || combiningClasses[i->first.first] != 0)
+                i = compositions.erase(i);
+            else
+                ++i;
+        }
+        // Hangul Jamo medial vowels and final consonants (U+1160..U+11FF and U+D7B0..U+D7FF) keep their width of 1, the terminal does not compose the conjoining jamo into syllables and they would disappear otherwise
+    }
+    // create the two level width table
+    std::vector<std::vector<uint8_t>> blocks;
+    std::vector<size_t> index;
+    for (char32_t start = 0; start < MAX_CODEPOINT; start += BLOCK_SIZE) {
+        std::vector<uint8_t> block(BLOCK_SIZE / 4, 0);
+        for (size_t i = 0; i < BLOCK_SIZE; ++i)
+            block[i / 4] |= static_cast<uint8_t>(widths[start + i] << ((i % 4) * 2));
+        auto i = std::find(blocks.begin(), blocks.end(), block);
+        index.push_back(i - blocks.begin());
+        if (i == blocks.end())
+            blocks.push_back(block);
+    }
+    if (blocks.size() > 256) {
+        std::cerr << "Too many unique blocks: " << blocks.size() << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::ofstream o(output);
+    if (! o.good()) {
+        std::cerr << "Unable to open file " << output << " to write the output to." << std::endl;
+        return EXIT_FAILURE;
+    }
+    o << "/* AUTOGENERATED FILE, DO NOT EDIT! \n";
+    o << "   This file was produced by the following command:\n";
+    o << "   unicodeTablesCpp " << output << " " << unicodeData << " " << eastAsianWidth << " " << compositionExclusions << "\n";
+    o << "\n   Unicode version " << version << "\n";
+    o << " */\n\n";
+    o << "#pragma once\n\n";
+    o << "#include <cstdint>\n\n";
+    o << "HELPERS_NAMESPACE_BEGIN\n\n";
+    o << "    class UnicodeTables {\n";
+    o << "    public:\n";
+    o << "        static constexpr char const * Version = \"" << version << "\";\n\n";
+    o << "        // index of the width block for each 256 codepoints\n";
+    o << "        static constexpr uint8_t WidthIndex[" << index.size() << "] = {";
+    for (size_t i = 0; i < index.size(); ++i) {
+        if (i % 32 == 0)
+            o << "\n            ";
+        o << index[i] << ",";
+    }
+    o << "\n        };\n\n";
+    o << "        // widths of the codepoints in each block, 2 bits per codepoint\n";
+    o << "        static constexpr uint8_t WidthBlocks[" << blocks.size() << "][" << (BLOCK_SIZE / 4) << "] = {" << std::hex;
+    for (auto const & block : blocks) {
+        o << "\n            {";
+        for (uint8_t x : block)
+            o << "0x" << static_cast<unsigned>(x) << ",";
+        o << "},";
+    }
+    o << std::dec << "\n        };\n\n";
+    o << "        // canonical compositions as (base << 42) | (mark << 21) | composed, sorted\n";
+    o << "        static constexpr uint64_t Compositions[" << compositions.size() << "] = {" << std::hex;
+    size_t n = 0;
+    for (auto const & c : compositions) {
+        if (n++ % 8 == 0)
+            o << "\n            ";
+        uint64_t x = (static_cast<uint64_t>(c.first.first) << 42) | (static_cast<uint64_t>(c.first.second) << 21) | c.second;
+        o << "0x" << x << ",";
+    }
+    o << std::dec << "\n        };\n";
+    o << "    }; // UnicodeTables\n\n";
+    o << "HELPERS_NAMESPACE_END\n";
+    std::cerr << "Done. " << blocks.size() << " width blocks, " << compositions.size() << " compositions" << std::endl;
+    return EXIT_SUCCESS;
+}
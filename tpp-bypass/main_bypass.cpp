@@ -22,6 +22,8 @@
 
 #include "stamp.h"
 
+#include "relay.h"
+
 /** The Windows ConPTY bypass via WSL
  
     The bypass creates a pseudoterminal in the WSL and relays any traffic on that terminal unchanged to the terminal connected via standard input and output, thus bypassing the Win32 ConPTY and its encoding and decoding of the escape sequences. This allows the terminal to use the terminal for linux applications in the same way it would on linux and spares it any issues the ConPTY might have. 
@@ -156,35 +158,24 @@ private:
 	 */
 	int translate() {
 		std::thread outputBypass{[this]() {
-			char * buffer = new char [bufferSize_];
-			while (true) {
-				int numBytes = 0;
-				while (true) {
-					numBytes = read(pipe_, (void*)buffer, bufferSize_);
-					if (numBytes == -1) {
-						if (errno == EINTR || errno == EAGAIN)
-						    continue;
-						numBytes = 0;
-					}
-					break;
-				}
-				if (numBytes == 0)
-				    break;
-				write(STDOUT_FILENO, (void*)buffer, numBytes);
+			OutputRelay relay{pipe_, STDOUT_FILENO, bufferSize_};
+			while (relay.relay() != 0) {
 			}
-            delete [] buffer;
 		}};
 		std::thread inputDecoder{[this]() {
+            InputDecoder decoder{pipe_, [this](unsigned cols, unsigned rows) { resize(cols, rows); }};
             char * buffer = new char[bufferSize_];
             char * bufferWrite = buffer;
             while (true) {
-                size_t numBytes = read(STDIN_FILENO, (void *) bufferWrite, bufferSize_ - (bufferWrite - buffer));
-                if (numBytes == 0)
+                ssize_t numBytes = read(STDIN_FILENO, (void *) bufferWrite, bufferSize_ - (bufferWrite - buffer));
+                if (numBytes < 0 && errno == EINTR)
+                    continue;
+                if (numBytes <= 0)
                     break;
                 numBytes += bufferWrite - buffer;
-                size_t processed = decodeInput(buffer, numBytes);
-                if (processed != numBytes) {
-                    memcpy(buffer, buffer + processed, numBytes - processed);
+                size_t processed = decoder.decode(buffer, numBytes);
+                if (processed != static_cast<size_t>(numBytes)) {
+                    memmove(buffer, buffer + processed, numBytes - processed);
                     bufferWrite = buffer + (numBytes - processed);
                 } else {
                     bufferWrite = buffer;
@@ -203,66 +194,6 @@ private:
 		return ec;
 	}
 
-    /** Input comes encoded and must be decoded and sent to the pty. 
-     */
-    size_t decodeInput(char * buffer, size_t bufferSize) {
-		
-#define WRITE(FROM, TO) if (FROM != TO) { write(pipe_, (void*)(buffer + FROM), TO - FROM); FROM = TO; }
-#define NEXT if (++i == bufferSize) return processed
-#define NUMBER(VAR) if (!ParseNumber(buffer, bufferSize, i, VAR)) return processed
-#define POP(WHAT) if (buffer[i++] != WHAT) { throw std::runtime_error(std::string("Expected ") + #WHAT + ", but found " + buffer[i]); }
-		size_t processed = 0;
-		size_t start = 0;
-		while (processed < bufferSize) {
-			if (buffer[processed] == '`') {
-				WRITE(start, processed);
-				size_t i = processed;
-				NEXT;
-				switch (buffer[i]) {
-					// if the character after backtick is backtick, the second backtick will be the beginning of next batch
-					case '`':
-						start = i;
-						processed = i + 1;
-						continue;
-					// the resize command (`r COLS : ROWS ;)
-					case 'r': {
-						unsigned cols;
-						unsigned rows;
-						NEXT;
-						NUMBER(cols);
-						POP(':');
-						NUMBER(rows);
-						POP(';');
-						resize(cols, rows);
-						processed = i;
-						start = processed;
-						continue;
-					// otherwise (unrecognized command) do an error
-					default:
-					    throw std::runtime_error(std::string("Unrecognized command") + buffer[i]);
-					}
-				}
-			} 
-			++processed;
-		}
-		WRITE(start, processed);
-		return processed;
-#undef WRITE
-#undef NEXT
-#undef NUMBER
-#undef POP
-    }
-
-	static bool ParseNumber(char* buffer, size_t bufferSize, size_t& i, unsigned& value) {
-		value = 0;
-		while (buffer[i] >= '0' && buffer[i] <= '9') {
-			value = value * 10 + (buffer[i] - '0');
-			if (++i == bufferSize)
-				return false;
-		}
-		return i != bufferSize; // at least one valid character must be present after the number
-	}
-
     std::vector<std::string> cmd_;
 	std::unordered_map<std::string, std::string> env_;
 	unsigned bufferSize_;
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/** Waits until the file descriptor is ready for given poll events, so that non-blocking descriptors are retried without spinning.
+
+    Returns false if the wait failed.
+ */
+inline bool WaitFor(int fd, short events) {
+    pollfd p{fd, events, 0};
+    while (poll(&p, 1, -1) < 0) {
+        if (errno != EINTR)
+            return false;
+    }
+    return true;
+}
+
+/** Writes the whole buffer to given file descriptor, retrying after short writes and interrupts.
+
+    If the descriptor is non-blocking and not writable, waits for it to become writable. Returns false if the write failed.
+ */
+inline bool WriteAll(int fd, char const * buffer, size_t numBytes) {
+    while (numBytes > 0) {
+        ssize_t written = write(fd, buffer, numBytes);
+        if (written < 0) {
+            if (errno == EINTR || ((errno == EAGAIN || errno == EWOULDBLOCK) && WaitFor(fd, POLLOUT)))
+                continue;
+            return false;
+        }
+        buffer += written;
+        numBytes -= written;
+    }
+    return true;
+}
+
+/** Writes all given buffers to the file descriptor with as few writev calls as possible, retrying after short writes and interrupts.
+
+    The buffers are updated to reflect the partial writes. Waits for non-blocking descriptors to become writable. Returns false if the write failed.
+ */
+inline bool WriteAll(int fd, struct iovec * iov, int iovCount) {
+    while (iovCount > 0) {
+        ssize_t written = writev(fd, iov, iovCount);
+        if (written < 0) {
+            if (errno == EINTR || ((errno == EAGAIN || errno == EWOULDBLOCK) && WaitFor(fd, POLLOUT)))
+                continue;
+            return false;
+        }
+        // skip the buffers written completely and adjust the first partially written one
+        while (iovCount > 0 && static_cast<size_t>(written) >= iov->iov_len) {
+            written -= iov->iov_len;
+            ++iov;
+            --iovCount;
+        }
+        if (iovCount > 0) {
+            iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+            iov->iov_len -= written;
+        }
+    }
+    return true;
+}
+
+/** Relays the output of the target command from its pseudoterminal to the output file unchanged.
+
+    On Linux the bytes are spliced from the pseudoterminal to a pipe and from the pipe to the output so that they never enter user space. If either end does not support splicing (the output may not be a pipe, or a terminal, and older kernels cannot splice from a pseudoterminal), the relay falls back to reading the bytes into a buffer and writing them out.
+ */
+class OutputRelay {
+public:
+
+    OutputRelay(int from, int to, size_t bufferSize, bool useSplice = true):
+        from_{from},
+        to_{to},
+        bufferSize_{bufferSize} {
+#if (defined SPLICE_F_MOVE)
+        if (useSplice && pipe(pipe_) == 0) {
+            // make the pipe hold a whole buffer, if possible, so that single splice can move it
+            fcntl(pipe_[1], F_SETPIPE_SZ, static_cast<int>(bufferSize_));
+        } else {
+            pipe_[0] = -1;
+            pipe_[1] = -1;
+        }
+#else
+        (void)useSplice;
+#endif
+    }
+
+    ~OutputRelay() {
+        if (pipe_[0] != -1) {
+            close(pipe_[0]);
+            close(pipe_[1]);
+        }
+        delete [] buffer_;
+    }
+
+    OutputRelay(OutputRelay const &) = delete;
+    OutputRelay & operator = (OutputRelay const &) = delete;
+
+    /** Returns true if the relay uses splice to move the bytes.
+     */
+    bool spliced() const {
+        return pipe_[0] != -1;
+    }
+
+    /** Waits for the output and relays all of it that is available.
+
+        Returns the number of bytes relayed, 0 when the input was closed, or the output failed.
+     */
+    size_t relay() {
+#if (defined SPLICE_F_MOVE)
+        if (pipe_[0] != -1) {
+            ssize_t numBytes = spliceRetry(from_, pipe_[1]);
+            if (numBytes > 0) {
+                // move everything from the pipe, partial splices to the output are retried
+                for (ssize_t left = numBytes; left > 0; ) {
+                    ssize_t moved = spliceRetry(pipe_[0], to_, left);
+                    if (moved > 0) {
+                        left -= moved;
+                        continue;
+                    }
+                    // if the output does not support splicing, copy the bytes already in the pipe and stop splicing
+                    if (moved < 0 && errno == EINVAL) {
+                        bool ok = drainPipe(left);
+                        stopSplicing();
+                        return ok ? static_cast<size_t>(numBytes) : 0;
+                    }
+                    return 0;
+                }
+                return static_cast<size_t>(numBytes);
+            }
+            // if the input does not support splicing, the pipe is empty and the copy can be used from now on
+            if (numBytes < 0 && errno == EINVAL) {
+                stopSplicing();
+                return copy();
+            }
+            return 0;
+        }
+#endif
+        return copy();
+    }
+
+private:
+
+#if (defined SPLICE_F_MOVE)
+    /** Splices from one descriptor to another, retrying on interrupts. Returns the number of bytes spliced, 0 on end of input and -1 on error.
+
+        One end is always the relay's pipe, if the other end would block, waits for it to become ready.
+     */
+    ssize_t spliceRetry(int from, int to, size_t numBytes = 0) {
+        while (true) {
+            ssize_t result = splice(from, nullptr, to, nullptr, numBytes == 0 ? bufferSize_ : numBytes, SPLICE_F_MOVE);
+            if (result < 0) {
+                if (errno == EINTR)
+                    continue;
+                if ((errno == EAGAIN || errno == EWOULDBLOCK) && (from == pipe_[0] ? WaitFor(to, POLLOUT) : WaitFor(from, POLLIN)))
+                    continue;
+            }
+            return result;
+        }
+    }
+
+    /** Copies given number of bytes left in the pipe to the output.
+     */
+    bool drainPipe(size_t numBytes) {
+        allocateBuffer();
+        while (numBytes > 0) {
+            ssize_t x = read(pipe_[0], buffer_, std::min(numBytes, bufferSize_));
+            if (x < 0 && errno == EINTR)
+                continue;
+            if (x <= 0 || ! WriteAll(to_, buffer_, x))
+                return false;
+            numBytes -= x;
+        }
+        return true;
+    }
+
+    void stopSplicing() {
+        close(pipe_[0]);
+        close(pipe_[1]);
+        pipe_[0] = -1;
+        pipe_[1] = -1;
+    }
+#endif
+
+    void allocateBuffer() {
+        if (buffer_ == nullptr)
+            buffer_ = new char[bufferSize_];
+    }
+
+    /** Reads the available bytes into the buffer and writes them to the output.
+     */
+    size_t copy() {
+        allocateBuffer();
+        while (true) {
+            ssize_t numBytes = read(from_, buffer_, bufferSize_);
+            if (numBytes < 0) {
+                if (errno == EINTR || ((errno == EAGAIN || errno == EWOULDBLOCK) && WaitFor(from_, POLLIN)))
+                    continue;
+                return 0;
+            }
+            if (numBytes == 0 || ! WriteAll(to_, buffer_, numBytes))
+                return 0;
+            return static_cast<size_t>(numBytes);
+        }
+    }
+
+    int from_;
+    int to_;
+    size_t bufferSize_;
+    int pipe_[2] = { -1, -1 };
+    char * buffer_ = nullptr;
+
+}; // OutputRelay
+
+/** Decodes the input of the bypass and writes it to the target command's pseudoterminal.
+
+    Extra commands (terminal resize) are encoded in the input using the backtick escape character. The input is scanned for the backtick with memchr and the plain segments between the commands are written to the pseudoterminal at once with writev when the whole buffer has been decoded, or before a command is executed so that the order of input and commands is preserved.
+ */
+class InputDecoder {
+public:
+
+    using ResizeHandler = std::function<void(unsigned cols, unsigned rows)>;
+
+    InputDecoder(int to, ResizeHandler resize):
+        to_{to},
+        resize_{resize} {
+    }
+
+    /** Decodes the buffer and returns the number of bytes processed.
+
+        Incomplete commands at the end of the buffer are not processed and should be decoded again when more input is available.
+     */
+    size_t decode(char * buffer, size_t bufferSize) {
+#define NEXT if (++i == bufferSize) { flush(); return processed; }
+#define NUMBER(VAR) if (!ParseNumber(buffer, bufferSize, i, VAR)) { flush(); return processed; }
+#define POP(WHAT) if (buffer[i++] != WHAT) { throw std::runtime_error(std::string("Expected ") + #WHAT + ", but found " + buffer[i]); }
+        size_t processed = 0;
+        size_t start = 0;
+        while (processed < bufferSize) {
+            char * escape = static_cast<char *>(memchr(buffer + processed, '`', bufferSize - processed));
+            if (escape == nullptr)
+                break;
+            processed = escape - buffer;
+            append(buffer + start, processed - start);
+            size_t i = processed;
+            NEXT;
+            switch (buffer[i]) {
+                // if the character after backtick is backtick, the second backtick will be the beginning of next batch
+                case '`':
+                    start = i;
+                    processed = i + 1;
+                    continue;
+                // the resize command (`r COLS : ROWS ;)
+                case 'r': {
+                    unsigned cols;
+                    unsigned rows;
+                    NEXT;
+                    NUMBER(cols);
+                    POP(':');
+                    NUMBER(rows);
+                    POP(';');
+                    flush();
+                    resize_(cols, rows);
+                    processed = i;
+                    start = processed;
+                    continue;
+                }
+                // otherwise (unrecognized command) do an error
+                default:
+                    throw std::runtime_error(std::string("Unrecognized command") + buffer[i]);
+            }
+        }
+        append(buffer + start, bufferSize - start);
+        flush();
+        return bufferSize;
+#undef NEXT
+#undef NUMBER
+#undef POP
+    }
+
+private:
+
+    void append(char * from, size_t numBytes) {
+        if (numBytes == 0)
+            return;
+        if (iov_.size() == IOV_MAX)
+            flush();
+        iov_.push_back(iovec{from, numBytes});
+    }
+
+    void flush() {
+        if (! iov_.empty()) {
+            WriteAll(to_, iov_.data(), static_cast<int>(iov_.size()));
+            iov_.clear();
+        }
+    }
+
+    static bool ParseNumber(char * buffer, size_t bufferSize, size_t & i, unsigned & value) {
+        value = 0;
+        while (buffer[i] >= '0' && buffer[i] <= '9') {
+            value = value * 10 + (buffer[i] - '0');
+            if (++i == bufferSize)
+                return false;
+        }
+        return i != bufferSize; // at least one valid character must be present after the number
+    }
+
+    int to_;
+    ResizeHandler resize_;
+    std::vector<iovec> iov_;
+
+}; // InputDecoder
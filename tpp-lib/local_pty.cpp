@@ -4,6 +4,9 @@
     #include <sys/wait.h>
     #include <sys/ioctl.h>
     #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <spawn.h>
     #if (defined ARCH_LINUX)
         #include <pty.h>
     #elif (defined ARCH_MACOS)
@@ -178,6 +181,8 @@ namespace tpp {
     LocalPTYMaster::~LocalPTYMaster() {
         terminate();
         waiter_.join();
+        close(wakeup_[0]);
+        close(wakeup_[1]);
     }
 
     void LocalPTYMaster::terminate() {
@@ -185,8 +190,13 @@ namespace tpp {
     }
 
     void LocalPTYMaster::start() {
-		// fork & open the pty
-		switch (pid_ = forkpty(&pipe_, nullptr, nullptr, nullptr)) {
+        environment_.unsetIfUnspecified("COLUMNS");
+        environment_.unsetIfUnspecified("LINES");
+        environment_.unsetIfUnspecified("TERMCAP");
+        environment_.setIfUnspecified("TERM", "xterm-256color");
+        environment_.setIfUnspecified("COLORTERM", "truecolor");
+		// spawn the process if possible, otherwise fork & open the pty
+		if (! spawn()) switch (pid_ = forkpty(&pipe_, nullptr, nullptr, nullptr)) {
 			// forkpty failed
 			case -1:
 			    OSCHECK(false) << "Fork failed";
@@ -195,12 +205,10 @@ namespace tpp {
 				setsid();
 				if (ioctl(1, TIOCSCTTY, nullptr) < 0)
 					UNREACHABLE;
-				environment_.unsetIfUnspecified("COLUMNS");
-				environment_.unsetIfUnspecified("LINES");
-				environment_.unsetIfUnspecified("TERMCAP");
-				environment_.setIfUnspecified("TERM", "xterm-256color");
-				environment_.setIfUnspecified("COLORTERM", "truecolor");
 				environment_.apply();
+				// a directory which no longer exists is not fatal, the command then starts in the current directory (nothing can be logged safely after fork)
+				if (! command_.workingDirectory().empty() && chdir(command_.workingDirectory().c_str()) != 0) {
+				}
 
 				signal(SIGCHLD, SIG_DFL);
 				signal(SIGHUP, SIG_DFL);
@@ -218,6 +226,13 @@ namespace tpp {
 			default:
 				break;
 		}
+        // writes to the pty are non-blocking so that the I/O thread can service both directions, the wakeup pipe interrupts its poll when there is new data to send
+        OSCHECK(fcntl(pipe_, F_SETFL, fcntl(pipe_, F_GETFL) | O_NONBLOCK) != -1) << "Unable to set non-blocking pty";
+        OSCHECK(pipe(wakeup_) != -1) << "Unable to create wakeup pipe";
+        for (int fd : wakeup_) {
+            OSCHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != -1);
+            OSCHECK(fcntl(fd, F_SETFD, FD_CLOEXEC) != -1);
+        }
 
         waiter_ = std::thread{[this](){
             pid_t x = waitpid(pid_, &exitCode_, 0);
@@ -225,11 +240,71 @@ namespace tpp {
             // it is ok to see errno ECHILD, happens when process has already been terminated
             if (x < 0 && errno != ECHILD) 
                 NOT_IMPLEMENTED; // error
-            // mark as terminated
+            // mark as terminated, nothing more will be sent, so release any blocked senders
             terminated_.store(true);
+            clearSendQueue();
         }};
     }
 
+    bool LocalPTYMaster::spawn() {
+        // only Linux makes the slave the controlling terminal of the session leader which opens it, other systems require TIOCSCTTY, which posix_spawn cannot issue, so the command is forked instead
+#if (defined POSIX_SPAWN_SETSID && defined ARCH_LINUX)
+        int master = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master < 0)
+            return false;
+        char slave[128];
+        bool ok = grantpt(master) == 0 && unlockpt(master) == 0 && fcntl(master, F_SETFD, FD_CLOEXEC) != -1 && ptsname_r(master, slave, sizeof(slave)) == 0;
+        if (! ok) {
+            close(master);
+            return false;
+        }
+        // the child becomes session leader, so opening the slave makes it its controlling terminal (without O_NOCTTY)
+        posix_spawn_file_actions_t actions;
+        posix_spawnattr_t attrs;
+        sigset_t defaultSignals;
+        sigset_t mask;
+        sigemptyset(& mask);
+        sigemptyset(& defaultSignals);
+        for (int signo : { SIGCHLD, SIGHUP, SIGINT, SIGQUIT, SIGTERM, SIGALRM })
+            sigaddset(& defaultSignals, signo);
+        posix_spawn_file_actions_init(& actions);
+        posix_spawnattr_init(& attrs);
+        ok = posix_spawn_file_actions_addopen(& actions, STDIN_FILENO, slave, O_RDWR, 0) == 0 &&
+            posix_spawn_file_actions_adddup2(& actions, STDIN_FILENO, STDOUT_FILENO) == 0 &&
+            posix_spawn_file_actions_adddup2(& actions, STDIN_FILENO, STDERR_FILENO) == 0 &&
+            posix_spawnattr_setflags(& attrs, POSIX_SPAWN_SETSID | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK) == 0 &&
+            posix_spawnattr_setsigdefault(& attrs, & defaultSignals) == 0 &&
+            posix_spawnattr_setsigmask(& attrs, & mask) == 0;
+        // the working directory can only be changed by a spawned process with posix_spawn_file_actions_addchdir_np, otherwise the command is forked
+        if (ok && ! command_.workingDirectory().empty()) {
+#if (defined __GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+            ok = posix_spawn_file_actions_addchdir_np(& actions, command_.workingDirectory().c_str()) == 0;
+#else
+            ok = false;
+#endif
+        }
+        std::vector<std::string> env = environment_.merged();
+        std::vector<char *> envp;
+        for (std::string & x : env)
+            envp.push_back(& x[0]);
+        envp.push_back(nullptr);
+        char ** argv = command_.toArgv();
+        int err = ok ? posix_spawnp(& pid_, command_.command().c_str(), & actions, & attrs, argv, envp.data()) : -1;
+        delete [] argv;
+        posix_spawnattr_destroy(& attrs);
+        posix_spawn_file_actions_destroy(& actions);
+        if (err != 0) {
+            LOG() << "Unable to spawn " << command_ << " (error " << err << "), using fork instead";
+            close(master);
+            return false;
+        }
+        pipe_ = master;
+        return true;
+#else
+        return false;
+#endif
+    }
+
     void LocalPTYMaster::resize(int cols, int rows) {
         struct winsize s;
         s.ws_row = rows;
@@ -241,26 +316,145 @@ namespace tpp {
     }
 
     void LocalPTYMaster::send(char const * buffer, size_t bufferSize) {
-		int nw = ::write(pipe_, (void*)buffer, bufferSize);
-        OSCHECK(nw >= 0 && static_cast<unsigned>(nw) == bufferSize);
+        send(buffer, bufferSize, /* bounded */ true);
+    }
+
+    void LocalPTYMaster::reply(char const * buffer, size_t bufferSize) {
+        send(buffer, bufferSize, /* bounded */ false);
+    }
+
+    void LocalPTYMaster::send(char const * buffer, size_t bufferSize, bool bounded) {
+        auto writer = [this](char const * b, size_t n) { return writeNonBlocking(b, n); };
+        if (queueSend(buffer, bufferSize, writer, bounded)) {
+            char x = 0;
+            // if the pipe is full, the I/O thread has already been woken up
+            if (::write(wakeup_[1], &x, 1) < 0 && errno != EAGAIN)
+                LOG() << "Unable to wake up the I/O thread, errno " << errno;
+        }
     }
 
     size_t LocalPTYMaster::receive(char * buffer, size_t bufferSize) {
+        auto writer = [this](char const * b, size_t n) { return writeNonBlocking(b, n); };
         while (true) {
-            int cnt = 0;
-            cnt = ::read(pipe_, (void*)buffer, bufferSize);
-            if (cnt == -1) {
-                if (errno == EINTR || errno == EAGAIN)
+            pollfd fds[2];
+            fds[0].fd = pipe_;
+            fds[0].events = POLLIN | (sendQueueSize() > 0 ? POLLOUT : 0);
+            fds[0].revents = 0;
+            fds[1].fd = wakeup_[0];
+            fds[1].events = POLLIN;
+            fds[1].revents = 0;
+            if (poll(fds, 2, -1) < 0) {
+                if (errno == EINTR)
                     continue;
                 return 0;
-            } else {
-                return static_cast<size_t>(cnt);
+            }
+            if (fds[1].revents & POLLIN) {
+                char x[64];
+                while (::read(wakeup_[0], x, sizeof(x)) > 0) { }
+            }
+            if (fds[0].revents & POLLOUT)
+                flushSendQueue(writer);
+            if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+                int cnt = ::read(pipe_, (void*)buffer, bufferSize);
+                if (cnt == -1) {
+                    if (errno == EINTR || errno == EAGAIN)
+                        continue;
+                    return 0;
+                } else {
+                    return static_cast<size_t>(cnt);
+                }
             }
         }
     }
 
+    size_t LocalPTYMaster::writeNonBlocking(char const * buffer, size_t numBytes) {
+        size_t written = 0;
+        while (written < numBytes) {
+            ssize_t nw = ::write(pipe_, buffer + written, numBytes - written);
+            if (nw >= 0) {
+                written += static_cast<size_t>(nw);
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            } else if (errno != EINTR) {
+                // the slave is gone, there is nobody to send the data to
+                LOG() << "Unable to write to pty, errno " << errno << ", discarding " << (numBytes - written) << " bytes";
+                return numBytes;
+            }
+        }
+        return written;
+    }
+
 #endif
 
+    // LocalPTYPool
+
+    LocalPTYPool::LocalPTYPool(Command const & command, size_t size):
+        command_{command},
+        size_{size} {
+        std::lock_guard<std::mutex> g{m_};
+        refill();
+    }
+
+    LocalPTYPool::~LocalPTYPool() {
+        {
+            std::lock_guard<std::mutex> g{m_};
+            stopping_ = true;
+        }
+        if (refiller_.joinable())
+            refiller_.join();
+        for (LocalPTYMaster * pty : idle_)
+            delete pty;
+    }
+
+    LocalPTYMaster * LocalPTYPool::acquire() {
+        std::lock_guard<std::mutex> g{m_};
+        LocalPTYMaster * result = nullptr;
+        while (result == nullptr && ! idle_.empty()) {
+            result = idle_.front();
+            idle_.pop_front();
+            // idle shells may have died in the meantime
+            if (result->terminated()) {
+                delete result;
+                result = nullptr;
+            }
+        }
+        refill();
+        return result;
+    }
+
+    void LocalPTYPool::refill() {
+        if (refilling_ || stopping_ || idle_.size() >= size_)
+            return;
+        // the previous refiller has already cleared the flag under the mutex, so it is about to finish
+        if (refiller_.joinable())
+            refiller_.join();
+        refilling_ = true;
+        refiller_ = std::thread{[this](){
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> g{m_};
+                    if (stopping_ || idle_.size() >= size_) {
+                        refilling_ = false;
+                        return;
+                    }
+                }
+                LocalPTYMaster * pty = nullptr;
+                try {
+                    pty = new LocalPTYMaster{command_};
+                } catch (std::exception const & e) {
+                    LOG() << "Unable to pre-spawn " << command_ << ": " << e.what();
+                }
+                std::lock_guard<std::mutex> g{m_};
+                if (pty != nullptr)
+                    idle_.push_back(pty);
+                if (pty == nullptr || stopping_) {
+                    refilling_ = false;
+                    return;
+                }
+            }
+        }};
+    }
+
     // LocalPTYSlave
 
 #if (defined ARCH_WINDOWS)
@@ -8,6 +8,9 @@
 #endif
 
 #include <thread>
+#include <deque>
+#include <mutex>
+#include <atomic>
 
 #include "pty.h"
 
@@ -22,6 +25,9 @@ namespace tpp {
 
         void terminate() override;
         void send(char const * buffer, size_t numBytes) override;
+#if (defined ARCH_UNIX)
+        void reply(char const * buffer, size_t numBytes) override;
+#endif
         size_t receive(char * buffer, size_t bufferSize) override;
         void resize(int cols, int rows) override;
 
@@ -29,6 +35,17 @@ namespace tpp {
 
         void start();
 
+#if (defined ARCH_UNIX)
+        /* Sends the data via the send queue and wakes up the I/O thread if the data has been queued. */
+        void send(char const * buffer, size_t numBytes, bool bounded);
+
+        /* Starts the command in a new session attached to a new pseudoterminal via posix_spawn, which unlike fork does not copy the address space of the terminal process. Returns false if the command has not been started, in which case forkpty should be used. Only supported on Linux, where the pseudoterminal becomes the controlling terminal of the command without TIOCSCTTY. */
+        bool spawn();
+
+        /* Writes as much of the buffer as possible without blocking and returns the number of bytes written. */
+        size_t writeNonBlocking(char const * buffer, size_t numBytes);
+#endif
+
         Command command_;
         Environment environment_;
 
@@ -59,10 +76,54 @@ namespace tpp {
 
         /* Pid of the process. */
 		pid_t pid_;
+
+        /* Self-pipe used to wake up the I/O thread blocked in receive() when data is added to the send queue. */
+        int wakeup_[2];
 #endif
 
     }; // tpp::LocalPTYMaster
 
+    /** Pool of idle pseudoterminals running the same command, spawned in advance. 
+
+        Starting a shell takes considerably longer than opening a tab, so sessions running the pool's command can take an already running shell from the pool instead. Whenever a pseudoterminal is taken, a replacement is spawned in a background thread.  
+     */
+    class LocalPTYPool {
+    public:
+
+        LocalPTYPool(Command const & command, size_t size);
+        ~LocalPTYPool();
+
+        Command const & command() const {
+            return command_;
+        }
+
+        /** Returns the number of idle pseudoterminals the pool keeps. 
+         */
+        size_t size() const {
+            return size_;
+        }
+
+        /** Returns an idle pseudoterminal running the pool's command, or nullptr if there is none. 
+
+            The caller takes ownership of the returned pseudoterminal. 
+         */
+        LocalPTYMaster * acquire();
+
+    private:
+
+        /* Spawns new pseudoterminals in the background until the pool is full, unless already doing so. Must be called with the mutex held. */
+        void refill();
+
+        Command command_;
+        size_t size_;
+        std::mutex m_;
+        std::deque<LocalPTYMaster *> idle_;
+        std::thread refiller_;
+        bool refilling_ = false;
+        bool stopping_ = false;
+
+    }; // tpp::LocalPTYPool
+
     class LocalPTYSlave : public PTYSlave {
     public:
 
@@ -1,6 +1,10 @@
 #pragma once 
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
 
 #include "helpers/process.h"
 #include "helpers/events.h"
@@ -45,11 +49,25 @@ namespace tpp {
 
     /** Pseudoterminal master. 
      
-        The master supports 
+        The master supports sending data to the slave and receiving its output, resizing the slave and terminating it. 
+
+        Masters which can write to the slave asynchronously use the send queue. When the data cannot be written immediately without blocking, they are appended to the queue and written later by the I/O thread, so that large pastes to slowly reading programs do not block the UI thread. The queue is bounded by MAX_SEND_QUEUE_SIZE, sending more data blocks the sender until there is enough space in the queue. Replies to the requests of the slave are not bounded as they are sent from the I/O thread itself, see reply().
      */
     class PTYMaster : public PTYBase {
     public:
 
+        /** Maximum number of bytes waiting in the send queue before senders are blocked. 
+         */
+        static constexpr size_t MAX_SEND_QUEUE_SIZE = 16 * 1024 * 1024;
+
+        /** Sends a reply to a request of the slave, such as a device status report. 
+
+            Replies are sent by the thread which receives the data from the slave, which for masters with a send queue is the thread that flushes the queue. Unlike send(), reply must therefore never block waiting for space in the queue. 
+         */
+        virtual void reply(char const * buffer, size_t numBytes) {
+            send(buffer, numBytes);
+        }
+
         /** Terminates the pseudoterminal. 
          */
         virtual void terminate() = 0;
@@ -72,6 +90,14 @@ namespace tpp {
             THROW(IOError()) << "Cannot obtain exit code of unterminated pseudoterminal's process";
         }
 
+        /** Returns the number of bytes sent, but not yet written to the slave. 
+
+            Can be used to display the progress of large pastes. 
+         */
+        size_t sendQueueSize() const {
+            return sendQueueSize_;
+        }
+
     protected:
 
         PTYMaster():
@@ -79,9 +105,76 @@ namespace tpp {
             exitCode_{0} {
         }
 
+        /** Sends the data through the send queue. 
+
+            If the queue is empty, the data is written immediately using the provided writer, which must not block and returns the number of bytes it has written. Whatever could not be written is appended to the queue. If the send is bounded, waits for space in the queue first, unbounded sends, i.e. the replies, are appended immediately. Returns true if data has been queued, in which case the I/O thread must be notified so that it flushes the queue when the slave is ready. 
+         */
+        template<typename WRITER>
+        bool queueSend(char const * buffer, size_t numBytes, WRITER writer, bool bounded = true) {
+            std::unique_lock<std::mutex> g{sendQueueMutex_};
+            if (sendQueue_.empty()) {
+                size_t written = writer(buffer, numBytes);
+                buffer += written;
+                numBytes -= written;
+                if (numBytes == 0)
+                    return false;
+            }
+            // a single send larger than the queue is allowed when the queue is empty 
+            if (bounded)
+                sendQueueReady_.wait(g, [this, numBytes](){
+                    return terminated_ || sendQueueSize_ == 0 || sendQueueSize_ + numBytes <= MAX_SEND_QUEUE_SIZE;
+                });
+            if (terminated_)
+                return false;
+            sendQueue_.emplace_back(buffer, numBytes);
+            sendQueueSize_ += numBytes;
+            return true;
+        }
+
+        /** Writes as much of the send queue as the writer accepts. 
+
+            Partially written chunks are resumed by the next flush. To be called from the I/O thread when the slave is ready to receive more data. 
+         */
+        template<typename WRITER>
+        void flushSendQueue(WRITER writer) {
+            std::lock_guard<std::mutex> g{sendQueueMutex_};
+            while (! sendQueue_.empty()) {
+                std::string const & chunk = sendQueue_.front();
+                size_t written = writer(chunk.c_str() + sendQueueOffset_, chunk.size() - sendQueueOffset_);
+                sendQueueOffset_ += written;
+                sendQueueSize_ -= written;
+                if (sendQueueOffset_ != chunk.size())
+                    break;
+                sendQueue_.pop_front();
+                sendQueueOffset_ = 0;
+            }
+            sendQueueReady_.notify_all();
+        }
+
+        /** Discards the send queue and wakes up any blocked senders. 
+
+            Must be called after the slave has been terminated.
+         */
+        void clearSendQueue() {
+            std::lock_guard<std::mutex> g{sendQueueMutex_};
+            sendQueue_.clear();
+            sendQueueOffset_ = 0;
+            sendQueueSize_ = 0;
+            sendQueueReady_.notify_all();
+        }
+
         std::atomic<bool> terminated_;
         ExitCode exitCode_;
 
+    private:
+
+        std::mutex sendQueueMutex_;
+        std::condition_variable sendQueueReady_;
+        std::deque<std::string> sendQueue_;
+        /* Number of bytes of the first chunk in the queue already written. */
+        size_t sendQueueOffset_ = 0;
+        std::atomic<size_t> sendQueueSize_{0};
+
     }; // tpp::PTYMaster
 
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <thread>
+#include <atomic>
 
 #include "pty.h"
 
@@ -15,7 +16,11 @@ namespace tpp {
     class PTYBuffer {
     public:
 
-        static constexpr size_t DEFAULT_BUFFER_SIZE = 1024;
+        /** Initial size of the input buffer. 
+         
+            Large enough so that the receiver can see more than a screenful of output at once when the PTY is flooded. 
+         */
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
         static constexpr size_t MAX_BUFFER_SIZE = 1024 * 1024;
 
         virtual ~PTYBuffer() {
@@ -27,6 +32,14 @@ namespace tpp {
             return pty_;
         }
 
+        /** Discards the input already received from the PTY, but not yet processed, up to its last line end. 
+
+            Useful when the user interrupts a program which produces a lot of output so that the output which has been generated before the interrupt does not have to be processed. The discard happens in the reader thread before the next chunk of input is processed, after which pendingInputDiscarded() is called. Line ends inside escape sequences are skipped so that the discard never cuts a sequence in half, see DiscardBoundary(). 
+         */
+        void discardPendingInput() {
+            discardPendingInput_ = true;
+        }
+
     protected:
 
         explicit PTYBuffer(T * pty):
@@ -40,6 +53,76 @@ namespace tpp {
             MARK_AS_UNUSED(exitCode);
         }
 
+        /** Called in the reader thread when pending input has been discarded. 
+
+            The discarded input may have started, or terminated escape sequences, so any parser state carried over between the received() calls must be reset. 
+         */
+        virtual void pendingInputDiscarded() {
+        }
+
+        /** Returns true if the receiver is in the middle of a string sequence (such as OSC, or DCS) whose terminator has not been received yet. 
+
+            The pending input then starts inside the sequence, which is taken into account when determining what can be discarded. Called from the reader thread only. 
+         */
+        virtual bool insideStringSequence() const {
+            return false;
+        }
+
+        /** Returns the end of the input between begin and end which can be discarded. 
+
+            This is the position after the last line end which is not part of an escape sequence, or begin if there is no such line end. CSI sequences end with their final byte, string sequences (OSC, DCS, APC, PM and SOS) with BEL, or ST. If insideString is true, the input is considered to start in the payload of a string sequence. 
+         */
+        static char * DiscardBoundary(char * begin, char * end, bool insideString) {
+            enum class State {
+                Text,
+                Escape,
+                CSI,
+                String,
+                StringEscape,
+            };
+            State state = insideString ? State::String : State::Text;
+            char * result = begin;
+            for (char * x = begin; x != end; ++x) {
+                char c = *x;
+                switch (state) {
+                    case State::Text:
+                        if (c == '\x1b')
+                            state = State::Escape;
+                        else if (c == '\n')
+                            result = x + 1;
+                        break;
+                    case State::Escape:
+                        if (c == '[')
+                            state = State::CSI;
+                        else if (c == ']' || c == 'P' || c == '_' || c == '^' || c == 'X')
+                            state = State::String;
+                        // ESC restarts the sequence and intermediate bytes are followed by the final byte
+                        else if (c != '\x1b' && (c < 0x20 || c > 0x2f))
+                            state = State::Text;
+                        break;
+                    case State::CSI:
+                        if (c == '\x1b')
+                            state = State::Escape;
+                        else if (c >= 0x40 && c <= 0x7e)
+                            state = State::Text;
+                        break;
+                    case State::String:
+                        if (c == '\x07')
+                            state = State::Text;
+                        else if (c == '\x1b')
+                            state = State::StringEscape;
+                        break;
+                    case State::StringEscape:
+                        if (c == '\\')
+                            state = State::Text;
+                        else if (c != '\x1b')
+                            state = State::String;
+                        break;
+                }
+            }
+            return result;
+        }
+
         void startPTYReader() {
             reader_ = std::thread{[this](){
                 size_t unprocessed = 0;
@@ -51,9 +134,27 @@ namespace tpp {
                     if (available == 0 && pty_->terminated())
                         break;
                     available += unprocessed;
-                    unprocessed = available - received(buffer, buffer + available);
+                    char * x = buffer;
+                    char * end = buffer + available;
+                    // the receiver may process only part of the input at a time (so that it does not block other threads for too long), keep calling it while it makes progress
+                    while (x != end) {
+                        if (discardPendingInput_.exchange(false)) {
+                            char * discardEnd = DiscardBoundary(x, end, insideStringSequence());
+                            if (discardEnd != x) {
+                                LOG() << "Discarding " << (discardEnd - x) << " bytes of pending input";
+                                x = discardEnd;
+                                pendingInputDiscarded();
+                            }
+                            continue;
+                        }
+                        size_t processed = received(x, end);
+                        if (processed == 0)
+                            break;
+                        x += processed;
+                    }
+                    unprocessed = end - x;
                     // copy the unprocessed bytes at the beginning of the buffer
-                    memcpy(buffer, buffer + available - unprocessed, unprocessed);
+                    memmove(buffer, x, unprocessed);
                     // grow the buffer if unprocessed == bufferSize
                     if (unprocessed == bufferSize) {
                         if (bufferSize < MAX_BUFFER_SIZE) {
@@ -84,14 +185,23 @@ namespace tpp {
             pty_->send(what, size);
         }
 
+        /** Sends a reply to a request received from the PTY. 
+
+            Unlike send(), never blocks, see PTYMaster::reply(). 
+         */
+        void reply(char const * what, size_t size) {
+            pty_->reply(what, size);
+        }
+
         T * pty_;
 
 
     private:
 
-
         std::thread reader_;
 
+        std::atomic<bool> discardPendingInput_{false};
+
     }; // tpp::PTYBuffer
 
 } // namespace tpp
\ No newline at end of file
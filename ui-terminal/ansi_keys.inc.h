@@ -2,6 +2,14 @@
 #error "KEY macro must be defined before including ansi_keys.inc.h"
 #endif
 
+// sequences used instead of the normal ones in the application cursor and keypad modes, ignored unless defined
+#ifndef KEY_CURSOR_APPLICATION
+#define KEY_CURSOR_APPLICATION(K, ...)
+#endif
+#ifndef KEY_KEYPAD_APPLICATION
+#define KEY_KEYPAD_APPLICATION(K, ...)
+#endif
+
 #define VT_MODIFIERS(K, SEQ1, SEQ2) KEY(K + Key::Shift, SEQ1 << 2 << SEQ2); \
                                     KEY(K + Key::Alt, SEQ1 << 3 << SEQ2); \
                                     KEY(K + Key::Shift + Key::Alt, SEQ1 << 4 << SEQ2); \
@@ -153,7 +161,35 @@ KEY(Key::SquareOpen + Key::Ctrl, "\033");
 KEY(Key::Backslash + Key::Ctrl, "\034");
 KEY(Key::SquareClose + Key::Ctrl, "\035");
 
+// application cursor mode (DECCKM), unmodified keys only
+KEY_CURSOR_APPLICATION(Key::Up, "\033OA");
+KEY_CURSOR_APPLICATION(Key::Down, "\033OB");
+KEY_CURSOR_APPLICATION(Key::Right, "\033OC");
+KEY_CURSOR_APPLICATION(Key::Left, "\033OD");
+KEY_CURSOR_APPLICATION(Key::Home, "\033OH");
+KEY_CURSOR_APPLICATION(Key::End, "\033OF");
+
+// application keypad mode (DECKPAM), unmodified keys only
+KEY_KEYPAD_APPLICATION(Key::Numpad0, "\033Op");
+KEY_KEYPAD_APPLICATION(Key::Numpad1, "\033Oq");
+KEY_KEYPAD_APPLICATION(Key::Numpad2, "\033Or");
+KEY_KEYPAD_APPLICATION(Key::Numpad3, "\033Os");
+KEY_KEYPAD_APPLICATION(Key::Numpad4, "\033Ot");
+KEY_KEYPAD_APPLICATION(Key::Numpad5, "\033Ou");
+KEY_KEYPAD_APPLICATION(Key::Numpad6, "\033Ov");
+KEY_KEYPAD_APPLICATION(Key::Numpad7, "\033Ow");
+KEY_KEYPAD_APPLICATION(Key::Numpad8, "\033Ox");
+KEY_KEYPAD_APPLICATION(Key::Numpad9, "\033Oy");
+KEY_KEYPAD_APPLICATION(Key::NumpadMul, "\033Oj");
+KEY_KEYPAD_APPLICATION(Key::NumpadAdd, "\033Ok");
+KEY_KEYPAD_APPLICATION(Key::NumpadComma, "\033Ol");
+KEY_KEYPAD_APPLICATION(Key::NumpadSub, "\033Om");
+KEY_KEYPAD_APPLICATION(Key::NumpadDot, "\033On");
+KEY_KEYPAD_APPLICATION(Key::NumpadDiv, "\033Oo");
+
 #undef VT_MODIFIERS
 #undef VT_KEY
 #undef VT_NUM
-#undef KEY
\ No newline at end of file
+#undef KEY
+#undef KEY_CURSOR_APPLICATION
+#undef KEY_KEYPAD_APPLICATION
\ No newline at end of file
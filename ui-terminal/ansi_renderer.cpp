@@ -11,6 +11,8 @@ namespace ui {
 
         void InitializeVTKeys(MatchingFSM<Key, char> & keys) {
 #define KEY(K, ...) { std::string x = STR(__VA_ARGS__); keys.addMatch(x.c_str(), K, /* override */ true); }
+#define KEY_CURSOR_APPLICATION(K, ...) KEY(K, __VA_ARGS__)
+#define KEY_KEYPAD_APPLICATION(K, ...) KEY(K, __VA_ARGS__)
 #include "ansi_keys.inc.h"
             // this is a hack, correctly matching invalid key does match the SGR mouse encoding
             keys.addMatch("\033[<", Key::Invalid); 
@@ -22,8 +22,8 @@ namespace ui {
 
     protected:
 
-        void schedule(std::function<void()> event, Widget * widget) override {
-            Renderer::schedule(event, widget);
+        void schedule(Task event, Widget * widget) override {
+            Renderer::schedule(std::move(event), widget);
             pushEvent(Event::User());
         }
 
@@ -65,7 +65,7 @@ namespace ui {
                     case Event::Kind::Terminate:
                         return;
                     case Event::Kind::User:
-                        eq_.processEvent();
+                        eq_.processEvents();
                         break;
                     case Event::Kind::Resize:
                         Renderer::resize(Size{e.payload.size.first, e.payload.size.second});
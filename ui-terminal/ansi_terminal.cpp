@@ -1,7 +1,9 @@
 #include <functional>
+#include <chrono>
 
 #include "helpers/memory.h"
 #include "helpers/base64.h"
+#include "helpers/startup_trace.h"
 
 #include "ansi_terminal.h"
 
@@ -15,24 +17,117 @@ namespace ui {
 
     namespace {
 
-        void InitializeKeyMap(std::unordered_map<Key, std::string> & keyMap) {
-#define KEY(K, ...) { std::string x = STR(__VA_ARGS__); keyMap.insert(std::make_pair(K, x)); }
+        /** Returns the table of sequences sent for the key presses. 
+         
+            The table is created when first used as the keys themselves are static objects in another translation unit. Printable keys are left out of the table as they are sent by the keyChar event. 
+         */
+        KeyTable const & KeyMap() {
+            static KeyTable keyMap{[]() {
+                KeyTable result;
+                // the first definition of a key wins so set() returning false is fine, but a sequence which does not fit in the table would be silently lost
+#define KEY(K, ...) { std::string x = STR(__VA_ARGS__); ASSERT(x.size() <= KeyTable::MAX_SEQUENCE_LENGTH) << "Sequence too long: " << x.size(); result.set(K, x.c_str(), x.size()); }
+#define KEY_CURSOR_APPLICATION(K, ...) { std::string x = STR(__VA_ARGS__); ASSERT(x.size() <= KeyTable::MAX_SEQUENCE_LENGTH) << "Sequence too long: " << x.size(); result.setCursorApplication(K, x.c_str(), x.size()); }
+#define KEY_KEYPAD_APPLICATION(K, ...) { std::string x = STR(__VA_ARGS__); ASSERT(x.size() <= KeyTable::MAX_SEQUENCE_LENGTH) << "Sequence too long: " << x.size(); result.setKeypadApplication(K, x.c_str(), x.size()); }
 #include "ansi_keys.inc.h"
+                for (unsigned k = 'A'; k <= 'Z'; ++k) {
+                    result.clear(Key::FromCode(k));
+                    result.clear(Key::FromCode(k) + Key::Shift);
+                }
+                for (unsigned k = '0'; k <= '9'; ++k)
+                    result.clear(Key::FromCode(k));
+                return result;
+            }()};
+            return keyMap;
+        }
+
+        bool IsNumpadKey(Key k) {
+            return k.code() >= Key::Numpad0.code() && k.code() <= Key::NumpadDiv.code();
         }
 
-        void InitializePrintableKeys(std::unordered_set<Key> & printableKeys) {
-            for (unsigned k = 'A'; k <= 'Z'; ++k) {
-                printableKeys.insert(Key::FromCode(k));
-                printableKeys.insert(Key::FromCode(k) + Key::Shift);
+        /** Returns the length of the valid UTF-8 encoded character at the given position, or 0 if the encoding is invalid, or incomplete. 
+         */
+        size_t ValidUTF8Length(char const * x, char const * end) {
+            unsigned char c = static_cast<unsigned char>(*x);
+            size_t length;
+            unsigned char min = 0x80;
+            unsigned char max = 0xbf;
+            if (c >= 0xc2 && c <= 0xdf) {
+                length = 2;
+            } else if (c >= 0xe0 && c <= 0xef) {
+                length = 3;
+                if (c == 0xe0)
+                    min = 0xa0;
+                else if (c == 0xed)
+                    max = 0x9f;
+            } else if (c >= 0xf0 && c <= 0xf4) {
+                length = 4;
+                if (c == 0xf0)
+                    min = 0x90;
+                else if (c == 0xf4)
+                    max = 0x8f;
+            } else {
+                return 0;
             }
-            for (unsigned k = '0'; k <= '9'; ++k) {
-                printableKeys.insert(Key::FromCode(k));
+            if (end - x < static_cast<ptrdiff_t>(length))
+                return 0;
+            unsigned char c1 = static_cast<unsigned char>(x[1]);
+            if (c1 < min || c1 > max)
+                return 0;
+            for (size_t i = 2; i < length; ++i)
+                if ((static_cast<unsigned char>(x[i]) & 0xc0) != 0x80)
+                    return 0;
+            return length;
+        }
+
+        /** Determines whether the input starts with a simple line that can be fast-forwarded and returns the position after it, or nullptr if it does not. 
+         
+            A simple line consists of valid UTF-8 text, tabs and SGR sequences only, is terminated by CR LF and fits in the given width without wrapping. Each codepoint is assumed to occupy a column, which may overestimate the width of lines with combining characters, but never underestimates it. 
+         */
+        char const * ScanSimpleLine(char const * x, char const * end, int width) {
+            int col = 0;
+            while (x != end) {
+                unsigned char c = static_cast<unsigned char>(*x);
+                if (c >= 0x20) {
+                    if (col >= width)
+                        return nullptr;
+                    if (c < 0x80) {
+                        ++x;
+                    } else {
+                        size_t length = ValidUTF8Length(x, end);
+                        if (length == 0)
+                            return nullptr;
+                        x += length;
+                    }
+                    ++col;
+                    continue;
+                }
+                switch (c) {
+                    case Char::TAB:
+                        if (col >= width)
+                            return nullptr;
+                        col = (col / 8 + 1) * 8;
+                        ++x;
+                        break;
+                    case Char::CR:
+                        if (x + 1 != end && x[1] == Char::LF)
+                            return x + 2;
+                        return nullptr;
+                    case Char::ESC:
+                        if (++x == end || *x != '[')
+                            return nullptr;
+                        while (++x != end && (IsDecimalDigit(*x) || *x == ';')) { }
+                        if (x == end || *x != 'm')
+                            return nullptr;
+                        ++x;
+                        break;
+                    default:
+                        return nullptr;
+                }
             }
+            return nullptr;
         }
     }
 
-    std::unordered_map<Key, std::string> AnsiTerminal::KeyMap_;
-    std::unordered_set<Key> AnsiTerminal::PrintableKeys_;
 
 
     Log AnsiTerminal::SEQ("VT100");
@@ -46,14 +141,10 @@ namespace ui {
     AnsiTerminal::AnsiTerminal(tpp::PTYMaster * pty, Palette && palette):
         PTYBuffer{pty},
         palette_{palette},
-        state_{new State{palette.defaultBackground()}},
-        stateBackup_{new State{palette.defaultBackground()}} {
-        if (KeyMap_.empty()) {
-            InitializeKeyMap(KeyMap_);
-            InitializePrintableKeys(PrintableKeys_);
-        }
-        state_->reset(palette_.defaultForeground(), palette_.defaultBackground());
-        stateBackup_->reset(palette_.defaultForeground(), palette_.defaultBackground());
+        state_{new State{DefaultCell()}},
+        stateBackup_{new State{DefaultCell()}} {
+        state_->reset(DefaultCell());
+        stateBackup_->reset(DefaultCell());
         setFocusable(true);
 
         startPTYReader();
@@ -61,6 +152,8 @@ namespace ui {
     }
 
     AnsiTerminal::~AnsiTerminal() {
+        if (pasteTimer_ != 0)
+            TimerService::Instance().cancel(pasteTimer_);
         terminatePty();
         delete state_;
         delete stateBackup_;
@@ -75,22 +168,35 @@ namespace ui {
 #endif
         Rect visibleRect{ccanvas.visibleRect()};
         std::lock_guard<PriorityLock> g(bufferLock_.priorityLock(), std::adopt_lock);
+        // the contents is being repainted, allow the PTY reader to parse next frame's worth of input
+        if (flowControl_ != 0) {
+            {
+                std::lock_guard<std::mutex> gf{flowControlMutex_};
+                parsedSinceRepaint_ = 0;
+            }
+            flowControlRepainted_.notify_all();
+        }
         int top = terminalBufferTop();
         ccanvas.setBg(palette_.defaultBackground());
         // see if there are any history lines that need to be drawn
         for (int row = std::max(0, visibleRect.top()), re = std::min(top, visibleRect.bottom()); row < re ; ++row) {
-            for (int col = 0, ce = historyRows_[row].first; col < ce; ++col) {
-                ccanvas.at(Point{col, row}).stripSpecialObjectAndAssign(historyRows_[row].second[col]);
+            std::pair<Cell const *, int> cells = history_.row(row);
+            for (int col = 0; col < cells.second; ++col) {
+                drawCell(ccanvas.at(Point{col, row}), cells.first[col]);
 #ifdef SHOW_LINE_ENDINGS
-                if (Buffer::IsLineEnd(historyRows_[row].second[col]))
+                if (Buffer::IsLineEnd(cells.first[col]))
                     ccanvas.setBorder(Point{col, row}, endOfLine);
 #endif
             }
-            ccanvas.fill(Rect{Point{historyRows_[row].first, row}, Point{width(), row + 1}},
+            ccanvas.fill(Rect{Point{cells.second, row}, Point{width(), row + 1}},
             Cell{}.setBg(ccanvas.bg()));
         }
         // TODO once we support sixels or other shared objects that might survive to the drawing stage, this function will likely change.
-        ccanvas.drawFallbackBuffer(state_->buffer, Point{0, top});
+        Buffer const & buffer = state_->buffer;
+        for (int row = std::max(top, visibleRect.top()), re = std::min(top + buffer.height(), visibleRect.bottom()); row < re; ++row) {
+            for (int col = std::max(0, visibleRect.left()), ce = std::min(buffer.width(), visibleRect.right()); col < ce; ++col)
+                drawCell(ccanvas.at(Point{col, row}), buffer.at(Point{col, row - top}));
+        }
 #ifdef  SHOW_LINE_ENDINGS
         // now add borders to the cells that are marked as end of line
         for (int row = std::max(top, visibleRect.top()), rs = row, re = visibleRect.bottom(); ; ++row) {
@@ -119,13 +225,46 @@ namespace ui {
     // User Input
 
     void AnsiTerminal::pasteContents(std::string const & contents) {
-        if (bracketedPaste_) {
-            send("\033[200~", 6);
-            send(contents.c_str(), contents.size());
-            send("\033[201~", 6);
-        } else {
-            send(contents.c_str(), contents.size());
+        // a paste in progress and a small paste are sent as any other input
+        if (! pendingPaste_.empty() || contents.size() <= PASTE_CHUNK_SIZE) {
+            if (bracketedPaste_) {
+                send("\033[200~", 6);
+                send(contents.c_str(), contents.size());
+                send("\033[201~", 6);
+            } else {
+                send(contents.c_str(), contents.size());
+            }
+            if (pendingPaste_.empty()) {
+                VoidEvent::Payload p;
+                onPasteDone(p, this);
+            }
+            return;
+        }
+        pendingPaste_ = bracketedPaste_ ? STR("\033[200~" << contents << "\033[201~") : contents;
+        pendingPasteOffset_ = 0;
+        continuePaste();
+    }
+
+    void AnsiTerminal::continuePaste() {
+        pasteTimer_ = 0;
+        while (pendingPasteOffset_ < pendingPaste_.size() && pty_->sendQueueSize() < PASTE_CHUNK_SIZE) {
+            size_t n = std::min(PASTE_CHUNK_SIZE, pendingPaste_.size() - pendingPasteOffset_);
+            PTYBuffer::send(pendingPaste_.c_str() + pendingPasteOffset_, n);
+            pendingPasteOffset_ += n;
         }
+        if (pendingPasteOffset_ == pendingPaste_.size()) {
+            pendingPaste_.clear();
+            pendingPasteOffset_ = 0;
+            VoidEvent::Payload p;
+            onPasteDone(p, this);
+            return;
+        }
+        pasteTimer_ = TimerService::Instance().schedule(std::chrono::milliseconds{PASTE_INTERVAL}, std::chrono::milliseconds{0}, [this](){
+            schedule([this](){
+                continuePaste();
+            });
+            return false;
+        });
     }
 
     void AnsiTerminal::keyDown(KeyEvent::Payload & e) {
@@ -139,24 +278,17 @@ namespace ui {
                 && *e != Key::CtrlKey + Key::Ctrl
                 && *e != Key::WinKey + Key::Win)
                 setScrollOffset(Point{0, historyRows()});
-            auto i = KeyMap_.find(*e);
-            // only emit keyDown for non-printable keys as printable keys will go through the keyCHar event
-            if (i != KeyMap_.end() && PrintableKeys_.find(*e) == PrintableKeys_.end()) {
-                std::string const * seq = &(i->second);
-                if ((cursorMode_ == CursorMode::Application &&
-                    e->modifiers() == Key::Invalid) && (
-                    e->key() == Key::Up ||
-                    e->key() == Key::Down ||
-                    e->key() == Key::Left ||
-                    e->key() == Key::Right ||
-                    e->key() == Key::Home ||
-                    e->key() == Key::End)) {
-                        std::string sa(*seq);
-                        sa[1] = 'O';
-                        send(sa.c_str(), sa.size());
-                } else {
-                        send(seq->c_str(), seq->size());
-                }
+            bool applicationKeypad = keypadMode_ == KeypadMode::Application;
+            KeyTable::Sequence const & seq = KeyMap().get(*e, cursorMode_ == CursorMode::Application, applicationKeypad);
+            suppressKeyChar_ = false;
+            // printable keys are not in the table as they go through the keyChar event
+            if (! seq.empty()) {
+                send(seq.data(), seq.size());
+                // with flow control, Ctrl+C also discards the output of the interrupted program which has not been parsed yet
+                if (flowControl_ != 0 && seq == "\x03")
+                    discardPendingInput();
+                // numeric keypad keys produce characters as well, which must not be sent in the application keypad mode
+                suppressKeyChar_ = applicationKeypad && e->modifiers() == Key::Invalid && IsNumpadKey(*e);
             }
         }
         // don't propagate to parent as the terminal handles keyboard input itself
@@ -164,11 +296,16 @@ namespace ui {
 
     void AnsiTerminal::keyUp(KeyEvent::Payload & e) {
         onKeyUp(e, this);
+        suppressKeyChar_ = false;
         // don't propagate to parent as the terminal handles keyboard input itself
     }
 
     void AnsiTerminal::keyChar(KeyCharEvent::Payload & e) {
         onKeyChar(e, this);
+        if (suppressKeyChar_) {
+            suppressKeyChar_ = false;
+            return;
+        }
         if (e.active()) {
             ASSERT(e->codepoint() >= 32);
             send(e->toCharPtr(), e->size());
@@ -260,7 +397,7 @@ namespace ui {
     void AnsiTerminal::mouseWheel(MouseWheelEvent::Payload & e) {
         onMouseWheel(e, this);
         if (e.active()) {
-            if (! alternateMode_ && historyRows_.size() > 0) {
+            if (! alternateMode_ && historyRows() > 0) {
                 if (e->by > 0)
                     scrollBy(Point{0, -3});
                 else
@@ -344,16 +481,17 @@ namespace ui {
         int endRow = sel.end().y();
         int col = sel.start().x();
         std::lock_guard<PriorityLock> g(bufferLock_);
-        int terminalTop =  alternateMode_ ? 0 : static_cast<int>(historyRows_.size());
+        int terminalTop = terminalBufferTop();
         while (row < endRow) {
             int endCol = (row < endRow - 1) ? width() : sel.end().x();
-            Cell * rowCells;
+            Cell const * rowCells;
             // if the current row comes from the history, get the appropriate cells
             if (row < terminalTop) {
-                rowCells = historyRows_[row].second;
+                std::pair<Cell const *, int> cells = history_.row(row);
+                rowCells = cells.first;
                 // if the stored row is shorter than the start of the selection, adjust the endCol so that no processing will be involved
-                if (endCol > historyRows_[row].first)
-                    endCol = historyRows_[row].first;
+                if (endCol > cells.second)
+                    endCol = cells.second;
             } else {
                 rowCells = state_->buffer.row(row - terminalTop);
             }
@@ -453,45 +591,61 @@ namespace ui {
         size_t matchSize = urlMatcher_.next(next);
         if (matchSize == 0)
             return;
-        // we have found a hyperlink, construct its address and determine which cells to use, which we do by retracting
-        Hyperlink::Ptr link{new Hyperlink{"", normalHyperlinkStyle_, activeHyperlinkStyle_}};
-        std::string url{};
+        // we have found a hyperlink which ends just before the cursor, if it starts above the buffer, it is too long and has disappeared so it is not matched
+        int width = state_->buffer.width();
         Point pos = cursorPosition();
-        do {
-            // the url is too long and disappeared, do not match
-            if (pos == Point{0,0}) {
-                link->detachFromAllCells();
-                return;
+        int64_t start = static_cast<int64_t>(pos.y()) * width + pos.x() - static_cast<int64_t>(matchSize);
+        if (start < 0)
+            return;
+        // read the url and attach the hyperlink to its cells one row at a time
+        Hyperlink::Ptr link{new Hyperlink{"", normalHyperlinkStyle_, activeHyperlinkStyle_}};
+        urlBuffer_.clear();
+        int row = static_cast<int>(start / width);
+        int col = static_cast<int>(start % width);
+        while (matchSize != 0) {
+            int cols = static_cast<int>(std::min(matchSize, static_cast<size_t>(width - col)));
+            Cell * cells = state_->buffer.row(row) + col;
+            // the url matcher only matches ASCII characters
+            for (int i = 0; i < cols; ++i)
+                urlBuffer_.push_back(static_cast<char>(cells[i].codepoint()));
+            Cell::AttachSpecialObject(cells, cells + cols, link);
+            matchSize -= cols;
+            ++row;
+            col = 0;
+        }
+        link->setUrl(urlBuffer_);
+    }
+
+    /** Every glyph, including the double width ones, occupies a single cell, so the matched cells are the pattern length cells ending with the last glyph. Each match sends its own notification. 
+     */
+    void AnsiTerminal::matchTriggers() {
+        int width = state_->buffer.width();
+        int64_t end = static_cast<int64_t>(state_->lastGlyph.y()) * width + state_->lastGlyph.x() + 1;
+        triggerMatcher_.forEachMatch([&](size_t index) {
+            Trigger const & trigger = triggers_[index];
+            if (trigger.notify)
+                parseNotification();
+            // the beginning of a long match may have scrolled out of the buffer already
+            int64_t start = std::max(end - static_cast<int64_t>(triggerMatcher_.patternLength(index)), static_cast<int64_t>(0));
+            for (int64_t i = start; i < end; ++i) {
+                // the style blends with the cell's colors, which must be resolved first
+                Cell & cell = state_->buffer.row(static_cast<int>(i / width))[i % width];
+                resolveColors(cell);
+                trigger.style.applyTo(cell);
             }
-            if (pos.x() == 0)
-                pos = Point{state_->buffer.width() - 1, pos.y() - 1};
-            else
-                pos -= Point{1, 0};
-            Cell & cell = state_->buffer.at(pos);
-            url = Char{cell.codepoint()} + url;
-            cell.attachSpecialObject(link);
-        } while (--matchSize != 0);
-        // set the url we calculated
-        link->setUrl(url);
+        });
     }
 
     // Terminal State
 
+    /** The cells are shifted as they are, including their end of line marks. 
+     */
     void AnsiTerminal::deleteCharacters(unsigned num) {
-		int r = cursorPosition().y();
-		for (unsigned c = cursorPosition().x(), e = state_->buffer.width() - num; c < e; ++c)
-			state_->buffer.at(c, r) = state_->buffer.at(c + num, r);
-		for (unsigned c = state_->buffer.width() - num, e = state_->buffer.width(); c < e; ++c)
-			state_->buffer.at(c, r) = state_->cell;
+        state_->buffer.deleteCells(cursorPosition().y(), cursorPosition().x(), static_cast<int>(std::min(num, static_cast<unsigned>(state_->buffer.width()))), state_->cell);
     }
 
     void AnsiTerminal::insertCharacters(unsigned num) {
-		unsigned r = cursorPosition().y();
-		// first copy the characters
-		for (unsigned c = state_->buffer.width() - 1, e = cursorPosition().x() + num; c >= e; --c)
-			state_->buffer.at(c, r) = state_->buffer.at(c - num, r);
-		for (unsigned c = cursorPosition().x(), e = cursorPosition().x() + num; c < e; ++c)
-			state_->buffer.at(c, r) = state_->cell;
+        state_->buffer.insertCells(cursorPosition().y(), cursorPosition().x(), static_cast<int>(std::min(num, static_cast<unsigned>(state_->buffer.width()))), state_->cell);
     }
 
     void AnsiTerminal::updateCursorPosition() {
@@ -516,81 +670,111 @@ namespace ui {
         stateBackup_->buffer.cursor() = value;
     }
 
+    /** The palette colors are resolved when painted, so the cells do not have to be changed. 
+     */
+    void AnsiTerminal::setPalette(Palette const & value) {
+        if (palette_.size() == value.size() && palette_.defaultForeground() == value.defaultForeground() && palette_.defaultBackground() == value.defaultBackground()) {
+            size_t i = 0;
+            while (i < value.size() && palette_[i] == value[i])
+                ++i;
+            if (i == value.size())
+                return;
+        }
+        {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            palette_ = value;
+        }
+        repaint();
+    }
+
+    void AnsiTerminal::setTriggers(std::vector<Trigger> const & value) {
+        std::vector<Trigger> triggers;
+        TriggerMatcher matcher;
+        for (Trigger const & trigger : value) {
+            // zero width characters are not written to the cells and therefore never matched
+            std::u32string pattern;
+            for (char const * i = trigger.pattern.c_str(), * e = i + trigger.pattern.size(); i < e; ) {
+                char32_t cp = Char::FromUTF8(i, e).codepoint();
+                if (Char::ColumnWidth(cp) != 0)
+                    pattern.push_back(cp);
+            }
+            if (pattern.empty())
+                continue;
+            triggers.push_back(trigger);
+            matcher.add(pattern);
+        }
+        matcher.compile();
+        std::lock_guard<PriorityLock> g{bufferLock_};
+        triggers_ = std::move(triggers);
+        triggerMatcher_ = std::move(matcher);
+    }
+
     // Scrollback buffer
 
+    /** The lines are inserted at once, which for the whole screen only rotates the buffer's rows. 
+     */
     void AnsiTerminal::insertLines(int lines, int top, int bottom, Cell const & fill) {
-        while (lines-- > 0)
-            state_->buffer.insertLine(top, bottom, fill);
+        state_->buffer.insertRows(top, bottom, lines, fill);
+        // the last glyph may have moved, combining marks must not be composed with whatever is now in its place
+        state_->lastGlyph = Point{-1, -1};
     }
 
-    /** If history is enabled, i.e. when history limit is greater than 0 and the terminal is not in alternate mode, the deleted line is added to the history.
+    /** If history is enabled, i.e. when history limit is greater than 0 and the terminal is not in alternate mode, the deleted lines are added to the history. The lines are then deleted at once, which for the whole screen only rotates the buffer's rows. 
      */
     void AnsiTerminal::deleteLines(int lines, int top, int bottom, Cell const & fill) {
-        // scroll the lines
-        while (lines-- > 0) {
-            if (! alternateMode_ && maxHistoryRows_ != 0) {
-                auto removedRow = state_->buffer.copyRow(top, palette_.defaultBackground());
+        lines = std::min(lines, bottom - top);
+        if (! alternateMode_ && maxHistoryRows_ != 0) {
+            for (int row = top, e = top + lines; row < e; ++row) {
+                auto removedRow = state_->buffer.copyRow(row, PaletteColor(DEFAULT_BACKGROUND));
                 addHistoryRow(removedRow.first, removedRow.second);
             }
-            state_->buffer.deleteLine(top, bottom, fill);
         }
+        state_->buffer.deleteRows(top, bottom, lines, fill);
+        state_->lastGlyph = Point{-1, -1};
     }
 
-    /** If the terminal is scrolled into view, scrolls the terminal into view after the history line has been added as well.
+    /** The row is appended to the last history line unless that line has already been terminated. If the terminal is scrolled into view, scrolls the terminal into view after the history row has been added as well.
      */
     void AnsiTerminal::addHistoryRow(Cell * row, int cols) {
-        if (cols <= width()) {
-            historyRows_.push_back(std::make_pair(cols, row));
-        // if the line is too long, simply chop it in pieces of maximal length
-        } else {
-            Cell * i = row;
-            while (cols != 0) {
-                int xSize = std::min(width(), cols);
-                Cell * x = new Cell[xSize];
-                // copy the cells one by one as they are PODs
-                MemCopy(x, i, xSize);
-                i += xSize;
-                cols -= xSize;
-                historyRows_.push_back(std::make_pair(xSize, x));
-            }
-            delete [] row;
-        }
-        while (historyRows_.size() > static_cast<size_t>(maxHistoryRows_)) {
-            delete [] historyRows_.front().second;
-            historyRows_.pop_front();
-        }
-        if (scrollToTerminal_)
+        history_.addRow(row, cols, Buffer::IsLineEnd(row[cols - 1]));
+        if (scrollToTerminal_ && ! hidden_)
             schedule([this](){
-                setScrollOffset(Point{0, static_cast<int>(historyRows_.size())});
+                setScrollOffset(Point{0, historyRows()});
             });
     }
 
-    void AnsiTerminal::resizeHistory() {
-        std::deque<std::pair<int, Cell*>> oldRows{std::move(historyRows_)};
-        Cell * row = nullptr;
-        int rowSize = 0;
-        for (auto & i : oldRows) {
-            if (row == nullptr) {
-                row = i.second;
-                rowSize = i.first;
-            } else {
-                Cell * newRow = new Cell[rowSize + i.first];
-                MemCopy(newRow, row, rowSize);
-                MemCopy(newRow + rowSize, i.second, i.first);
-                rowSize += i.first;
-                delete [] i.second;
-                delete [] row;
-                row = newRow;
-            }
-            ASSERT(row != nullptr);
-            if (Buffer::IsLineEnd(row[rowSize - 1])) {
-                addHistoryRow(row, rowSize);
-                row = nullptr;
-                rowSize = 0;
+    void AnsiTerminal::compactHistory() {
+        std::lock_guard<PriorityLock> g{bufferLock_};
+        if (! hidden_)
+            return;
+        history_.compact();
+    }
+
+    AnsiTerminal::MemoryUsage AnsiTerminal::memoryUsage() {
+        std::lock_guard<PriorityLock> g{bufferLock_};
+        MemoryUsage result;
+        for (State * state : { state_, stateBackup_ })
+            result.buffers += static_cast<size_t>(state->buffer.width()) * state->buffer.height() * sizeof(Cell);
+        result.history = history_.bytes();
+        result.historyRows = history_.rows();
+        result.compactedLines = history_.compactedLines();
+        result.disk = history_.diskBytes();
+        return result;
+    }
+
+    void AnsiTerminal::setVisible(bool value) {
+        hidden_ = ! value;
+        Widget::setVisible(value);
+        if (value) {
+            {
+                std::lock_guard<PriorityLock> g{bufferLock_};
+                history_.expand();
             }
+            // catch up with the history rows added while hidden and with the output received
+            if (scrollToTerminal_)
+                setScrollOffset(Point{0, historyRows()});
+            repaint();
         }
-        if (row != nullptr)
-            addHistoryRow(row, rowSize);
     }
 
     void AnsiTerminal::resizeBuffers(Size size) {
@@ -614,10 +798,10 @@ namespace ui {
         } else {
             if (coords.y() < 0)
                 return nullptr;
-            auto const & row = historyRows_[coords.y()];
-            if (coords.x() >= row.first)
+            std::pair<Cell const *, int> row = history_.row(coords.y());
+            if (coords.x() >= row.second)
                 return nullptr;
-            return row.second + coords.x();
+            return row.first + coords.x();
         }
     }
 
@@ -640,18 +824,34 @@ namespace ui {
     // Input Processing
 
     size_t AnsiTerminal::received(char * buffer, char const * bufferEnd) {
+        StartupTrace::PTYOutputReceived();
+        lastReceived_.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        // determine how much of the input can be parsed before the lock is released, the PTY reader calls again with the rest
+        char const * budgetEnd = buffer + flowControlBudget(bufferEnd - buffer);
+        char const * x = buffer;
+        // end of the input already scanned for fast-forward
+        char const * fastForwardScanEnd = buffer;
         {
             std::lock_guard<PriorityLock> g(bufferLock_);
+            // if there is an OSC or DCS sequence being streamed, continue with it first
+            if (pendingSequenceKind_ != PendingSequence::None) {
+                x += parsePendingSequence(x, bufferEnd);
+                if (pendingSequenceKind_ != PendingSequence::None) {
+                    parsedSinceRepaint_ += x - buffer;
+                    return x - buffer;
+                }
+            }
             // then process the input
-            char const * x = buffer;
-            while (x != bufferEnd) {
+            while (x < budgetEnd) {
                 switch (*x) {
                     /* Parse the escape sequence */
                     case Char::ESC: {
                         size_t processed = parseEscapeSequence(x, bufferEnd);
                         // if no characters were processed, the sequence was incomplete and we should end processing
-                        if (processed == 0)
+                        if (processed == 0) {
+                            parsedSinceRepaint_ += x - buffer;
                             return x - buffer;
+                        }
                         // move past the sequence
                         x += processed;
                         break;
@@ -668,6 +868,9 @@ namespace ui {
                     case Char::LF:
                         parseLF();
                         ++x;
+                        // the triggers must see every line
+                        if (fastForward_ && triggerMatcher_.empty() && x > fastForwardScanEnd)
+                            x = fastForward(x, budgetEnd, fastForwardScanEnd);
                         break;
                     case Char::CR:
                         parseCR();
@@ -678,45 +881,224 @@ namespace ui {
                         ++x;
                         break;
                     default: {
-                        // while this is a code duplication from the Char class, since this code is a bottleneck for processing large ammounts of text, the code is copied for performance
-                        char32_t cp = 0;
-                        unsigned char const * ux = pointer_cast<unsigned char const *>(x);
-                        if (*ux < 0x80) {
-                            cp = *ux;
+                        // control characters not handled above are passed as codepoints
+                        if (static_cast<unsigned char>(*x) < 0x20) {
+                            parseCodepoint(static_cast<unsigned char>(*x));
                             ++x;
-                        } else if (*ux < 0xe0) {
-                            if (x + 2 > bufferEnd)
-                                return x - buffer;
-                            cp = ((ux[0] & 0x1f) << 6) + (ux[1] & 0x3f);
-                            x += 2;
-                        } else if (*ux < 0xf0) {
-                            if (x + 3 > bufferEnd)
-                                return x - buffer;
-                            cp = ((ux[0] & 0x0f) << 12) + ((ux[1] & 0x3f) << 6) + (ux[2] & 0x3f);
-                            x += 3;
-                        } else {
-                            if (x + 4 > bufferEnd)
-                                return x - buffer;
-                            cp = ((ux[0] & 0x07) << 18) + ((ux[1] & 0x3f) << 12) + ((ux[2] & 0x3f) << 6) + (ux[3] & 0x3f);
-                            x += 4;
+                            break;
+                        }
+                        // decode the whole run of text up to the next control character at once, incomplete UTF-8 sequence at the end of the buffer is left for when more data arrives
+                        char32_t codepoints[DECODE_BUFFER_SIZE];
+                        size_t n = Char::DecodeUTF8(x, bufferEnd, codepoints, std::min(DECODE_BUFFER_SIZE, static_cast<size_t>(budgetEnd - x)), /* stopAtControl */ true, /* final */ false);
+                        if (n == 0) {
+                            parsedSinceRepaint_ += x - buffer;
+                            return x - buffer;
+                        }
+                        if (! detectHyperlinks_ || inProgressHyperlink_ != nullptr) {
+                            for (size_t i = 0; i < n; ++i)
+                                parseCodepoint(codepoints[i]);
+                            break;
+                        }
+                        // only the codepoints that may be part of an url are passed to the url matcher
+                        for (size_t i = 0; i < n; ) {
+                            size_t match;
+                            for (size_t e = i + urlMatcher_.skip(codepoints + i, codepoints + n, match); i < e; ++i)
+                                parseCodepoint(codepoints[i], false);
+                            for (size_t e = i + match; i < e; ++i)
+                                parseCodepoint(codepoints[i]);
                         }
-                        parseCodepoint(cp);
                         break;
                     }
                 }
             }
         }
-        scheduleRepaint();
-        return bufferEnd - buffer;
+        parsedSinceRepaint_ += x - buffer;
+        // hidden terminals are repainted when shown
+        if (! hidden_)
+            scheduleRepaint();
+        return x - buffer;
+    }
+
+    char const * AnsiTerminal::fastForward(char const * buffer, char const * bufferEnd, char const * & scanEnd) {
+        int width = state_->buffer.width();
+        int height = state_->buffer.height();
+        // the whole screen must scroll and the cursor must be at the beginning of the last line, which is the case when a program outputs lines in normal mode
+        if (alternateMode_ || state_->scrollStart != 0 || state_->scrollEnd != height || cursorPosition() != Point{0, height - 1} || inProgressHyperlink_ != nullptr)
+            return buffer;
+        // find the simple lines, fast-forward only if there is more than a screenful of them
+        fastForwardLines_.clear();
+        char const * x = buffer;
+        while (true) {
+            char const * next = ScanSimpleLine(x, bufferEnd, width);
+            if (next == nullptr)
+                break;
+            fastForwardLines_.push_back(x);
+            x = next;
+        }
+        scanEnd = x;
+        size_t numLines = fastForwardLines_.size();
+        if (numLines < static_cast<size_t>(height))
+            return buffer;
+        fastForwardLines_.push_back(x);
+        LOG(SEQ) << "Fast-forwarding " << numLines << " lines";
+        // the rows scrolled out are the current rows (the last one overwritten by the first line) followed by the lines, only the last maxHistoryRows_ of them are kept in the history, unless the history is stored on disk
+        size_t historyRows = numLines;
+        size_t skip = (historyRows > static_cast<size_t>(maxHistoryRows_) && history_.maxDiskBytes() == 0) ? historyRows - maxHistoryRows_ : 0;
+        Color defaultBg = PaletteColor(DEFAULT_BACKGROUND);
+        size_t index = 0;
+        auto scrollOut = [&](Cell const * row) {
+            if (index++ >= skip) {
+                std::pair<Cell *, int> copy = Buffer::CopyRow(row, width, defaultBg);
+                history_.addRow(copy.first, copy.second, Buffer::IsLineEnd(copy.first[copy.second - 1]));
+            }
+        };
+        for (int row = 0; row < height - 1; ++row)
+            scrollOut(state_->buffer.row(row));
+        std::unique_ptr<Cell[]> scratch{new Cell[width]};
+        for (size_t i = 0; i < numLines; ++i) {
+            size_t rowIndex = height - 1 + i;
+            if (rowIndex < historyRows) {
+                // the first line is written over the last row, the others over empty rows
+                bool write = rowIndex >= skip;
+                Cell * row = scratch.get();
+                if (i == 0) {
+                    row = state_->buffer.row(height - 1);
+                } else if (write) {
+                    for (int col = 0; col < width; ++col)
+                        row[col] = state_->cell;
+                }
+                fastForwardLine(fastForwardLines_[i], fastForwardLines_[i + 1], row, write, -1);
+                scrollOut(row);
+            } else {
+                // lines that stay on the screen
+                int bufferRow = static_cast<int>(rowIndex - historyRows);
+                state_->buffer.fillRow(bufferRow, state_->cell, 0, width);
+                fastForwardLine(fastForwardLines_[i], fastForwardLines_[i + 1], state_->buffer.row(bufferRow), true, bufferRow);
+            }
+        }
+        state_->buffer.fillRow(height - 1, state_->cell, 0, width);
+        setCursorPosition(Point{0, height - 1});
+        state_->setLastCharacter(cursorPosition());
+        state_->lastGlyph = Point{-1, -1};
+        // scroll to the terminal only once
+        if (scrollToTerminal_ && maxHistoryRows_ > 0 && ! hidden_)
+            schedule([this](){
+                setScrollOffset(Point{0, this->historyRows()});
+            });
+        return x;
+    }
+
+    void AnsiTerminal::fastForwardLine(char const * x, char const * bufferEnd, Cell * row, bool write, int bufferRow) {
+        char32_t codepoints[DECODE_BUFFER_SIZE];
+        int col = 0;
+        // column marked as the end of line, which is the last character written, or the column of last tab
+        int lastCol = 0;
+        int lastGlyph = -1;
+        while (x != bufferEnd) {
+            switch (*x) {
+                case Char::ESC: {
+                    CSISequence seq{CSISequence::Parse(x, bufferEnd)};
+                    parseCSISequence(seq);
+                    break;
+                }
+                case Char::TAB:
+                    lastCol = col;
+                    col = (col / 8 + 1) * 8;
+                    ++x;
+                    break;
+                case Char::CR:
+                    if (bufferRow >= 0 && detectHyperlinks_) {
+                        setCursorPosition(Point{col, bufferRow});
+                        resetMatching();
+                    }
+                    ++x;
+                    break;
+                case Char::LF:
+                    ++x;
+                    break;
+                default: {
+                    // the contents of lines which are not written is irrelevant, skip to the next escape sequence
+                    if (! write) {
+                        char const * esc = static_cast<char const *>(memchr(x, Char::ESC, bufferEnd - x));
+                        x = esc == nullptr ? bufferEnd : esc;
+                        break;
+                    }
+                    size_t n = Char::DecodeUTF8(x, bufferEnd, codepoints, DECODE_BUFFER_SIZE, /* stopAtControl */ true);
+                    for (size_t i = 0; i < n; ++i) {
+                        char32_t codepoint = codepoints[i];
+                        if (lineDrawingSet_ && codepoint >= 0x6a && codepoint < 0x79)
+                            codepoint = LineDrawingChars_[codepoint-0x6a];
+                        int columnWidth = Char::ColumnWidth(codepoint);
+                        if (columnWidth == 0) {
+                            if (lastGlyph >= 0 && lastGlyph == col - 1) {
+                                char32_t composed = Char::Compose(row[lastGlyph].codepoint(), codepoint);
+                                if (composed != 0)
+                                    row[lastGlyph].setCodepoint(composed);
+                            }
+                            continue;
+                        }
+                        if (bufferRow >= 0 && detectHyperlinks_) {
+                            setCursorPosition(Point{col, bufferRow});
+                            detectHyperlink(codepoint);
+                        }
+                        Cell & cell = row[col];
+                        cell = state_->cell;
+                        cell.setCodepoint(codepoint);
+                        if (columnWidth == 2 && ! cell.font().doubleWidth())
+                            cell.font().setDoubleWidth(true);
+                        lastCol = col;
+                        lastGlyph = col;
+                        ++col;
+                    }
+                }
+            }
+        }
+        if (write)
+            Buffer::MarkAsLineEnd(row[lastCol]);
+    }
+
+    /** The budget is loaded once as the UI thread may change it any time. 
+     */
+    size_t AnsiTerminal::flowControlBudget(size_t available) {
+        size_t budget = flowControl_.load(std::memory_order_relaxed);
+        if (budget == 0)
+            return available;
+        size_t parsed = parsedSinceRepaint_;
+        if (parsed >= budget) {
+            // hidden terminals are not repainted so there is nothing to wait for
+            if (hidden_) {
+                parsedSinceRepaint_ = 0;
+                return std::min(available, budget);
+            }
+            std::unique_lock<std::mutex> g{flowControlMutex_};
+            flowControlRepainted_.wait_for(g, std::chrono::milliseconds{FLOW_CONTROL_TIMEOUT}, [this, budget](){
+                return parsedSinceRepaint_ < budget;
+            });
+            // if the terminal has not been repainted in time (it may not be visible at all), start new budget anyway
+            parsedSinceRepaint_ = 0;
+            parsed = 0;
+        }
+        return std::min(available, budget - parsed);
     }
 
 
-    void AnsiTerminal::parseCodepoint(char32_t codepoint) {
+    void AnsiTerminal::parseCodepoint(char32_t codepoint, bool matchUrl) {
         if (lineDrawingSet_ && codepoint >= 0x6a && codepoint < 0x79)
             codepoint = LineDrawingChars_[codepoint-0x6a];
         LOG(SEQ) << "codepoint " << Char{codepoint} << " " << static_cast<char>(codepoint & 0xff);
+        int columnWidth = Char::ColumnWidth(codepoint);
+        // zero width characters do not consume a column, combining marks are composed with the previous character if possible, since a cell can hold only a single codepoint
+        if (columnWidth == 0) {
+            if (cursorPosition() == state_->lastGlyph + Point{1, 0} && state_->buffer.contains(state_->lastGlyph)) {
+                Cell & cell = state_->buffer.at(state_->lastGlyph);
+                char32_t composed = Char::Compose(cell.codepoint(), codepoint);
+                if (composed != 0)
+                    cell.setCodepoint(composed);
+            }
+            return;
+        }
         // detect the hyperlinks if enabled, before updating the cursor position
-        if (detectHyperlinks_)
+        if (detectHyperlinks_ && matchUrl)
             detectHyperlink(codepoint);
         updateCursorPosition();
         // set the cell according to the codepoint and current settings. If there is an active hyperlink, the hyperlink is first attached to the cell and then new cell is added to the hyperlink fallback
@@ -726,8 +1108,10 @@ namespace ui {
         if (inProgressHyperlink_ != nullptr)
             cell.attachSpecialObject(inProgressHyperlink_);
         cell.setCodepoint(codepoint);
+        state_->lastGlyph = cursorPosition();
+        if (! triggerMatcher_.empty() && triggerMatcher_.next(codepoint))
+            matchTriggers();
         // what's left is to deal with corner cases, such as larger fonts & double width characters
-        int columnWidth = Char::ColumnWidth(codepoint);
         // if the character's column width is 2 and current font is not double width, update to double width font
         if (columnWidth == 2 && ! cell.font().doubleWidth()) {
             //columnWidth = 1;
@@ -773,7 +1157,7 @@ namespace ui {
     }
 
     void AnsiTerminal::parseTab() {
-        resetHyperlinkDetection();
+        resetMatching();
         updateCursorPosition();
         if (cursorPosition().x() % 8 == 0)
             setCursorPosition(cursorPosition() + Point{8, 0});
@@ -784,7 +1168,7 @@ namespace ui {
 
     void AnsiTerminal::parseLF() {
         LOG(SEQ) << "LF";
-        resetHyperlinkDetection();
+        resetMatching();
         state_->markLineEnd();
         // disable double width and height chars
         state_->cell.font().setSize(1).setDoubleWidth(false);
@@ -800,7 +1184,7 @@ namespace ui {
 
     void AnsiTerminal::parseCR() {
         LOG(SEQ) << "CR";
-        resetHyperlinkDetection();
+        resetMatching();
         // mark the last character as line end?
         // TODO
         setCursorPosition(Point{0, cursorPosition().y()});
@@ -808,7 +1192,7 @@ namespace ui {
 
     void AnsiTerminal::parseBackspace() {
         LOG(SEQ) << "BACKSPACE";
-        resetHyperlinkDetection();
+        resetMatching();
         if (cursorPosition().x() == 0) {
             if (cursorPosition().y() > 0)
                 setCursorPosition(cursorPosition() - Point{0, 1});
@@ -846,29 +1230,29 @@ namespace ui {
                 // if the sequence is not valid, it has been reported already and we should just exit
                 if (!seq.valid())
                     break;
-                // if the sequence is not complete, return false and do not advance the buffer
+                // if the sequence is not complete, stream the rest of it so that its size is not limited by the input buffer
                 if (!seq.complete())
-                    return false;
+                    return startPendingSequence(PendingSequence::OSC, buffer, bufferEnd, 2);
                 parseOSCSequence(seq);
 				break;
             }
 			/* Save Cursor. */
 			case '7':
 				LOG(SEQ) << "DECSC: Cursor position saved";
-                resetHyperlinkDetection();
+                resetMatching();
                 state_->saveCursor();
 				break;
 			/* Restore Cursor. */
 			case '8':
                 LOG(SEQ) << "DECRC: Cursor position restored";
-                resetHyperlinkDetection();
+                resetMatching();
                 state_->restoreCursor();
 				break;
 			/* Reverse line feed - move up 1 row, same column.
 			 */
 			case 'M':
 				LOG(SEQ) << "RI: move cursor 1 line up";
-                resetHyperlinkDetection();
+                resetMatching();
 				if (cursorPosition().y() == state_->scrollStart)
 					insertLines(1, state_->scrollStart, state_->scrollEnd, state_->cell);
 				else
@@ -877,24 +1261,25 @@ namespace ui {
             /* Device Control String (DCS).
              */
             case 'P':
-                resetHyperlinkDetection();
+                resetMatching();
                 if (x == bufferEnd)
                     return false;
                 if (*x == '+') {
-                    resetHyperlinkDetection();
+                    resetMatching();
                     // frees the UI thread to draw the buffer while we are dealing with the tpp sequence
                     bufferLock_.unlock();
                     size_t p = parseTppSequence(buffer, bufferEnd);
                     bufferLock_.lock();
                     return p;
                 } else {
+                    // the payload of unknown DCS sequences is skipped
                     LOG(SEQ_UNKNOWN) << "Unknown DCS sequence";
+                    return startPendingSequence(PendingSequence::DCS, buffer, bufferEnd, 2);
                 }
-                break;
     		/* Character set specification - most cases are ignored, with the exception of the box drawing and reset to english (0 and B) respectively.
              */
 			case '(':
-                resetHyperlinkDetection();
+                resetMatching();
                 if (x != bufferEnd) {
                     if (*x == '0') {
                         ++x;
@@ -913,7 +1298,7 @@ namespace ui {
 			case '*':
 			case '+':
 				// missing character set specification
-                resetHyperlinkDetection();
+                resetMatching();
 				if (x == bufferEnd)
 					return false;
 				if (*x == 'B') { // US
@@ -926,13 +1311,13 @@ namespace ui {
 			/* ESC = -- Application keypad */
 			case '=':
 				LOG(SEQ) << "Application keypad mode enabled";
-                resetHyperlinkDetection();
+                resetMatching();
                 keypadMode_ = KeypadMode::Application;
 				break;
 			/* ESC > -- Normal keypad */
 			case '>':
 				LOG(SEQ) << "Normal keypad mode enabled";
-                resetHyperlinkDetection();
+                resetMatching();
                 keypadMode_ = KeypadMode::Normal;
 				break;
             /* ESC # number -- font size changes */
@@ -945,13 +1330,81 @@ namespace ui {
                 break;
                 */
             default:
-                resetHyperlinkDetection();
+                resetMatching();
 				LOG(SEQ_UNKNOWN) << "Unknown escape sequence \x1b" << *(x-1);
 				break;
         }
         return x - buffer;
     }
 
+    void AnsiTerminal::pendingInputDiscarded() {
+        std::lock_guard<PriorityLock> g(bufferLock_);
+        pendingSequenceKind_ = PendingSequence::None;
+        pendingSequence_.clear();
+        pendingSequenceOverflow_ = false;
+        resetMatching();
+    }
+
+    bool AnsiTerminal::insideStringSequence() const {
+        return pendingSequenceKind_ != PendingSequence::None;
+    }
+
+    size_t AnsiTerminal::startPendingSequence(PendingSequence kind, char const * buffer, char const * bufferEnd, size_t start) {
+        ASSERT(pendingSequenceKind_ == PendingSequence::None);
+        pendingSequenceKind_ = kind;
+        pendingSequenceOverflow_ = false;
+        pendingSequence_.clear();
+        if (kind == PendingSequence::OSC)
+            pendingSequence_.append(buffer, start);
+        return start + parsePendingSequence(buffer + start, bufferEnd);
+    }
+
+    size_t AnsiTerminal::parsePendingSequence(char const * buffer, char const * bufferEnd) {
+        ASSERT(pendingSequenceKind_ != PendingSequence::None);
+        char const * x = buffer;
+        bool terminated = false;
+        while (x != bufferEnd) {
+            // OSC sequences can be terminated by BEL
+            if (*x == Char::BEL && pendingSequenceKind_ == PendingSequence::OSC) {
+                ++x;
+                terminated = true;
+                break;
+            }
+            // both can be terminated by ST, if the ESC is last character, wait for more data
+            if (*x == Char::ESC) {
+                if (x + 1 == bufferEnd)
+                    break;
+                if (x[1] == '\\') {
+                    x += 2;
+                    terminated = true;
+                    break;
+                }
+            }
+            ++x;
+        }
+        if (pendingSequenceKind_ == PendingSequence::OSC && ! pendingSequenceOverflow_) {
+            if (pendingSequence_.size() + (x - buffer) > MAX_OSC_SEQUENCE_SIZE) {
+                LOG(SEQ_ERROR) << "OSC sequence larger than " << MAX_OSC_SEQUENCE_SIZE << " bytes, discarded";
+                pendingSequenceOverflow_ = true;
+                pendingSequence_.clear();
+                pendingSequence_.shrink_to_fit();
+            } else {
+                pendingSequence_.append(buffer, x - buffer);
+            }
+        }
+        if (terminated) {
+            if (pendingSequenceKind_ == PendingSequence::OSC && ! pendingSequenceOverflow_) {
+                char const * start = pendingSequence_.c_str();
+                OSCSequence seq{OSCSequence::Parse(start, start + pendingSequence_.size())};
+                if (seq.valid() && seq.complete())
+                    parseOSCSequence(seq);
+            }
+            pendingSequenceKind_ = PendingSequence::None;
+            pendingSequence_.clear();
+        }
+        return x - buffer;
+    }
+
     size_t AnsiTerminal::parseTppSequence(char const * buffer, char const * bufferEnd) {
         // we know that we have at least \033P+
         char const * i = buffer + 3;
@@ -971,7 +1424,7 @@ namespace ui {
     void AnsiTerminal::parseCSISequence(CSISequence & seq) {
         // reset hyperlink detection for all but SGR commands
         if (seq.firstByte() != 0 || seq.finalByte() != 'm')
-            resetHyperlinkDetection();
+            resetMatching();
         // process the sequence
         switch (seq.firstByte()) {
             // the "normal" CSI sequences
@@ -1202,7 +1655,7 @@ namespace ui {
                         if (seq[0] != 0)
                             break;
                         LOG(SEQ) << "Device Attributes - VT102 sent";
-                        send("\033[?6c", 5); // send VT-102 for now, go for VT-220?
+                        reply("\033[?6c", 5); // send VT-102 for now, go for VT-220?
                         return;
                     }
                     /* CSI <n> d -- Line position absolute (VPA)
@@ -1246,11 +1699,11 @@ namespace ui {
                     case 'n':
                         // status report, send CSI 0 n which means OK
                         if (seq[0] == 5) {
-                            send("\033[0n", 4);
+                            reply("\033[0n", 4);
                         // cursor position, send CSI row ; col R
                         } else if (seq[0] == 6) {
                             std::string cpos = STR("\033[" << (cursorPosition().y() + 1) << ";" << (cursorPosition().x() + 1) << "R");
-                            send(cpos.c_str(), cpos.size());
+                            reply(cpos.c_str(), cpos.size());
                         // invalid DSR code
                         } else {
                             break;
@@ -1323,7 +1776,7 @@ namespace ui {
                         if (seq[0] != 0)
                             break;
 					LOG(SEQ) << "Secondary Device Attributes - VT100 sent";
-					send("\033[>0;0;0c", 9); // we are VT100, no version third must always be zero (ROM cartridge)
+					reply("\033[>0;0;0c", 9); // we are VT100, no version third must always be zero (ROM cartridge)
 					return;
 				default:
 					break;
@@ -1427,11 +1880,11 @@ namespace ui {
                             if (alternateMode_)
                                 setScrollOffset(Point{0, 0});
                             else
-                                setScrollOffset(Point{0, static_cast<int>(historyRows_.size())});
+                                setScrollOffset(Point{0, historyRows()});
                         });
                         // if we are entering the alternate mode, reset the state to default values
                         if (value) {
-                            state_->reset(palette_.defaultForeground(), palette_.defaultBackground());
+                            state_->reset(DefaultCell());
                             state_->invalidateLastCharacter();
                             LOG(SEQ) << "Alternate mode on";
                         } else {
@@ -1462,10 +1915,10 @@ namespace ui {
 			switch (seq[i]) {
 				/* Resets all attributes. */
 				case 0:
-                    state_->cell.setFg(palette_.defaultForeground())
-                               .setDecor(palette_.defaultForeground())
-                               .setBg(palette_.defaultBackground())
-                               .setFont(Font{});
+                    // the font has to be reset first as it holds the indexed colors flags
+                    state_->cell.setFont(Font{});
+                    SetFg(state_->cell, PaletteColor(DEFAULT_FOREGROUND), true);
+                    SetBg(state_->cell, PaletteColor(DEFAULT_BACKGROUND), true);
                     state_->bold = false;
                     state_->inverseMode = false;
                     LOG(SEQ) << "font fg bg reset";
@@ -1500,9 +1953,7 @@ namespace ui {
 				case 7:
                     if (! state_->inverseMode) {
                         state_->inverseMode = true;
-                        Color fg = state_->cell.fg();
-                        Color bg = state_->cell.bg();
-                        state_->cell.setFg(bg).setDecor(bg).setBg(fg);
+                        SwapColors(state_->cell);
     					LOG(SEQ) << "inverse mode on";
                     }
                     break;
@@ -1542,9 +1993,7 @@ namespace ui {
 				case 27:
                     if (state_->inverseMode) {
                         state_->inverseMode = false;
-                        Color fg = state_->cell.fg();
-                        Color bg = state_->cell.bg();
-                        state_->cell.setFg(bg).setDecor(bg).setBg(fg);
+                        SwapColors(state_->cell);
     					LOG(SEQ) << "inverse mode off";
                     }
                     break;
@@ -1556,28 +2005,29 @@ namespace ui {
 				/* 30 - 37 are dark foreground colors, handled in the default case. */
 				/* 38 - extended foreground color */
 				case 38: {
-                    Color fg = parseSGRExtendedColor(seq, i);
-                    state_->cell.setFg(fg).setDecor(fg);
+                    bool indexed;
+                    Color fg = parseSGRExtendedColor(seq, i, indexed);
+                    SetFg(state_->cell, fg, indexed);
 					LOG(SEQ) << "fg set to " << fg;
 					break;
                 }
 				/* Foreground default. */
 				case 39:
-                    state_->cell.setFg(palette_.defaultForeground())
-                               .setDecor(palette_.defaultForeground());
+                    SetFg(state_->cell, PaletteColor(DEFAULT_FOREGROUND), true);
 					LOG(SEQ) << "fg reset";
 					break;
 				/* 40 - 47 are dark background color, handled in the default case. */
 				/* 48 - extended background color */
 				case 48: {
-                    Color bg = parseSGRExtendedColor(seq, i);
-                    state_->cell.setBg(bg);
+                    bool indexed;
+                    Color bg = parseSGRExtendedColor(seq, i, indexed);
+                    SetBg(state_->cell, bg, indexed);
 					LOG(SEQ) << "bg set to " << bg;
 					break;
                 }
 				/* Background default */
 				case 49:
-					state_->cell.setBg(palette_.defaultBackground());
+					SetBg(state_->cell, PaletteColor(DEFAULT_BACKGROUND), true);
 					LOG(SEQ) << "bg reset";
 					break;
 				/* 90 - 97 are bright foreground colors, handled in the default case. */
@@ -1587,18 +2037,16 @@ namespace ui {
                         int colorIndex = seq[i] - 30;
                         if (boldIsBright_ && state_->bold)
                             colorIndex += 8;
-						state_->cell.setFg(palette_.at(colorIndex))
-                                   .setDecor(palette_.at(colorIndex));
+						SetFg(state_->cell, PaletteColor(colorIndex), true);
 						LOG(SEQ) << "fg set to " << palette_.at(seq[i] - 30);
 					} else if (seq[i] >= 40 && seq[i] <= 47) {
-						state_->cell.setBg(palette_.at(seq[i] - 40));
+						SetBg(state_->cell, PaletteColor(seq[i] - 40), true);
 						LOG(SEQ) << "bg set to " << palette_.at(seq[i] - 40);
 					} else if (seq[i] >= 90 && seq[i] <= 97) {
-						state_->cell.setFg(palette_.at(seq[i] - 82))
-                                   .setDecor(palette_.at(seq[i] - 82));
+						SetFg(state_->cell, PaletteColor(seq[i] - 82), true);
 						LOG(SEQ) << "fg set to " << palette_.at(seq[i] - 82);
 					} else if (seq[i] >= 100 && seq[i] <= 107) {
-						state_->cell.setBg(palette_.at(seq[i] - 92));
+						SetBg(state_->cell, PaletteColor(seq[i] - 92), true);
 						LOG(SEQ) << "bg set to " << palette_.at(seq[i] - 92);
 					} else {
 						LOG(SEQ_UNKNOWN) << "Invalid SGR code: " << seq;
@@ -1608,7 +2056,8 @@ namespace ui {
 		}
     }
 
-    Color AnsiTerminal::parseSGRExtendedColor(CSISequence & seq, size_t & i) {
+    Color AnsiTerminal::parseSGRExtendedColor(CSISequence & seq, size_t & i, bool & indexed) {
+        indexed = false;
 		++i;
 		if (i < seq.numArgs()) {
 			switch (seq[i++]) {
@@ -1618,7 +2067,8 @@ namespace ui {
 						break;
 					if (seq[i] > 255) // invalid color spec
 						break;
-                    return palette_.at(seq[i]);
+                    indexed = true;
+                    return PaletteColor(seq[i]);
 				/* true color rgb */
 				case 2:
 					i += 2;
@@ -1721,18 +2171,10 @@ namespace ui {
     // ============================================================================================
     // AnsiTerminal::Buffer
 
-    void AnsiTerminal::Buffer::insertLine(int top, int bottom, Cell const & fill) {
-        Cell * x = rows_[bottom - 1];
-        memmove(rows_ + top + 1, rows_ + top, sizeof(Cell*) * (bottom - top - 1));
-        rows_[top] = x;
-        fillRow(top, fill, 0, width());
-    }
-
-    std::pair<AnsiTerminal::Cell *, int> AnsiTerminal::Buffer::copyRow(int row, Color defaultBg) {
-        int lastCol = width();
-        Cell * x = rows_[row];
+    std::pair<AnsiTerminal::Cell *, int> AnsiTerminal::Buffer::CopyRow(Cell const * x, int width, Color defaultBg) {
+        int lastCol = width;
         while (lastCol-- > 0) {
-            Cell & c = x[lastCol];
+            Cell const & c = x[lastCol];
             // if we have found end of line character, good
             if (IsLineEnd(c))
                 break;
@@ -1741,11 +2183,11 @@ namespace ui {
                 break;
             }
         }
-        // if we are not at the end of line, we must remember the whole line
-        if (IsLineEnd(x[lastCol]))
+        // if we are not at the end of line, we must remember the whole line (if the whole row is empty and without end of line, lastCol is -1)
+        if (lastCol >= 0 && IsLineEnd(x[lastCol]))
             lastCol += 1;
         else
-            lastCol = width();
+            lastCol = width;
         // make the copy and return it
         Cell * result = new Cell[lastCol];
         // we cannot use memcopy here because the cells can be special
@@ -1753,19 +2195,13 @@ namespace ui {
         return std::make_pair(result, lastCol);
     }
 
-    void AnsiTerminal::Buffer::deleteLine(int top, int bottom, Cell const & fill) {
-        Cell * x = rows_[top];
-        memmove(rows_ + top, rows_ + top + 1, sizeof(Cell*) * (bottom - top - 1));
-        rows_[bottom - 1] = x;
-        fillRow(bottom - 1, fill, 0, width());
-    }
-
     void AnsiTerminal::Buffer::resize(Size size, Cell const & fill, std::function<void(Cell*, int)> addToHistory) {
         if (size_ == size)
             return;
         // determine the line at which the cursor is, which can span multiple terminal lines if it is wrapped. This is important because the contents of the cursor line and all lines below is not being copied to the resized buffer as it should be rewritten by the terminal app
         int stopRow = getCursorRowWrappedStart();
-        // first keep the old rows and size so that we can copy the data from it
+        // first keep the old rows and size so that we can copy the data from it, the old rows are indexed directly
+        normalizeRows();
         Cell ** oldRows = rows_;
         int oldWidth = width();
         int oldHeight = height();
@@ -1781,7 +2217,7 @@ namespace ui {
             for (int col = 0; col < oldWidth; ++col) {
                 adjustCursorPosition(fill, addToHistory);
                 // append the character from the old buffer
-                rows_[cursorPosition_.y()][cursorPosition_.x()] = old[col];
+                rowCells(cursorPosition_.y())[cursorPosition_.x()] = old[col];
                 // if the cell is marked as end of line and the rest of the line are just whitespace characters then set position to new line and ignore the whitespace
                 if (IsLineEnd(old[col]) && hasOnlyWhitespace(old, col + 1, oldWidth)) {
                     cursorPosition_ = Point{0, cursorPosition_.y() + 1};
@@ -1805,7 +2241,7 @@ namespace ui {
         int row = cursorPosition_.y() - 1;
         ASSERT(row < height() && row >= -1);
         while (row >= 0) {
-            Cell * cells = rows_[row];
+            Cell * cells = rowCells(row);
             for (int col = width(); col >= 0; --col) {
                 if (IsLineEnd(cells[col]))
                     return row + 1;
@@ -1823,10 +2259,10 @@ namespace ui {
         if (cursorPosition_.y() >= height()) {
             if (addToHistory) {
                 Cell * rowCopy = new Cell[width()];
-                MemCopy(rowCopy, rows_[0], width());
+                MemCopy(rowCopy, rowCells(0), width());
                 addToHistory(rowCopy, width());
             }
-            deleteLine(0, height(), fill);
+            deleteRows(0, height(), 1, fill);
             cursorPosition_ -= Point{0,1};
         }
     }
@@ -2,6 +2,10 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 
 #include "ui/canvas.h"
 
@@ -12,7 +16,10 @@
 #include "tpp-lib/pty_buffer.h"
 
 #include "csi_sequence.h"
+#include "key_table.h"
 #include "osc_sequence.h"
+#include "terminal_history.h"
+#include "trigger_matcher.h"
 #include "url_matcher.h"
 
 namespace ui {
@@ -135,6 +142,18 @@ namespace ui {
 
         }; // AnsiTerminal::Palette
 
+        /** Reaction of the terminal to a pattern in its output, such as a build failure, or a password prompt. 
+         */
+        class Trigger {
+        public:
+            /** The text to match, UTF-8 encoded. Zero width characters are ignored as they do not occupy any cells. */
+            std::string pattern;
+            /** If true, the notification event is triggered when the pattern is matched. */
+            bool notify = false;
+            /** Style applied to the cells of the matched text, the default style leaves them intact. */
+            Hyperlink::Style style;
+        }; // AnsiTerminal::Trigger
+
     /**\name Log Levels.
      */
     //@{
@@ -160,7 +179,8 @@ namespace ui {
             {
                 std::lock_guard<PriorityLock> g{bufferLock_.priorityLock(), std::adopt_lock};
                 Widget::resize(size);
-                resizeHistory();
+                // the history is rewrapped lazily when its rows are accessed
+                history_.setWidth(size.width());
                 resizeBuffers(size);
                 pty_->resize(size.width(), size.height());
             }
@@ -174,6 +194,12 @@ namespace ui {
             return palette_;
         }
 
+        /** Sets the palette of the terminal. 
+         
+            Cells on the screen and in the history that use palette colors store their indices, so the change applies to the existing contents as well once repainted, while true colors are left intact.
+         */
+        void setPalette(Palette const & value);
+
     /** \name Events
      */
 
@@ -196,6 +222,10 @@ namespace ui {
         TppSequenceEvent onTppSequence;
         ExitCodeEvent onPTYTerminated;
 
+        /** Triggered in the UI thread when the whole pasted contents has been sent to the PTY. 
+         */
+        VoidEvent onPasteDone;
+
 
     /** \name Widget 
      */
@@ -208,7 +238,7 @@ namespace ui {
                 return Widget::contentsSize();
             } else {
                 std::lock_guard<PriorityLock> g(bufferLock_.priorityLock(), std::adopt_lock);
-                return Size{width(), height() + static_cast<int>(historyRows_.size())};
+                return Size{width(), height() + static_cast<int>(historySize())};
             }
         }
 
@@ -234,12 +264,39 @@ namespace ui {
             return mouseMode_ != MouseMode::Off;
         }
 
+        /** Number of bytes of a paste sent to the PTY at once. 
+
+            Pastes larger than the chunk size are sent asynchronously, the next chunk is sent only when the send queue of the PTY falls below the chunk size so that the UI thread never waits for a slowly reading program. 
+         */
+        static constexpr size_t PASTE_CHUNK_SIZE = 64 * 1024;
+
+        /** Interval in milliseconds in which the send queue is checked while a large paste is in progress. 
+         */
+        static constexpr size_t PASTE_INTERVAL = 10;
+
         /** Sends the specified text as clipboard to the PTY. 
+
+            Triggers the onPasteDone event when the whole contents has been sent. The user input while a large paste is in progress is sent after the pasted contents. 
          */
         void pasteContents(std::string const & contents);
         
     protected:
 
+        /** Sends the user input to the PTY. 
+
+            If a large paste is in progress, the input is appended to the paste so that it is not interleaved with the pasted contents. UI thread only. 
+         */
+        void send(char const * buffer, size_t numBytes) {
+            if (pendingPaste_.empty())
+                PTYBuffer::send(buffer, numBytes);
+            else
+                pendingPaste_.append(buffer, numBytes);
+        }
+
+        /** Sends the next chunks of the paste in progress and schedules the next check of the send queue, or triggers the onPasteDone event if the paste has been sent. 
+         */
+        void continuePaste();
+
         void keyDown(KeyEvent::Payload & e) override ;
 
         void keyUp(KeyEvent::Payload & e) override;
@@ -325,9 +382,8 @@ namespace ui {
         unsigned mouseButtonsDown_ = 0;
         /** Last pressed mouse button for mouse move reporting. */
         unsigned mouseLastButton_ = 0;
-
-        static std::unordered_map<Key, std::string> KeyMap_;
-        static std::unordered_set<Key> PrintableKeys_;
+        /** Set when a numeric keypad key has been sent in the application keypad mode so that the character the key also produces is not sent. */
+        bool suppressKeyChar_ = false;
 
     //}
 
@@ -355,6 +411,7 @@ namespace ui {
             Note that disabling OSC hyperlinks has no effect on the automatic hyperlink detection.
          */
         virtual void setAllowOSCHyperlinks(bool value = true) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             allowOSCHyperlinks_ = value;
         }
 
@@ -369,10 +426,23 @@ namespace ui {
             Note that disabling automatic hyperlink detection has no effect on OSC explicit hyperlinks.
          */
         virtual void setDetectHyperlinks(bool value = true) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             detectHyperlinks_ = value;
             urlMatcher_.reset();
         }
 
+        /** Returns the triggers matched in the terminal output. 
+         */
+        std::vector<Trigger> const & triggers() const {
+            return triggers_;
+        }
+
+        /** Sets the triggers matched in the terminal output. 
+         
+            All patterns are matched at once by a single automaton so that the cost of matching does not depend on the number of triggers. Output floods are not fast-forwarded while any triggers are set so that every line is matched. 
+         */
+        virtual void setTriggers(std::vector<Trigger> const & value);
+
         /** Returns the style used for new hyperlinks. 
          */
         Hyperlink::Style const & normalHyperlinkStyle() const {
@@ -382,6 +452,7 @@ namespace ui {
         /** Sets the style for new hyperlinks.
          */
         virtual void setNormalHyperlinkStyle(Hyperlink::Style const & value) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             normalHyperlinkStyle_ = value;
         }
 
@@ -394,6 +465,7 @@ namespace ui {
         /** Sets the active (mouse over) style for new hyperlinks.
          */
         virtual void setActiveHyperlinkStyle(Hyperlink::Style const & value) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             activeHyperlinkStyle_ = value;
         }
 
@@ -410,14 +482,15 @@ namespace ui {
             return cell == nullptr ? nullptr : dynamic_cast<Hyperlink*>(cell->specialObject());
         }
 
-        /** Resets the hyperlink detection matching. 
+        /** Resets the hyperlink detection and the trigger matching. 
          
-            If the matching is in valid state, creates the hyperlink. The reset is done by adding an url separator character, which terminates the url scheme.
+            If the hyperlink matching is in valid state, creates the hyperlink. The reset is done by adding an url separator character, which terminates the url scheme.
 
-            Any sequence other than SGR ones should reset the hyperlink matching.
+            Any sequence other than SGR ones should reset the matching.
          */
-        void resetHyperlinkDetection() {
+        void resetMatching() {
             detectHyperlink(' ');
+            triggerMatcher_.reset();
         }
 
         /** Adds given character to the url matcher. 
@@ -426,6 +499,10 @@ namespace ui {
          */
         void detectHyperlink(char32_t next);
 
+        /** Performs the actions of the triggers whose patterns were matched by the codepoint just written to the last glyph.
+         */
+        void matchTriggers();
+
     private:
 
         /** When hyperlink is parsed, this holds the special object and the offset of the next cell. If the hyperlink in progress is nullptr, then there is no hyperlink in progress and hyperlink offset has no meaning. 
@@ -440,6 +517,15 @@ namespace ui {
          */
         UrlMatcher urlMatcher_;
 
+        /** Buffer the detected urls are read into from the cells, reused so that detecting an url does not allocate. 
+         */
+        std::string urlBuffer_;
+
+        /** Triggers and the matcher of their patterns, the index of each pattern is the index of its trigger. 
+         */
+        std::vector<Trigger> triggers_;
+        TriggerMatcher triggerMatcher_;
+
         /** If true, OSC hyperlinks are supported. 
          */
         bool allowOSCHyperlinks_ = false;
@@ -474,6 +560,7 @@ namespace ui {
             The update does not have an immediate effect and the buffer has to be reloaded for the setting to take effect. 
          */
         virtual void setBoldIsBright(bool value = true) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             boldIsBright_ = value;
         }
 
@@ -486,6 +573,7 @@ namespace ui {
             The update does not have an immediate effect and the buffer has to be reloaded for the setting to take effect. 
          */
         virtual void setDisplayBold(bool value = true) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             displayBold_ = value;
         }
 
@@ -502,6 +590,7 @@ namespace ui {
             Note that the terminal apps can always set cursor visibility. 
          */
         virtual void setAllowCursorChanges(bool value) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
             allowCursorChanges_ = value;
         }
 
@@ -528,7 +617,7 @@ namespace ui {
          */
         int historyRows() {
             std::lock_guard<PriorityLock> g{bufferLock_};
-            return static_cast<int>(historyRows_.size());
+            return static_cast<int>(historySize());
         }
 
         int maxHistoryRows() const {
@@ -537,15 +626,69 @@ namespace ui {
 
         void setMaxHistoryRows(int value) {
             if (value != maxHistoryRows_) {
-                maxHistoryRows_ = std::max(value, 0);
+                // the PTY reader reads the limit while parsing
                 std::lock_guard<PriorityLock> g{bufferLock_};
-                while (historyRows_.size() > static_cast<size_t>(maxHistoryRows_)) {
-                    delete [] historyRows_.front().second;
-                    historyRows_.pop_front();
-                }
+                maxHistoryRows_ = std::max(value, 0);
+                history_.setMaxRows(static_cast<size_t>(maxHistoryRows_));
             }
         }
 
+        /** Returns the maximum number of bytes of the history stored on disk, 0 if the history is kept in memory only. 
+         */
+        size_t maxDiskHistoryBytes() {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            return history_.maxDiskBytes();
+        }
+
+        /** Sets the maximum number of bytes of the history stored on disk. 
+         
+            When greater than 0, history rows over the maximum number of history rows are moved to temporary files, which are deleted with the terminal, instead of being discarded. The maximum number of history rows then only limits the rows kept in memory. Has no effect if the history is disabled, or on platforms where the history cannot be stored on disk. 
+         */
+        void setMaxDiskHistoryBytes(size_t value) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            history_.setMaxDiskBytes(value);
+        }
+
+        /** Memory used by the terminal's buffers and history. 
+         */
+        class MemoryUsage {
+        public:
+            /** Bytes used by the screen buffer and its backup. */
+            size_t buffers = 0;
+            /** Bytes used by the history, including the compacted lines. */
+            size_t history = 0;
+            /** Number of history rows. */
+            size_t historyRows = 0;
+            /** Number of history lines stored in the compact form. */
+            size_t compactedLines = 0;
+            /** Bytes of the history stored on disk, not included in the total. */
+            size_t disk = 0;
+
+            size_t total() const {
+                return buffers + history;
+            }
+        }; // AnsiTerminal::MemoryUsage
+
+        /** Returns the memory used by the terminal's buffers and history. 
+         */
+        MemoryUsage memoryUsage();
+
+        /** Compacts the history lines to save memory. 
+         
+            Intended for hidden terminals that have been idle for some time. The history is expanded back when the terminal is shown again. Does nothing if the terminal is visible. 
+         */
+        void compactHistory();
+
+        /** Returns the time since the terminal last received any output from the PTY. 
+         */
+        std::chrono::steady_clock::duration idleTime() const {
+            return std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{lastReceived_.load(std::memory_order_relaxed)}};
+        }
+
+        /** Hidden terminals do not schedule repaints, nor scroll to the new history rows while they receive output, both are done once when the terminal is shown. 
+         */
+        void setVisible(bool value = true) override;
+
     protected:
 
         void setScrollOffset(Point const & value) override {
@@ -577,6 +720,13 @@ namespace ui {
 
         void addHistoryRow(Cell * row, int cols);
 
+        /** Returns the number of history rows at the current width, including the compacted ones. 
+         */
+        size_t historySize() const {
+            ASSERT(bufferLock_.locked());
+            return history_.rows();
+        }
+
         void ptyTerminated(ExitCode exitCode) override {
             schedule([this, exitCode](){
                 ExitCodeEvent::Payload p{exitCode};
@@ -584,7 +734,6 @@ namespace ui {
             });
         }
 
-        void resizeHistory();
         void resizeBuffers(Size size);
 
 
@@ -596,7 +745,7 @@ namespace ui {
          */
         int terminalBufferTop() const {
             ASSERT(bufferLock_.locked());
-            return alternateMode_ ? 0 : static_cast<int>(historyRows_.size());            
+            return alternateMode_ ? 0 : static_cast<int>(history_.rows());
         }
 
         /** Converts the given widget coordinates to terminal buffer coordinates. 
@@ -648,6 +797,95 @@ namespace ui {
             Application
         }; // AnsiTerminal::KeypadMode
 
+        /** \name Palette colors
+
+            The cells store palette colors as their indices so that the palette can be changed without rewriting the screen and the history. The index is stored in the red and green channels of the color and the custom bits of the font say which of the cell's colors are indexed. The colors are resolved when the cells are painted, or styled by the triggers.
+         */
+        //@{
+        static constexpr uint16_t FG_INDEXED = 8;
+        static constexpr uint16_t BG_INDEXED = 16;
+        static constexpr uint16_t DECOR_INDEXED = 32;
+
+        static constexpr size_t DEFAULT_FOREGROUND = 0xfffe;
+        static constexpr size_t DEFAULT_BACKGROUND = 0xffff;
+
+        static Color PaletteColor(size_t index) {
+            return Color{static_cast<unsigned char>(index & 0xff), static_cast<unsigned char>((index >> 8) & 0xff), 0, 0};
+        }
+
+        /** Sets the foreground and decoration colors of the cell, either palette index encoded by PaletteColor(), or a true color.
+         */
+        static Cell & SetFg(Cell & cell, Color color, bool indexed) {
+            uint16_t bits = SetBit(cell.font().customBits(), static_cast<uint16_t>(FG_INDEXED | DECOR_INDEXED), indexed);
+            cell.font().setCustomBits(bits);
+            return cell.setFg(color).setDecor(color);
+        }
+
+        /** Sets the background color of the cell, either palette index encoded by PaletteColor(), or a true color.
+         */
+        static Cell & SetBg(Cell & cell, Color color, bool indexed) {
+            uint16_t bits = SetBit(cell.font().customBits(), BG_INDEXED, indexed);
+            cell.font().setCustomBits(bits);
+            return cell.setBg(color);
+        }
+
+        /** Swaps the foreground and background colors of the cell for the inverse mode.
+         */
+        static void SwapColors(Cell & cell) {
+            uint16_t bits = cell.font().customBits();
+            Color fg = cell.fg();
+            Color bg = cell.bg();
+            SetFg(cell, bg, bits & BG_INDEXED);
+            SetBg(cell, fg, bits & FG_INDEXED);
+        }
+
+        /** Returns the default cell with the default palette colors.
+         */
+        static Cell DefaultCell() {
+            Cell result;
+            SetFg(result, PaletteColor(DEFAULT_FOREGROUND), true);
+            SetBg(result, PaletteColor(DEFAULT_BACKGROUND), true);
+            return result;
+        }
+
+        /** Replaces the palette indices in the cell with the colors of the current palette.
+         */
+        void resolveColors(Cell & cell) const {
+            uint16_t bits = cell.font().customBits();
+            if (bits == 0)
+                return;
+            if (bits & FG_INDEXED)
+                cell.setFg(resolveColor(cell.fg()));
+            if (bits & BG_INDEXED)
+                cell.setBg(resolveColor(cell.bg()));
+            if (bits & DECOR_INDEXED)
+                cell.setDecor(resolveColor(cell.decor()));
+            cell.font().setCustomBits(0);
+        }
+
+        Color resolveColor(Color color) const {
+            size_t index = color.r | (static_cast<size_t>(color.g) << 8);
+            if (index == DEFAULT_BACKGROUND)
+                return palette_.defaultBackground();
+            if (index < palette_.size())
+                return palette_[index];
+            return palette_.defaultForeground();
+        }
+
+        /** Draws the terminal cell to the canvas cell, resolving its colors before the special object, if any, updates the fallback cell.
+         */
+        void drawCell(Cell & dst, Cell const & src) const {
+            if (src.hasSpecialObject()) {
+                Cell resolved{src};
+                resolveColors(resolved);
+                dst.stripSpecialObjectAndAssign(resolved);
+            } else {
+                dst = src;
+                resolveColors(dst);
+            }
+        }
+        //@}
+
         Palette palette_;
 
         CursorMode cursorMode_ = CursorMode::Normal;
@@ -667,6 +905,13 @@ namespace ui {
         /* Determines whether pasted text will be surrounded by ESC[200~ and ESC[201~ */
         bool bracketedPaste_ = false;
 
+        /** Contents of the large paste in progress not yet sent to the PTY, followed by the user input received while the paste was in progress. UI thread only. 
+         */
+        std::string pendingPaste_;
+        size_t pendingPasteOffset_ = 0;
+        /** Timer which checks the send queue while the paste is in progress, 0 if none. */
+        TimerService::Token pasteTimer_ = 0;
+
         /** If true, bold font means bright colors too. */
         bool boldIsBright_ = false;
 
@@ -691,17 +936,92 @@ namespace ui {
         mutable PriorityLock bufferLock_;
 
         int maxHistoryRows_ = 0;
-        std::deque<std::pair<int, Cell*>> historyRows_;
+        TerminalHistory history_;
+
+        /** Set when the terminal is not visible, read by the PTY reader. 
+         */
+        std::atomic<bool> hidden_{false};
+
+        /** Time of the last output received from the PTY as steady clock ticks. 
+         */
+        std::atomic<std::chrono::steady_clock::rep> lastReceived_{std::chrono::steady_clock::now().time_since_epoch().count()};
 
     //@}
 
     /** \name Input Processing
      */
     //@{
+    public:
+
+        /** Returns the maximum number of bytes parsed between two repaints of the terminal, or 0 if flow control is disabled. 
+         */
+        size_t flowControl() const {
+            return flowControl_;
+        }
+
+        /** Enables, or disables the flow control. 
+         
+            When enabled, the PTY reader stops after parsing the given number of bytes since the last repaint of the terminal and waits for the repaint before continuing (but at most FLOW_CONTROL_TIMEOUT milliseconds, so that hidden terminals still make progress). As the reader no longer reads from the PTY, the application in the terminal is eventually blocked, which bounds the time in which user input and repaints are serviced. Furthermore pressing `Ctrl+C` discards the output received, but not yet parsed so that the interrupted application stops within a frame. 
+
+            Setting the value to 0 disables the flow control. 
+         */
+        void setFlowControl(size_t bytesPerFrame) {
+            flowControl_ = bytesPerFrame;
+        }
+
+        /** Returns true if the fast-forward of output floods is enabled. 
+         */
+        bool fastForward() const {
+            return fastForward_;
+        }
+
+        /** Enables, or disables fast-forward of the output floods.
+         
+            When the received input contains more than a screenful of simple lines (text and SGR sequences terminated by CR LF) that scroll the whole screen, the terminal does not write each line to the screen only to copy it to the history immediately. Lines that end up in the history are appended to it directly, lines that would not fit in the history are only parsed for graphic rendition changes and only the lines that remain on the screen are written to it. When hyperlink detection is enabled, only the lines that remain on the screen are matched, i.e. the fast-forwarded output is identical to the normal one except that the hyperlinks in the lines fast-forwarded directly to the history are not detected. The fast-forward is not used while any triggers are set as the triggers must see every line. 
+         */
+        void setFastForward(bool value) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            fastForward_ = value;
+        }
+
     protected:
+        /** Number of codepoints decoded from the input at once. 
+         */
+        static constexpr size_t DECODE_BUFFER_SIZE = 256;
+
+        /** Maximum time in milliseconds the PTY reader waits for a repaint when flow control is enabled. 
+         */
+        static constexpr unsigned FLOW_CONTROL_TIMEOUT = 50;
+
+        /** Maximum size of an OSC sequence. 
+         
+            OSC sequences which do not fit in the input buffer are streamed, longer sequences are discarded. 
+         */
+        static constexpr size_t MAX_OSC_SEQUENCE_SIZE = 4 * 1024 * 1024;
+
+        /** Kinds of sequences whose payload is streamed across multiple received chunks. 
+         */
+        enum class PendingSequence {
+            None,
+            OSC,
+            DCS
+        }; // AnsiTerminal::PendingSequence
+
         size_t received(char * buffer, char const * bufferEnd) override;
 
-        void parseCodepoint(char32_t cp);
+        /** Resets the pending OSC or DCS sequence, whose terminator may have been discarded, and the matching. 
+         */
+        void pendingInputDiscarded() override;
+
+        /** The pending OSC or DCS sequence is only updated by the PTY reader, so no lock is necessary. 
+         */
+        bool insideStringSequence() const override;
+
+        /** Writes the codepoint to the buffer. 
+         
+            If matchUrl is false, the codepoint is not passed to the url matcher, which must have skipped it already. 
+         */
+        void parseCodepoint(char32_t cp, bool matchUrl = true);
         void parseNotification();
         void parseTab();
         void parseLF();
@@ -711,6 +1031,36 @@ namespace ui {
 
         size_t parseTppSequence(char const * buffer, char const * bufferEnd);
 
+        /** Starts streaming of an OSC or DCS sequence which is not complete in the input buffer. 
+         
+            The `buffer` points to the beginning of the sequence (the ESC character) and the length of the sequence introducer (2 for `ESC ]`, or `ESC P`) is given by the `start` argument. Returns the number of bytes processed. 
+         */
+        size_t startPendingSequence(PendingSequence kind, char const * buffer, char const * bufferEnd, size_t start);
+
+        /** Processes the payload of the OSC or DCS sequence being streamed up to and including its terminator. 
+         
+            Returns the number of bytes processed. If the terminator is found, the sequence is processed (OSC), or discarded (DCS) and the pending sequence is cleared. A trailing ESC which might be the start of the string terminator is left unprocessed. 
+         */
+        size_t parsePendingSequence(char const * buffer, char const * bufferEnd);
+
+        /** Fast-forwards the simple lines at the beginning of the buffer if they scroll more than a screenful. 
+         
+            Returns the position after the fast-forwarded lines, or `buffer` if the lines can't be fast-forwarded. The `scanEnd` is set to the end of the simple lines found so that the caller does not rescan the same input again. 
+         */
+        char const * fastForward(char const * buffer, char const * bufferEnd, char const * & scanEnd);
+
+        /** Parses single simple line, writing its contents to the given row if `write` is true. 
+         
+            If the row is part of the terminal buffer, its index is given in `bufferRow` so that hyperlinks can be detected, otherwise `bufferRow` is -1. 
+         */
+        void fastForwardLine(char const * buffer, char const * bufferEnd, Cell * row, bool write, int bufferRow);
+
+        /** Returns the number of bytes from the available input that can be parsed now. 
+         
+            If flow control is enabled and its budget for the current frame has been exhausted, waits for the terminal to be repainted first. 
+         */
+        size_t flowControlBudget(size_t available);
+
         /** Called when `t++` sequence is parsed & received by the terminal. 
          
             The default implementation simply calls the event handler, if registered. 
@@ -746,8 +1096,10 @@ namespace ui {
         void parseSGR(CSISequence & seq);
 
         /** Parses the SGR extended color specification, i.e. either TrueColor RGB values, or 256 palette specification.
+
+            Sets indexed to true if the returned color is a palette index encoded by PaletteColor().
          */
-        Color parseSGRExtendedColor(CSISequence & seq, size_t & i);
+        Color parseSGRExtendedColor(CSISequence & seq, size_t & i, bool & indexed);
 
         /** Parses the operating system sequence. 
          */
@@ -755,6 +1107,32 @@ namespace ui {
 
         static char32_t LineDrawingChars_[15];
 
+        /** Kind and contents of the OSC or DCS sequence which is being streamed. 
+         
+            Only the OSC sequence contents is kept, DCS sequences other than t++ ones are not supported and therefore skipped. The contents of OSC sequences longer than MAX_OSC_SEQUENCE_SIZE are discarded, which is denoted by the pendingSequenceOverflow_ flag. 
+         */
+        PendingSequence pendingSequenceKind_ = PendingSequence::None;
+        std::string pendingSequence_;
+        bool pendingSequenceOverflow_ = false;
+
+        /** If true, output floods are fast-forwarded. 
+         */
+        bool fastForward_ = false;
+
+        /** Starts of the simple lines found by the fast-forward, kept to avoid reallocation. 
+         */
+        std::vector<char const *> fastForwardLines_;
+
+        /** Flow control budget per frame in bytes, 0 if disabled. Set by the UI thread and read by the PTY reader.
+         */
+        std::atomic<size_t> flowControl_{0};
+
+        /** Number of bytes parsed since the last repaint. 
+         */
+        std::atomic<size_t> parsedSinceRepaint_{0};
+        std::mutex flowControlMutex_;
+        std::condition_variable flowControlRepainted_;
+
 
     //@}
 
@@ -775,15 +1153,21 @@ namespace ui {
             fill(defaultCell);
         }
 
-        void insertLine(int top, int bottom, Cell const & fill);
-
-        std::pair<Cell *, int> copyRow(int row, Color defaultBg);
+        std::pair<Cell *, int> copyRow(int row, Color defaultBg) {
+            return CopyRow(rowCells(row), width(), defaultBg);
+        }
 
-        void deleteLine(int top, int bottom, Cell const & fill);
+        /** Returns copy of the given row for the history, trimmed after the end of line mark, or the last visible character. 
+         */
+        static std::pair<Cell *, int> CopyRow(Cell const * row, int width, Color defaultBg);
 
         void markAsLineEnd(Point p) {
             if (p.x() >= 0)
-                SetUnusedBits(at(p), END_OF_LINE);
+                MarkAsLineEnd(at(p));
+        }
+
+        static void MarkAsLineEnd(Cell & c) {
+            SetUnusedBits(c, END_OF_LINE);
         }
 
         static bool IsLineEnd(Cell const & c) {
@@ -820,8 +1204,7 @@ namespace ui {
     private:
 
         Cell * row(int row) {
-            ASSERT(row >= 0 && row < height());
-            return rows_[row];
+            return rowCells(row);
         }
 
         /** Returns the start of the line that contains the cursor including any word wrap. 
@@ -857,25 +1240,26 @@ namespace ui {
     class AnsiTerminal::State {
     public:
 
-        explicit State(Color defaultBackground):
-            State{Size{80,25}, defaultBackground} {
+        explicit State(Cell const & defaultCell):
+            State{Size{80,25}, defaultCell} {
         }
 
-        State(Size size, Color defaultBackground):
-            buffer{ size, Cell{}.setBg(defaultBackground) },
+        State(Size size, Cell const & defaultCell):
+            buffer{ size, defaultCell },
             canvas{buffer},
             scrollEnd{size.height()} {
         }
 
-        void reset(Color fg, Color bg) {
-            cell = Cell{};
-            cell.setFg(fg).setDecor(fg).setBg(bg);
+        void reset(Cell const & defaultCell) {
+            cell = defaultCell;
             // reset the cursor
             buffer.setCursorPosition(Point{0,0});
             // reset state
             scrollStart = 0;
             scrollEnd = buffer.height();
             inverseMode = false;
+            bold = false;
+            lastGlyph = Point{-1, -1};
             // clear the buffer
             canvas.fill(Rect{buffer.size()}, cell);
         }
@@ -931,6 +1315,11 @@ namespace ui {
          */
         bool bold = false;
 
+        /** Position of the last printable character written, so that subsequent combining marks can be composed with it. 
+         
+            The combining mark applies only if the cursor is still immediately after the character. 
+         */
+        Point lastGlyph{-1, -1};
 
     protected:
         Point lastCharacter_ = Point{-1,-1};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "helpers/helpers.h"
+
+#include "ui/canvas.h"
+
+namespace ui {
+
+    /** Terminal history row stored in a compact form.
+
+        Most of the cells in a history row share their attributes with their neighbours, the row is therefore stored as runs of cells with identical attributes, each run keeping a single template cell, followed by the codepoints of all cells. This takes roughly a fifth of the memory of the cells themselves for ordinary text, at the cost of having to expand the row back to cells before it can be displayed.
+
+        Rows that contain special objects, or which would not be any smaller, are kept as they are.
+     */
+    class CompactRow {
+    public:
+        using Cell = Canvas::Cell;
+
+        /** Creates the compact row from given cells, taking ownership of them.
+         */
+        CompactRow(Cell * cells, int cols):
+            cols_{cols} {
+            size_t runs = CountRuns(cells, cols);
+            if (runs == 0 || CompactSize(runs, cols) >= cols * sizeof(Cell)) {
+                cells_ = cells;
+                return;
+            }
+            runs_ = static_cast<uint32_t>(runs);
+            data_ = new char[CompactSize(runs, cols)];
+            Compact(cells, cols, runs, data_);
+            delete [] cells;
+        }
+
+        CompactRow(CompactRow && from) noexcept:
+            cols_{from.cols_},
+            runs_{from.runs_},
+            cells_{from.cells_},
+            data_{from.data_} {
+            from.cells_ = nullptr;
+            from.data_ = nullptr;
+        }
+
+        CompactRow & operator = (CompactRow && from) noexcept {
+            if (this != & from) {
+                delete [] cells_;
+                delete [] data_;
+                cols_ = from.cols_;
+                runs_ = from.runs_;
+                cells_ = from.cells_;
+                data_ = from.data_;
+                from.cells_ = nullptr;
+                from.data_ = nullptr;
+            }
+            return *this;
+        }
+
+        CompactRow(CompactRow const &) = delete;
+        CompactRow & operator = (CompactRow const &) = delete;
+
+        ~CompactRow() {
+            delete [] cells_;
+            delete [] data_;
+        }
+
+        int cols() const {
+            return cols_;
+        }
+
+        /** Returns true if the row is stored in the compact form, false if it kept its cells.
+         */
+        bool compacted() const {
+            return data_ != nullptr;
+        }
+
+        /** Returns the number of bytes used to store the row.
+         */
+        size_t bytes() const {
+            if (data_ != nullptr)
+                return CompactSize(runs_, cols_);
+            return cells_ == nullptr ? 0 : cols_ * sizeof(Cell);
+        }
+
+        /** Returns the cells of the row and gives up their ownership.
+
+            The caller is responsible for deleting the returned cells. The row is empty afterwards.
+         */
+        Cell * release() {
+            Cell * result = cells_;
+            cells_ = nullptr;
+            if (data_ != nullptr) {
+                result = new Cell[cols_];
+                Expand(data_, runs_, result);
+                delete [] data_;
+                data_ = nullptr;
+            }
+            return result;
+        }
+
+        /** \name Compact form
+
+            The compact form consists of the template cell of each run, followed by the column at which each run ends and the codepoints of all cells. It can be stored elsewhere than in a compact row, such as in a file, as long as the data is aligned for the cells.
+         */
+        //@{
+
+        /** Returns the number of bytes of the compact form of a row with given number of runs and cells.
+         */
+        static size_t CompactSize(size_t runs, int cols) {
+            return runs * (sizeof(Cell) + sizeof(int)) + cols * sizeof(char32_t);
+        }
+
+        /** Returns the number of runs of cells with identical attributes in the row, or 0 if the row cannot be compacted because it contains special objects.
+         */
+        static size_t CountRuns(Cell const * cells, int cols) {
+            size_t runs = 0;
+            for (int col = 0; col < cols; ++col) {
+                if (cells[col].hasSpecialObject())
+                    return 0;
+                if (col == 0 || ! SameAttributes(cells[col], cells[col - 1]))
+                    ++runs;
+            }
+            return runs;
+        }
+
+        /** Writes the compact form of the cells with given number of runs, which must not have any special objects, to given data of CompactSize() bytes.
+         */
+        static void Compact(Cell const * cells, int cols, size_t runs, char * data) {
+            Cell * templates = reinterpret_cast<Cell *>(data);
+            int * ends = reinterpret_cast<int *>(data + runs * sizeof(Cell));
+            char32_t * codepoints = reinterpret_cast<char32_t *>(data + runs * (sizeof(Cell) + sizeof(int)));
+            size_t run = 0;
+            for (int col = 0; col < cols; ++col) {
+                if (col == 0 || ! SameAttributes(cells[col], templates[run - 1])) {
+                    if (run > 0)
+                        ends[run - 1] = col;
+                    // the cells have no special objects so their bytes can be copied
+                    memcpy(static_cast<void *>(templates + run), static_cast<void const *>(cells + col), sizeof(Cell));
+                    ++run;
+                }
+                codepoints[col] = cells[col].codepoint();
+            }
+            ends[run - 1] = cols;
+        }
+
+        /** Expands the compact form of given number of runs and cells to the cells.
+         */
+        static void Expand(char const * data, size_t runs, Cell * cells) {
+            Cell const * templates = reinterpret_cast<Cell const *>(data);
+            int const * ends = reinterpret_cast<int const *>(data + runs * sizeof(Cell));
+            char32_t const * codepoints = reinterpret_cast<char32_t const *>(data + runs * (sizeof(Cell) + sizeof(int)));
+            int col = 0;
+            for (size_t run = 0; run < runs; ++run) {
+                for (; col < ends[run]; ++col) {
+                    memcpy(static_cast<void *>(cells + col), static_cast<void const *>(templates + run), sizeof(Cell));
+                    cells[col].setCodepoint(codepoints[col]);
+                }
+            }
+        }
+
+        //@}
+
+    private:
+
+        /** Returns true if the two cells differ only in their codepoints.
+
+            The attributes are compared one by one since the padding bytes of the cells may not be initialized.
+         */
+        static bool SameAttributes(Cell const & a, Cell const & b) {
+            return a.fg() == b.fg() && a.bg() == b.bg() && a.decor() == b.decor() && a.font() == b.font() && a.border() == b.border();
+        }
+
+        int cols_;
+        uint32_t runs_ = 0;
+        Cell * cells_ = nullptr;
+        char * data_ = nullptr;
+
+    }; // ui::CompactRow
+
+} // namespace ui
@@ -0,0 +1,455 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+
+#if (defined ARCH_UNIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "helpers/helpers.h"
+#include "helpers/filesystem.h"
+
+#include "ui/canvas.h"
+
+#include "compact_row.h"
+
+namespace ui {
+
+    /** Terminal history lines stored on disk.
+
+        The lines are appended in their compact form (see CompactRow) to segment files in the temporary directory, and only their index, i.e. the segment, offset and size of each line, is kept in memory. The segment files are unlinked as soon as they are opened so that they never outlive the process and are only accessed through their descriptors. The lines are written in batches through a small buffer, which is written in the background when full so that the terminal does not wait for the disk while holding its buffer lock. The lines not yet written are read from the buffers. The segments are read back through read-only memory mappings so that the lines are faulted in on demand through the page cache and only a few segments are mapped at any time, which keeps the resident memory constant regardless of the number of lines. If a segment cannot be mapped, its lines are read from the file instead. Lines are expanded to cells when accessed, the last expanded line is kept so that displaying all of its rows expands it only once.
+
+        Cells are stored without their special objects (such as hyperlinks), which cannot outlive the process. When the segments grow over the size limit, the oldest lines are removed and segments whose lines have all been removed are closed.
+
+        Memory mapped segments are only available on Unix-like systems.
+     */
+    class HistorySegments {
+    public:
+        using Cell = Canvas::Cell;
+
+        /** Default capacity of a segment in bytes. Lines larger than that get a segment of their own. */
+        static constexpr size_t SEGMENT_BYTES = 16 * 1024 * 1024;
+
+        /** Maximum number of segments mapped at the same time. */
+        static constexpr size_t MAX_MAPPED_SEGMENTS = 4;
+
+        /** Number of bytes written to the segments at once. */
+        static constexpr size_t BUFFER_BYTES = 1024 * 1024;
+
+        /** Returns true if the history can be stored on disk on the current platform.
+         */
+        static constexpr bool Available() {
+#if (defined ARCH_UNIX)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        explicit HistorySegments(size_t maxBytes):
+            maxBytes_{maxBytes} {
+        }
+
+        HistorySegments(HistorySegments const &) = delete;
+        HistorySegments & operator = (HistorySegments const &) = delete;
+
+        ~HistorySegments() {
+            clear();
+        }
+
+        size_t maxBytes() const {
+            return maxBytes_;
+        }
+
+        void setMaxBytes(size_t value) {
+            maxBytes_ = value;
+        }
+
+        size_t numLines() const {
+            return lines_.size();
+        }
+
+        /** Returns the number of bytes the stored lines occupy on disk.
+         */
+        size_t bytes() const {
+            return bytes_;
+        }
+
+        int cols(size_t line) const {
+            return lines_[line].cols;
+        }
+
+        /** Returns the cells of given line, expanding it if necessary.
+
+            The cells stay valid until another line is accessed, or the line is removed. If the line cannot be read, its cells are empty.
+         */
+        Cell const * cells(size_t line) {
+            if (expandedLine_ != removed_ + line) {
+                Entry const & e = lines_[line];
+                if (expandedCols_ < e.cols) {
+                    expanded_.reset(new Cell[e.cols]);
+                    expandedCols_ = e.cols;
+                }
+                char const * compact = data(e);
+                if (compact != nullptr) {
+                    CompactRow::Expand(compact, e.runs, expanded_.get());
+                } else {
+                    for (int i = 0; i < e.cols; ++i)
+                        expanded_[i] = Cell{};
+                }
+                expandedLine_ = removed_ + line;
+            }
+            return expanded_.get();
+        }
+
+        /** Appends the line to the last segment, or to a new segment if it does not fit.
+
+            The special objects of the cells, if any, are detached before the cells are stored. Returns false if the line could not be written, in which case the line is not stored.
+         */
+        bool append(Cell * cells, int cols) {
+            ASSERT(cols > 0);
+            for (int i = 0; i < cols; ++i)
+                if (cells[i].hasSpecialObject())
+                    cells[i].detachSpecialObject();
+            size_t runs = CompactRow::CountRuns(cells, cols);
+            size_t size = Size(runs, cols);
+            if (segments_.empty() || segments_.back().used + size > segments_.back().capacity) {
+                if (! flush() || ! createSegment(std::max(SEGMENT_BYTES, size)))
+                    return false;
+            }
+            if (buffered_ + size > BUFFER_BYTES && ! flush())
+                return false;
+            Segment & s = segments_.back();
+            // lines larger than the buffer are written on their own
+            if (size > BUFFER_BYTES) {
+                std::unique_ptr<char[]> data{new char[size]};
+                CompactRow::Compact(cells, cols, runs, data.get());
+                if (! startWrite(data, size))
+                    return false;
+            } else {
+                if (buffer_ == nullptr)
+                    buffer_.reset(new char[BUFFER_BYTES]);
+                CompactRow::Compact(cells, cols, runs, buffer_.get() + buffered_);
+                buffered_ += size;
+            }
+            lines_.push_back(Entry{firstSegment_ + static_cast<uint32_t>(segments_.size() - 1), static_cast<uint32_t>(s.used), cols, static_cast<uint32_t>(runs)});
+            s.used += size;
+            ++s.lines;
+            bytes_ += size;
+            return true;
+        }
+
+        /** Returns true if the stored lines occupy more than the maximum number of bytes.
+         */
+        bool overLimit() const {
+            return bytes_ > maxBytes_;
+        }
+
+        /** Removes the oldest line, deleting its segment if it was the segment's last line.
+         */
+        void popFront() {
+            ASSERT(! lines_.empty());
+            Entry e = lines_.front();
+            lines_.pop_front();
+            ++removed_;
+            bytes_ -= Size(e.runs, e.cols);
+            if (--segments_[e.segment - firstSegment_].lines == 0 && e.segment == firstSegment_) {
+                // the last segment is kept open for the next lines
+                if (segments_.size() > 1 || lines_.empty()) {
+                    if (segments_.size() == 1)
+                        buffered_ = 0;
+                    close(segments_.front());
+                    segments_.pop_front();
+                    ++firstSegment_;
+                }
+            }
+        }
+
+        /** Removes all lines and closes their segments.
+         */
+        void clear() {
+            finishWrite();
+            for (Segment & s : segments_)
+                close(s);
+            firstSegment_ += static_cast<uint32_t>(segments_.size());
+            segments_.clear();
+            removed_ += lines_.size();
+            lines_.clear();
+            bytes_ = 0;
+            buffered_ = 0;
+        }
+
+    private:
+
+        struct Entry {
+            /** Absolute number of the segment. */
+            uint32_t segment;
+            /** Offset of the line's compact form in the segment. */
+            uint32_t offset;
+            int cols;
+            uint32_t runs;
+        };
+
+        struct Segment {
+            /** Path of the already unlinked file, for the error messages. */
+            std::string path;
+            int fd = -1;
+            size_t capacity = 0;
+            /** Bytes stored in the segment, including those still in the buffer. */
+            size_t used = 0;
+            /** Bytes written to the segment file, or being written in the background. */
+            size_t written = 0;
+            size_t lines = 0;
+            void * map = nullptr;
+            size_t lastUsed = 0;
+        };
+
+        /** Returns the size of the compact form of a line, padded so that the next line stays aligned for the cells.
+         */
+        static size_t Size(size_t runs, int cols) {
+            size_t size = CompactRow::CompactSize(runs, cols);
+            return (size + alignof(Cell) - 1) / alignof(Cell) * alignof(Cell);
+        }
+
+        /** Returns the compact form of given line, either from the buffers, or from its segment, which is mapped if necessary.
+
+            If the segment cannot be mapped, the line is read from the file. Returns nullptr if the line cannot be read at all.
+         */
+        char const * data(Entry const & e) {
+            Segment & s = segments_[e.segment - firstSegment_];
+            if (e.offset >= s.written)
+                return buffer_.get() + (e.offset - s.written);
+            // the buffer written last is kept until the next write, so its lines are read from memory even if the write is still in progress
+            if (e.segment == writingSegment_ && e.offset >= writingOffset_ && e.offset < writingOffset_ + writingSize_)
+                return writing_.get() + (e.offset - writingOffset_);
+            if (s.map != nullptr || map(s)) {
+                s.lastUsed = ++useCounter_;
+                return static_cast<char const *>(s.map) + e.offset;
+            }
+            return read(s, e);
+        }
+
+        bool createSegment(size_t capacity) {
+#if (defined ARCH_UNIX)
+            Segment s;
+            try {
+                std::filesystem::path temp{TempDir()};
+                s.path = (temp / UniqueNameIn(temp, "tpp-history-")).string();
+            } catch (std::exception const & e) {
+                LOG() << "Unable to create history segment: " << e.what();
+                return false;
+            }
+            s.capacity = capacity;
+            s.fd = ::open(s.path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+            if (s.fd < 0) {
+                LOG() << "Unable to create history segment " << s.path;
+                return false;
+            }
+            // the file is only accessed through its descriptor and is deleted with it
+            unlink(s.path.c_str());
+            // the file is sparse, only the written bytes occupy the disk, but the whole capacity can be mapped at once
+            if (ftruncate(s.fd, static_cast<off_t>(capacity)) != 0) {
+                LOG() << "Unable to create history segment " << s.path;
+                close(s);
+                return false;
+            }
+            segments_.push_back(std::move(s));
+            return true;
+#else
+            MARK_AS_UNUSED(capacity);
+            return false;
+#endif
+        }
+
+        /** Starts writing the buffered lines to the last segment.
+         */
+        bool flush() {
+            if (buffered_ == 0)
+                return true;
+            if (! startWrite(buffer_, buffered_))
+                return false;
+            buffered_ = 0;
+            return true;
+        }
+
+        /** Starts writing the data at the end of the last segment in the background.
+
+            Waits for the previous write to finish first and takes over the data, giving the buffer of the previous write in exchange. Returns false if any write has failed.
+         */
+        bool startWrite(std::unique_ptr<char[]> & data, size_t size) {
+            if (! finishWrite())
+                return false;
+            Segment & s = segments_.back();
+            std::swap(writing_, data);
+            writingSegment_ = firstSegment_ + static_cast<uint32_t>(segments_.size() - 1);
+            writingOffset_ = s.written;
+            writingSize_ = size;
+            write_ = std::async(std::launch::async, Write, s.fd, s.path, writing_.get(), size, s.written);
+            s.written += size;
+            return true;
+        }
+
+        /** Waits for the write in progress, if any, and returns false if any write has failed.
+         */
+        bool finishWrite() {
+            if (write_.valid() && ! write_.get())
+                writeFailed_ = true;
+            return ! writeFailed_;
+        }
+
+        /** Writes the bytes at given offset of the segment file.
+         */
+        static bool Write(int fd, std::string path, char const * buffer, size_t size, size_t at) {
+#if (defined ARCH_UNIX)
+            off_t offset = static_cast<off_t>(at);
+            while (size > 0) {
+                ssize_t written = pwrite(fd, buffer, size, offset);
+                if (written < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    LOG() << "Unable to write history segment " << path;
+                    return false;
+                }
+                buffer += written;
+                size -= written;
+                offset += written;
+            }
+            return true;
+#else
+            MARK_AS_UNUSED(fd);
+            MARK_AS_UNUSED(path);
+            MARK_AS_UNUSED(buffer);
+            MARK_AS_UNUSED(size);
+            MARK_AS_UNUSED(at);
+            return false;
+#endif
+        }
+
+        /** Maps the whole capacity of the segment, unmapping the least recently used segment first if too many are mapped. Returns false if the segment cannot be mapped.
+         */
+        bool map(Segment & s) {
+#if (defined ARCH_UNIX)
+            if (mapped_ == MAX_MAPPED_SEGMENTS) {
+                Segment * lru = nullptr;
+                for (Segment & x : segments_)
+                    if (x.map != nullptr && (lru == nullptr || x.lastUsed < lru->lastUsed))
+                        lru = & x;
+                unmap(*lru);
+            }
+            void * map = mmap(nullptr, s.capacity, PROT_READ, MAP_SHARED, s.fd, 0);
+            if (map == MAP_FAILED) {
+                LOG() << "Unable to map history segment " << s.path << ", errno " << errno;
+                return false;
+            }
+            s.map = map;
+            ++mapped_;
+            return true;
+#else
+            MARK_AS_UNUSED(s);
+            return false;
+#endif
+        }
+
+        /** Reads the compact form of the line from the segment file, returns nullptr if it cannot be read.
+         */
+        char const * read(Segment & s, Entry const & e) {
+#if (defined ARCH_UNIX)
+            size_t size = Size(e.runs, e.cols);
+            if (readSize_ < size) {
+                read_.reset(new char[size]);
+                readSize_ = size;
+            }
+            char * buffer = read_.get();
+            off_t offset = static_cast<off_t>(e.offset);
+            while (size > 0) {
+                ssize_t bytes = pread(s.fd, buffer, size, offset);
+                if (bytes <= 0) {
+                    if (bytes < 0 && errno == EINTR)
+                        continue;
+                    LOG() << "Unable to read history segment " << s.path;
+                    return nullptr;
+                }
+                buffer += bytes;
+                size -= bytes;
+                offset += bytes;
+            }
+            return read_.get();
+#else
+            MARK_AS_UNUSED(s);
+            MARK_AS_UNUSED(e);
+            return nullptr;
+#endif
+        }
+
+        void unmap(Segment & s) {
+#if (defined ARCH_UNIX)
+            if (s.map != nullptr) {
+                munmap(s.map, s.capacity);
+                s.map = nullptr;
+                --mapped_;
+            }
+#else
+            MARK_AS_UNUSED(s);
+#endif
+        }
+
+        void close(Segment & s) {
+#if (defined ARCH_UNIX)
+            // the write in progress may use the file
+            finishWrite();
+            unmap(s);
+            if (s.fd >= 0) {
+                ::close(s.fd);
+                s.fd = -1;
+            }
+#else
+            MARK_AS_UNUSED(s);
+#endif
+        }
+
+        size_t maxBytes_;
+        size_t bytes_ = 0;
+
+        std::deque<Entry> lines_;
+        std::deque<Segment> segments_;
+
+        /** Absolute number of the first segment in segments_. */
+        uint32_t firstSegment_ = 0;
+
+        /** Number of lines removed so far, which turns line indices into absolute line numbers. */
+        size_t removed_ = 0;
+
+        size_t mapped_ = 0;
+        size_t useCounter_ = 0;
+
+        /** Lines of the last segment not yet written to its file. */
+        std::unique_ptr<char[]> buffer_;
+        size_t buffered_ = 0;
+
+        /** Data of the last write, which may still be in progress, its absolute segment number, offset and size, and the result of the write. */
+        std::unique_ptr<char[]> writing_;
+        uint32_t writingSegment_ = 0;
+        size_t writingOffset_ = 0;
+        size_t writingSize_ = 0;
+        std::future<bool> write_;
+        bool writeFailed_ = false;
+
+        /** Buffer for the lines read from the segment files which cannot be mapped. */
+        std::unique_ptr<char[]> read_;
+        size_t readSize_ = 0;
+
+        /** Cells of the last expanded line and its absolute number. */
+        std::unique_ptr<Cell[]> expanded_;
+        int expandedCols_ = 0;
+        size_t expandedLine_ = SIZE_MAX;
+
+    }; // ui::HistorySegments
+
+} // namespace ui
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "helpers/helpers.h"
+
+#include "ui/inputs.h"
+
+namespace ui {
+
+    /** Table of the sequences the terminal sends to the PTY for key presses.
+
+        The table is indexed directly by the key code and its Shift, Ctrl and Alt modifiers and each entry holds its sequence inline, so that encoding a key press is a single array access without any hashing, or allocations. Unmodified keys have separate entries for the application cursor and application keypad modes, which take precedence over the normal ones when the respective mode is enabled. Keys with the Win modifier, or codes outside of the table never produce any sequence.
+     */
+    class KeyTable {
+    public:
+
+        /** Maximum length of a sequence, i.e. `ESC [ 2 4 ; 8 ~`.
+         */
+        static constexpr size_t MAX_SEQUENCE_LENGTH = 7;
+
+        /** Sequence for a single key, empty if the key sends nothing.
+         */
+        class Sequence {
+        public:
+            char const * data() const {
+                return data_;
+            }
+
+            size_t size() const {
+                return size_;
+            }
+
+            bool empty() const {
+                return size_ == 0;
+            }
+
+            bool operator == (char const * other) const {
+                return strlen(other) == size_ && memcmp(data_, other, size_) == 0;
+            }
+
+        private:
+            friend class KeyTable;
+
+            char data_[MAX_SEQUENCE_LENGTH] = {};
+            uint8_t size_ = 0;
+        }; // KeyTable::Sequence
+
+        /** Returns the sequence for given key in the given modes.
+         */
+        Sequence const & get(Key key, bool applicationCursor = false, bool applicationKeypad = false) const {
+            unsigned code = key.code();
+            if (code >= CODES || (key & Key::Win))
+                return empty_;
+            size_t modifiers = ModifiersIndex(key);
+            if (modifiers == 0) {
+                if (applicationCursor && ! cursorApplication_[code].empty())
+                    return cursorApplication_[code];
+                if (applicationKeypad && ! keypadApplication_[code].empty())
+                    return keypadApplication_[code];
+            }
+            return normal_[modifiers * CODES + code];
+        }
+
+        /** Sets the sequence for given key unless one is already present.
+
+            Returns true if the sequence has been set. Sequences longer than MAX_SEQUENCE_LENGTH are rejected.
+         */
+        bool set(Key key, char const * sequence, size_t size) {
+            Sequence * s = entry(key);
+            return s != nullptr && s->empty() && Set(*s, sequence, size);
+        }
+
+        /** Sets the sequence for given unmodified key in the application cursor mode.
+
+            Returns false if the sequence is longer than MAX_SEQUENCE_LENGTH, in which case the entry is left intact.
+         */
+        bool setCursorApplication(Key key, char const * sequence, size_t size) {
+            ASSERT(key.code() < CODES && key.modifiers() == Key::Invalid);
+            return Set(cursorApplication_[key.code()], sequence, size);
+        }
+
+        /** Sets the sequence for given unmodified key in the application keypad mode.
+
+            Returns false if the sequence is longer than MAX_SEQUENCE_LENGTH, in which case the entry is left intact.
+         */
+        bool setKeypadApplication(Key key, char const * sequence, size_t size) {
+            ASSERT(key.code() < CODES && key.modifiers() == Key::Invalid);
+            return Set(keypadApplication_[key.code()], sequence, size);
+        }
+
+        /** Removes the sequence of given key in the normal mode.
+         */
+        void clear(Key key) {
+            Sequence * s = entry(key);
+            if (s != nullptr)
+                *s = Sequence{};
+        }
+
+    private:
+
+        /** Key codes all fit in a byte. */
+        static constexpr size_t CODES = 256;
+
+        /** Combinations of the Shift, Ctrl and Alt modifiers. */
+        static constexpr size_t MODIFIERS = 8;
+
+        static size_t ModifiersIndex(Key key) {
+            return ((key & Key::Shift) ? 1 : 0) | ((key & Key::Ctrl) ? 2 : 0) | ((key & Key::Alt) ? 4 : 0);
+        }
+
+        /** Copies the sequence to the entry, unless it is too long, in which case returns false.
+         */
+        static bool Set(Sequence & s, char const * sequence, size_t size) {
+            if (size > MAX_SEQUENCE_LENGTH)
+                return false;
+            memcpy(s.data_, sequence, size);
+            s.size_ = static_cast<uint8_t>(size);
+            return true;
+        }
+
+        /** Returns the normal mode entry for given key, or nullptr if the key cannot be stored.
+         */
+        Sequence * entry(Key key) {
+            if (key.code() >= CODES || (key & Key::Win))
+                return nullptr;
+            return normal_ + ModifiersIndex(key) * CODES + key.code();
+        }
+
+        Sequence normal_[CODES * MODIFIERS];
+        Sequence cursorApplication_[CODES];
+        Sequence keypadApplication_[CODES];
+        Sequence empty_;
+
+    }; // ui::KeyTable
+
+} // namespace ui
@@ -0,0 +1,491 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <utility>
+
+#include "helpers/helpers.h"
+#include "helpers/memory.h"
+
+#include "ui/canvas.h"
+
+#include "compact_row.h"
+#include "history_segments.h"
+
+namespace ui {
+
+    /** Scrollback history of the terminal.
+
+        The history stores logical lines, i.e. the rows scrolled out of the terminal concatenated up to and including the row that terminates the line, and wraps them at the current width only when its rows are accessed. For each line the history keeps the number of the first row it occupies at the current width in a prefix index so that finding a row is a binary search over the lines. Changing the width only invalidates the index, which is rebuilt from the lengths of the lines, without touching their cells, when the rows are accessed next. Resizing the terminal therefore never reallocates, or copies the history.
+
+        Lines older than the expanded ones can be stored in the compact form (see CompactRow) while the terminal is hidden, they are expanded back when their rows are accessed.
+
+        Optionally, the oldest lines can be moved to disk (see HistorySegments) instead of being removed when the history has more rows than allowed, in which case the maximum number of rows only limits the rows kept in memory and the history is limited by the size of the lines on disk instead. The lines on disk are the oldest lines of the history and are indexed together with the lines in memory.
+
+        The history is not thread-safe, the terminal guards it with its buffer lock.
+     */
+    class TerminalHistory {
+    public:
+        using Cell = Canvas::Cell;
+
+        TerminalHistory() = default;
+
+        TerminalHistory(TerminalHistory const &) = delete;
+        TerminalHistory & operator = (TerminalHistory const &) = delete;
+
+        int width() const {
+            return width_;
+        }
+
+        /** Sets the width at which the lines are wrapped.
+
+            Only invalidates the row index. If the history has more rows at the new width than allowed, the oldest lines are removed when a row is added next.
+         */
+        void setWidth(int value) {
+            value = std::max(value, 1);
+            if (value != width_) {
+                width_ = value;
+                firstRows_.clear();
+            }
+        }
+
+        size_t maxRows() const {
+            return maxRows_;
+        }
+
+        void setMaxRows(size_t value) {
+            maxRows_ = value;
+            trim();
+        }
+
+        /** Returns the maximum number of bytes of the lines stored on disk, 0 if the lines are not stored on disk.
+         */
+        size_t maxDiskBytes() const {
+            return disk_ == nullptr ? 0 : disk_->maxBytes();
+        }
+
+        /** Sets the maximum number of bytes of the lines stored on disk.
+
+            If 0, or if the platform does not support storing the lines on disk, the lines already on disk are removed and the oldest lines are removed from the history when there are more rows than allowed.
+         */
+        void setMaxDiskBytes(size_t value) {
+            if (! HistorySegments::Available())
+                value = 0;
+            if (value == 0) {
+                while (diskLines() > 0)
+                    popFront();
+                disk_.reset();
+            } else if (disk_ == nullptr) {
+                disk_.reset(new HistorySegments{value});
+            } else {
+                disk_->setMaxBytes(value);
+            }
+            trim();
+        }
+
+        /** Returns the number of rows in the history at the current width.
+         */
+        size_t rows() const {
+            size_t n = numLines();
+            if (n == 0)
+                return 0;
+            updateIndex();
+            return firstRows_.back() + rowsOf(cols(n - 1)) - firstRows_.front();
+        }
+
+        /** Returns the number of logical lines in the history, including the compacted ones.
+         */
+        size_t numLines() const {
+            return diskLines() + compacted_.size() + lines_.size();
+        }
+
+        /** Returns the number of lines stored in the compact form.
+         */
+        size_t compactedLines() const {
+            size_t result = 0;
+            for (CompactRow const & line : compacted_)
+                if (line.compacted())
+                    ++result;
+            return result;
+        }
+
+        /** Returns the number of bytes the lines stored on disk occupy.
+         */
+        size_t diskBytes() const {
+            return disk_ == nullptr ? 0 : disk_->bytes();
+        }
+
+        /** Returns the number of bytes used to store the lines in memory.
+         */
+        size_t bytes() const {
+            size_t result = 0;
+            for (Line const & line : lines_)
+                result += line.bytes();
+            for (CompactRow const & line : compacted_)
+                result += line.bytes();
+            return result;
+        }
+
+        /** Adds a row to the history, taking ownership of its cells.
+
+            If the last line has not been terminated yet, the row is appended to it, otherwise the row starts a new line. The oldest rows are then removed if the history has more than the maximum number of rows.
+         */
+        void addRow(Cell * cells, int cols, bool terminated) {
+            ASSERT(cells != nullptr && cols > 0);
+            if (! lines_.empty() && ! lines_.back().terminated) {
+                lines_.back().append(cells, cols);
+                delete [] cells;
+            } else {
+                lines_.emplace_back(cells, cols);
+            }
+            Line & line = lines_.back();
+            line.terminated = terminated;
+            // lines that grew over several rows no longer need their spare capacity
+            if (terminated)
+                line.shrink();
+            trim();
+        }
+
+        /** Returns the cells of given history row and their number, which may be smaller than the width if the line was terminated before.
+
+            Expands the compacted lines, if any. Rows of the lines on disk are expanded from their compact form, their cells stay valid until a row of another line on disk is accessed.
+         */
+        std::pair<Cell const *, int> row(size_t index) {
+            ASSERT(index < rows());
+            expand();
+            updateIndex();
+            size_t line = static_cast<size_t>(std::upper_bound(firstRows_.begin(), firstRows_.end(), firstRows_.front() + index) - firstRows_.begin()) - 1;
+            int offset = static_cast<int>(firstRows_.front() + index - firstRows_[line]) * width_;
+            size_t onDisk = diskLines();
+            Cell const * cells = line < onDisk ? disk_->cells(line) : lines_[line - onDisk].cells();
+            return std::make_pair(cells + offset, std::min(width_, cols(line) - offset));
+        }
+
+        /** Stores the lines in the compact form.
+
+            An unterminated last line is kept as it is since the next row scrolled out of the terminal would be appended to it.
+         */
+        void compact() {
+            size_t keep = (! lines_.empty() && ! lines_.back().terminated) ? 1 : 0;
+            while (lines_.size() > keep) {
+                int cols = lines_.front().cols();
+                compacted_.emplace_back(lines_.front().release(), cols);
+                lines_.pop_front();
+            }
+            // release the memory held by the emptied deque's blocks as well
+            lines_.shrink_to_fit();
+        }
+
+        /** Expands the compacted lines, if any, so that all lines are available as cells.
+         */
+        void expand() {
+            if (compacted_.empty())
+                return;
+            // the compacted lines are older than any expanded lines and always terminated
+            for (auto i = compacted_.rbegin(), e = compacted_.rend(); i != e; ++i) {
+                int cols = i->cols();
+                lines_.emplace_front(i->release(), cols);
+                lines_.front().terminated = true;
+            }
+            compacted_.clear();
+        }
+
+        void clear() {
+            lines_.clear();
+            compacted_.clear();
+            firstRows_.clear();
+            if (disk_ != nullptr)
+                disk_->clear();
+        }
+
+    private:
+
+        /** Logical line of the history.
+
+            The line's cells are stored in a buffer that grows geometrically when rows are appended to the line. When the oldest rows of the line are removed, only the beginning of the line is moved and the space of the dropped cells is reused once the end of the buffer is reached. Unless the line has ever contained special objects, its cells are copied as plain memory. Most lines are never copied so the line is checked for special objects only when first needed.
+         */
+        class Line {
+        public:
+            bool terminated = false;
+
+            Line(Cell * cells, int cols):
+                buffer_{cells},
+                capacity_{cols},
+                end_{cols} {
+            }
+
+            Line(Line && from) noexcept:
+                terminated{from.terminated},
+                buffer_{from.buffer_},
+                capacity_{from.capacity_},
+                begin_{from.begin_},
+                end_{from.end_},
+                checked_{from.checked_},
+                plain_{from.plain_} {
+                from.buffer_ = nullptr;
+            }
+
+            Line & operator = (Line && from) noexcept {
+                if (this != & from) {
+                    delete [] buffer_;
+                    terminated = from.terminated;
+                    buffer_ = from.buffer_;
+                    capacity_ = from.capacity_;
+                    begin_ = from.begin_;
+                    end_ = from.end_;
+                    checked_ = from.checked_;
+                    plain_ = from.plain_;
+                    from.buffer_ = nullptr;
+                }
+                return *this;
+            }
+
+            Line(Line const &) = delete;
+            Line & operator = (Line const &) = delete;
+
+            ~Line() {
+                delete [] buffer_;
+            }
+
+            Cell * cells() const {
+                return buffer_ + begin_;
+            }
+
+            int cols() const {
+                return end_ - begin_;
+            }
+
+            size_t bytes() const {
+                return capacity_ * sizeof(Cell);
+            }
+
+            void append(Cell const * cells, int cols) {
+                if (end_ + cols > capacity_) {
+                    // a line whose oldest rows are being removed reuses the space of the dropped cells, otherwise the buffer grows
+                    if (begin_ >= capacity_ / 2 && this->cols() + cols <= capacity_) {
+                        move(buffer_, buffer_ + begin_, this->cols());
+                        end_ -= begin_;
+                        begin_ = 0;
+                    } else {
+                        reallocate(std::max(this->cols() + cols, this->cols() * 2));
+                    }
+                }
+                plain_ = plain() && PlainCells(cells, cols);
+                if (plain_)
+                    memcpy(static_cast<void *>(buffer_ + end_), static_cast<void const *>(cells), sizeof(Cell) * cols);
+                else
+                    MemCopy(buffer_ + end_, cells, cols);
+                end_ += cols;
+            }
+
+            /** Removes given number of cells from the beginning of the line.
+             */
+            void dropFront(int cols) {
+                ASSERT(cols < this->cols());
+                begin_ += cols;
+            }
+
+            /** Releases the spare capacity of the line.
+             */
+            void shrink() {
+                if (begin_ != 0 || end_ != capacity_)
+                    reallocate(cols());
+            }
+
+            /** Returns the cells of the line in an array of the line's size and gives up their ownership.
+             */
+            Cell * release() {
+                shrink();
+                Cell * result = buffer_;
+                buffer_ = nullptr;
+                capacity_ = 0;
+                begin_ = 0;
+                end_ = 0;
+                return result;
+            }
+
+        private:
+
+            static bool PlainCells(Cell const * cells, int cols) {
+                for (int i = 0; i < cols; ++i)
+                    if (cells[i].hasSpecialObject())
+                        return false;
+                return true;
+            }
+
+            /** Returns true if the line has no special objects.
+
+                The buffer is never reallocated before the first check, so checking the whole buffer covers the dropped cells as well.
+             */
+            bool plain() {
+                if (! checked_) {
+                    plain_ = PlainCells(buffer_, capacity_);
+                    checked_ = true;
+                }
+                return plain_;
+            }
+
+            /** Moves the cells within, or between the line's buffers, as plain memory if the line has no special objects.
+             */
+            void move(Cell * to, Cell * from, int cols) {
+                // casting to void * so that compiler won't give warnings that non POD object is copied, there are no special objects
+                if (plain())
+                    memmove(static_cast<void *>(to), static_cast<void const *>(from), sizeof(Cell) * cols);
+                else
+                    MemMove(to, from, cols);
+            }
+
+            void reallocate(int capacity) {
+                int cols = this->cols();
+                Cell * buffer = new Cell[capacity];
+                move(buffer, buffer_ + begin_, cols);
+                delete [] buffer_;
+                buffer_ = buffer;
+                capacity_ = capacity;
+                begin_ = 0;
+                end_ = cols;
+            }
+
+            Cell * buffer_;
+            int capacity_;
+            int begin_ = 0;
+            int end_;
+            bool checked_ = false;
+            bool plain_ = false;
+        }; // TerminalHistory::Line
+
+        size_t rowsOf(int cols) const {
+            return static_cast<size_t>((cols + width_ - 1) / width_);
+        }
+
+        size_t diskLines() const {
+            return disk_ == nullptr ? 0 : disk_->numLines();
+        }
+
+        /** Returns the number of cells of given line, counting the lines on disk first and the compacted lines next.
+         */
+        int cols(size_t line) const {
+            size_t onDisk = diskLines();
+            if (line < onDisk)
+                return disk_->cols(line);
+            line -= onDisk;
+            return line < compacted_.size() ? compacted_[line].cols() : lines_[line - compacted_.size()].cols();
+        }
+
+        /** Adds the first rows of the lines missing from the index.
+         */
+        void updateIndex() const {
+            for (size_t i = firstRows_.size(), e = numLines(); i < e; ++i)
+                firstRows_.push_back(i == 0 ? 0 : firstRows_.back() + rowsOf(cols(i - 1)));
+        }
+
+        void popFront() {
+            if (diskLines() > 0)
+                disk_->popFront();
+            else if (! compacted_.empty())
+                compacted_.pop_front();
+            else
+                lines_.pop_front();
+            if (! firstRows_.empty())
+                firstRows_.pop_front();
+        }
+
+        /** Removes the oldest rows while there are more rows than allowed.
+
+            Whole lines are removed where possible, otherwise the rows are dropped from the beginning of the oldest line.
+         */
+        void trim() {
+            if (disk_ != nullptr) {
+                moveToDisk();
+                return;
+            }
+            for (size_t total = rows(); total > maxRows_; ) {
+                size_t excess = total - maxRows_;
+                size_t oldest = rowsOf(cols(0));
+                if (oldest <= excess) {
+                    popFront();
+                    total -= oldest;
+                } else {
+                    expand();
+                    lines_.front().dropFront(static_cast<int>(excess) * width_);
+                    firstRows_.front() += excess;
+                    break;
+                }
+            }
+        }
+
+        /** Moves the oldest lines in memory to disk while there are more rows in memory than allowed, then removes the oldest lines on disk while they occupy more bytes than allowed.
+
+            Moving the lines keeps their order and so the index does not change. An unterminated last line can still grow, so only its oldest rows are moved to disk as a separate line. If a line cannot be written, the lines on disk are removed and the history is no longer stored on disk.
+         */
+        void moveToDisk() {
+            size_t n = numLines();
+            if (n == 0)
+                return;
+            updateIndex();
+            size_t end = firstRows_.back() + rowsOf(cols(n - 1));
+            for (size_t first = diskLines(); first < n && end - firstRows_[first] > maxRows_; first = diskLines()) {
+                bool written;
+                if (first + 1 < n || lines_.back().terminated) {
+                    if (! compacted_.empty()) {
+                        int cols = compacted_.front().cols();
+                        Cell * cells = compacted_.front().release();
+                        written = disk_->append(cells, cols);
+                        if (written) {
+                            delete [] cells;
+                            compacted_.pop_front();
+                        } else {
+                            compacted_.front() = CompactRow{cells, cols};
+                        }
+                    } else {
+                        written = disk_->append(lines_.front().cells(), lines_.front().cols());
+                        if (written)
+                            lines_.pop_front();
+                    }
+                } else {
+                    Line & line = lines_.back();
+                    size_t excess = std::min(end - firstRows_[first] - maxRows_, rowsOf(line.cols()) - 1);
+                    if (excess == 0)
+                        break;
+                    int cols = static_cast<int>(excess) * width_;
+                    written = disk_->append(line.cells(), cols);
+                    if (written) {
+                        line.dropFront(cols);
+                        // the moved rows are a new line, followed by the rest of the line
+                        firstRows_.push_back(firstRows_[first] + excess);
+                        ++n;
+                    }
+                }
+                // the line stays in memory and is removed as if the history was not stored on disk
+                if (! written) {
+                    setMaxDiskBytes(0);
+                    return;
+                }
+            }
+            while (disk_->overLimit() && disk_->numLines() > 0)
+                popFront();
+        }
+
+        int width_ = 1;
+        size_t maxRows_ = 0;
+
+        /** Expanded lines, newer than the compacted ones. */
+        std::deque<Line> lines_;
+
+        /** Lines older than those in lines_ stored in the compact form while the terminal is hidden. */
+        std::deque<CompactRow> compacted_;
+
+        /** First row of each line at the current width, counted from the beginning of the history, for a prefix of the lines.
+
+            The numbers are not rebased when the oldest lines are removed, the first row of the oldest line is subtracted instead.
+         */
+        mutable std::deque<size_t> firstRows_;
+
+        /** Lines older than the compacted ones stored on disk, nullptr if the history is kept in memory only. */
+        std::unique_ptr<HistorySegments> disk_;
+
+    }; // ui::TerminalHistory
+
+} // namespace ui
@@ -0,0 +1,154 @@
+#include <string>
+
+#include "helpers/tests.h"
+
+#include "test_terminal.h"
+
+using namespace ui;
+
+namespace {
+
+    bool Indexed(Canvas::Cell const & cell, uint16_t flags) {
+        return (cell.font().customBits() & flags) == flags;
+    }
+
+} // anonymous namespace
+
+TEST(ansi_terminal, paletteColorsAreIndexed) {
+    using T = TestTerminal;
+    TestTerminal t{Size{10, 5}, 0, false};
+    t.feed("\x1b[31;42ma\x1b[91;102mb\x1b[38;5;123;48;5;200mc\x1b[38;2;1;2;3;48;2;4;5;6md\x1b[0me");
+    Canvas::Cell a = t.bufferCell(Point{0, 0});
+    EXPECT(Indexed(a, T::FG_INDEXED | T::BG_INDEXED | T::DECOR_INDEXED));
+    EXPECT(a.fg() == T::PaletteColor(1) && a.decor() == T::PaletteColor(1));
+    EXPECT(a.bg() == T::PaletteColor(2));
+    Canvas::Cell b = t.bufferCell(Point{1, 0});
+    EXPECT(b.fg() == T::PaletteColor(9) && b.bg() == T::PaletteColor(10));
+    Canvas::Cell c = t.bufferCell(Point{2, 0});
+    EXPECT(Indexed(c, T::FG_INDEXED | T::BG_INDEXED));
+    EXPECT(c.fg() == T::PaletteColor(123) && c.bg() == T::PaletteColor(200));
+    // true colors are stored as they are
+    Canvas::Cell d = t.bufferCell(Point{3, 0});
+    EXPECT_EQ(d.font().customBits(), 0);
+    EXPECT(d.fg() == Color(1, 2, 3) && d.bg() == Color(4, 5, 6));
+    Canvas::Cell e = t.bufferCell(Point{4, 0});
+    EXPECT(e.fg() == T::PaletteColor(T::DEFAULT_FOREGROUND) && e.bg() == T::PaletteColor(T::DEFAULT_BACKGROUND));
+    AnsiTerminal::Palette const & palette = t.palette();
+    EXPECT(t.resolved(a).fg() == palette[1] && t.resolved(a).bg() == palette[2]);
+    EXPECT(t.resolved(c).fg() == palette[123] && t.resolved(c).bg() == palette[200]);
+    EXPECT(t.resolved(e).fg() == palette.defaultForeground() && t.resolved(e).bg() == palette.defaultBackground());
+    EXPECT_EQ(t.resolved(a).font().customBits(), 0);
+}
+
+TEST(ansi_terminal, inverseSwapsIndexedColors) {
+    using T = TestTerminal;
+    TestTerminal t{Size{10, 5}, 0, false};
+    t.feed("\x1b[31;42;7ma\x1b[27;38;2;1;2;3;7mb");
+    Canvas::Cell a = t.bufferCell(Point{0, 0});
+    EXPECT(Indexed(a, T::FG_INDEXED | T::BG_INDEXED | T::DECOR_INDEXED));
+    EXPECT(a.fg() == T::PaletteColor(2) && a.decor() == T::PaletteColor(2) && a.bg() == T::PaletteColor(1));
+    // the true color foreground becomes the background, the indexed background the foreground
+    Canvas::Cell b = t.bufferCell(Point{1, 0});
+    EXPECT(Indexed(b, T::FG_INDEXED | T::DECOR_INDEXED));
+    EXPECT(! Indexed(b, T::BG_INDEXED));
+    EXPECT(b.fg() == T::PaletteColor(2) && b.bg() == Color(1, 2, 3));
+}
+
+TEST(ansi_terminal, setPaletteRecolorsScreenAndHistory) {
+    TestTerminal t{Size{10, 2}, 100, false};
+    t.feed("\x1b[31ma\x1b[38;2;1;2;3mb\r\n\x1b[31mc\r\n\x1b[31md");
+    EXPECT_EQ(t.historyRows(), 1);
+    AnsiTerminal::Palette palette{AnsiTerminal::Palette::XTerm256()};
+    palette[1] = Color(10, 20, 30);
+    palette.setDefaultBackground(Color(40, 50, 60));
+    t.setPalette(palette);
+    EXPECT(t.resolved(t.historyCell(0, 0)).fg() == Color(10, 20, 30));
+    EXPECT(t.resolved(t.historyCell(0, 0)).bg() == Color(40, 50, 60));
+    EXPECT(t.resolved(t.historyCell(0, 1)).fg() == Color(1, 2, 3));
+    EXPECT(t.resolved(t.bufferCell(Point{0, 0})).fg() == Color(10, 20, 30));
+    EXPECT(t.resolved(t.bufferCell(Point{0, 1})).fg() == Color(10, 20, 30));
+}
+
+TEST(ansi_terminal, copyRowTrimsDefaultBackground) {
+    using T = TestTerminal;
+    Canvas::Cell row[10];
+    for (Canvas::Cell & c : row)
+        c = T::DefaultCell();
+    row[0].setCodepoint('a');
+    row[1].setCodepoint('b');
+    T::Buffer::MarkAsLineEnd(row[1]);
+    std::pair<Canvas::Cell *, int> copy = T::Buffer::CopyRow(row, 10, T::PaletteColor(T::DEFAULT_BACKGROUND));
+    EXPECT_EQ(copy.second, 2);
+    delete [] copy.first;
+    // cells with other than the default background are kept
+    row[5].setBg(T::PaletteColor(1));
+    copy = T::Buffer::CopyRow(row, 10, T::PaletteColor(T::DEFAULT_BACKGROUND));
+    EXPECT_EQ(copy.second, 10);
+    delete [] copy.first;
+}
+
+TEST(ansi_terminal, discardBoundarySkipsEscapeSequences) {
+    auto boundary = [](std::string s, bool insideString = false) {
+        return TestTerminal::DiscardBoundary(s.data(), s.data() + s.size(), insideString) - s.data();
+    };
+    EXPECT_EQ(boundary("abc\ndef"), 4);
+    EXPECT_EQ(boundary("abc"), 0);
+    // line ends in incomplete sequences
+    EXPECT_EQ(boundary("ab\ncd\x1b]0;ti\ntle"), 3);
+    EXPECT_EQ(boundary("ab\n\x1b[3\n1"), 3);
+    // terminated sequences
+    EXPECT_EQ(boundary("\x1b]0;a\nb\x07x\ny"), 10);
+    EXPECT_EQ(boundary("\x1bP+a\nb\x1b\\x\ny"), 10);
+    EXPECT_EQ(boundary("\x1b[31m\x1b(Bx\ny"), 10);
+    // input starting in the payload of a string sequence
+    EXPECT_EQ(boundary("pay\nload", true), 0);
+    EXPECT_EQ(boundary("pay\nload\x1b\\ok\nz", true), 13);
+}
+
+TEST(ansi_terminal, discardDoesNotCutSequences) {
+    TestTerminal t{Size{10, 5}, 0, false};
+    t.feedDiscarding("a\r\n\x1b]1;x\ny\x07" "b");
+    EXPECT(t.bufferCell(Point{0, 0}).codepoint() == 'b');
+    // incomplete sequence is kept for the next chunk
+    t.feedDiscarding("c\r\n\x1b[3");
+    t.feed("1md");
+    EXPECT(t.bufferCell(Point{1, 0}).codepoint() == 'd');
+    EXPECT(t.bufferCell(Point{1, 0}).fg() == TestTerminal::PaletteColor(1));
+}
+
+TEST(ansi_terminal, combiningMarkAfterScroll) {
+    TestTerminal t{Size{10, 5}, 0, false};
+    t.feed("e\xcc\x81");
+    EXPECT(t.bufferCell(Point{0, 0}).codepoint() == 0xe9);
+    // the 'e' on the third row moves under the cursor when scrolled up, but the mark must not be composed with it
+    t.feed("\x1b[3;1He\x1b[2;1Ha\x1b[S\xcc\x81");
+    EXPECT(t.bufferCell(Point{0, 1}).codepoint() == 'e');
+}
+
+TEST(ansi_terminal, triggerStylesDoubleWidthMatch) {
+    TestTerminal t{Size{10, 5}, 0, false};
+    AnsiTerminal::Trigger trigger;
+    trigger.pattern = "\xe6\x97\xa5\xe6\x9c\xac"; // U+65E5 U+672C, both double width
+    trigger.style = Hyperlink::Style{Color(1, 2, 3), Color::None, Font{}};
+    t.setTriggers({trigger});
+    t.feed("x\xe6\x97\xa5\xe6\x9c\xacy");
+    // double width glyphs occupy a single cell each
+    EXPECT(t.bufferCell(Point{0, 0}).fg() != Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{1, 0}).fg() == Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{2, 0}).fg() == Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{3, 0}).fg() != Color(1, 2, 3));
+}
+
+TEST(ansi_terminal, triggerStylesWrappedMatch) {
+    TestTerminal t{Size{10, 5}, 0, false};
+    AnsiTerminal::Trigger trigger;
+    trigger.pattern = "abc";
+    trigger.style = Hyperlink::Style{Color(1, 2, 3), Color::None, Font{}};
+    t.setTriggers({trigger});
+    t.feed("12345678abcd");
+    EXPECT(t.bufferCell(Point{7, 0}).fg() != Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{8, 0}).fg() == Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{9, 0}).fg() == Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{0, 1}).fg() == Color(1, 2, 3));
+    EXPECT(t.bufferCell(Point{1, 1}).fg() != Color(1, 2, 3));
+}
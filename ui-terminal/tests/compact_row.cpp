@@ -0,0 +1,42 @@
+#include "helpers/tests.h"
+
+#include "../compact_row.h"
+
+using namespace ui;
+
+TEST(compact_row, roundtrip) {
+    using Cell = Canvas::Cell;
+    Cell * cells = new Cell[80];
+    for (int i = 0; i < 80; ++i) {
+        cells[i].setCodepoint('a' + i % 26);
+        if (i >= 10 && i < 20)
+            cells[i].setFg(Color::Red);
+        if (i >= 30)
+            cells[i].setBg(Color::Blue);
+    }
+    CompactRow row{cells, 80};
+    EXPECT(row.compacted());
+    EXPECT_EQ(row.cols(), 80);
+    EXPECT(row.bytes() < 80 * sizeof(Cell));
+    Cell * expanded = row.release();
+    for (int i = 0; i < 80; ++i) {
+        EXPECT(expanded[i].codepoint() == static_cast<char32_t>('a' + i % 26));
+        EXPECT(expanded[i].fg() == ((i >= 10 && i < 20) ? Color::Red : Color::White));
+        EXPECT(expanded[i].bg() == (i >= 30 ? Color::Blue : Color::Black));
+    }
+    delete [] expanded;
+    EXPECT_EQ(row.bytes(), 0);
+}
+
+TEST(compact_row, keepsIncompressibleRows) {
+    using Cell = Canvas::Cell;
+    Cell * cells = new Cell[4];
+    for (int i = 0; i < 4; ++i)
+        cells[i].setFg(Color{static_cast<unsigned char>(i), 0, 0});
+    CompactRow row{cells, 4};
+    EXPECT(! row.compacted());
+    EXPECT_EQ(row.bytes(), 4 * sizeof(Cell));
+    Cell * released = row.release();
+    EXPECT(released == cells);
+    delete [] released;
+}
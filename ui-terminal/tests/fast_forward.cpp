@@ -0,0 +1,147 @@
+#include <random>
+#include <string>
+
+#include "helpers/tests.h"
+
+#include "test_terminal.h"
+
+using namespace ui;
+
+namespace {
+
+    /** Generates random output that consists mostly of the simple lines the fast-forward applies to, interleaved with other sequences and invalid UTF-8.
+     */
+    class OutputGenerator {
+    public:
+        explicit OutputGenerator(unsigned seed):
+            rng_{seed} {
+        }
+
+        std::string output(size_t lines) {
+            std::string result;
+            for (size_t i = 0; i < lines; ++i) {
+                if (pick(20) == 0)
+                    result += special();
+                result += line();
+            }
+            return result;
+        }
+
+    private:
+
+        size_t pick(size_t n) {
+            return std::uniform_int_distribution<size_t>{0, n - 1}(rng_);
+        }
+
+        std::string line() {
+            std::string result;
+            // most lines fit the screen, so that they can be fast-forwarded
+            for (size_t i = 0, e = pick(pick(4) == 0 ? 8 : 4); i < e; ++i) {
+                switch (pick(12)) {
+                    case 0:
+                        result += SGR[pick(sizeof(SGR) / sizeof(char const *))];
+                        break;
+                    case 1:
+                        result += "\t";
+                        break;
+                    case 2:
+                        result += "\xe4\xb8\xad\xe6\x96\x87"; // wide characters
+                        break;
+                    case 3:
+                        result += "e\xcc\x81"; // e with combining acute accent
+                        break;
+                    case 4:
+                        result += "\xf0\x9f\x98\x80"; // emoji
+                        break;
+                    case 5:
+                        result += "\xe4\xb8"; // truncated sequence
+                        break;
+                    default:
+                        for (size_t j = 0, je = pick(6) + 1; j < je; ++j)
+                            result += static_cast<char>('a' + pick(26));
+                        result += ' ';
+                }
+            }
+            result += pick(10) == 0 ? "\n" : "\r\n";
+            return result;
+        }
+
+        std::string special() {
+            switch (pick(6)) {
+                case 0:
+                    return "\x1b[H";
+                case 1:
+                    return "\x1b[2J";
+                case 2:
+                    return STR("\x1b[" << (pick(6) + 1) << ";" << (pick(20) + 1) << "H");
+                case 3:
+                    return "\x1b[K";
+                case 4:
+                    return "\x1b[3A";
+                default:
+                    return "\x1b[?7l";
+            }
+        }
+
+        static constexpr char const * SGR[] = { "\x1b[0m", "\x1b[1m", "\x1b[3;4m", "\x1b[31m", "\x1b[42m", "\x1b[38;5;123m", "\x1b[48;2;10;20;30m", "\x1b[m" };
+
+        std::mt19937 rng_;
+    };
+
+} // anonymous namespace
+
+/** The fast-forward must leave the terminal in the same state as parsing the same output line by line, regardless of how the output is split into the chunks received.
+ */
+TEST(fast_forward, matchesNormalParsing) {
+    size_t fastForwarded = 0;
+    for (unsigned seed = 0; seed < 100; ++seed) {
+        OutputGenerator gen{seed};
+        std::mt19937 rng{seed};
+        Size size{20, 5};
+        int maxHistoryRows = seed % 2 ? 10 : 1000;
+        TestTerminal normal{size, maxHistoryRows, false};
+        TestTerminal fast{size, maxHistoryRows, true};
+        std::string output = gen.output(200);
+        for (size_t i = 0; i < output.size(); ) {
+            size_t chunk = std::min(output.size() - i, std::uniform_int_distribution<size_t>{1, 1024}(rng));
+            std::string x = output.substr(i, chunk);
+            normal.feed(x);
+            fast.feed(x);
+            i += chunk;
+        }
+        std::string expected = normal.dump();
+        std::string actual = fast.dump();
+        // report the first differing line only
+        if (expected != actual) {
+            size_t diff = 0;
+            while (expected[diff] == actual[diff])
+                ++diff;
+            size_t start = expected.rfind('\n', diff);
+            start = start == std::string::npos ? 0 : start + 1;
+            CHECK_EQ(STR("seed " << seed << " " << expected.substr(start, expected.find('\n', diff) - start)), STR("seed " << seed << " " << actual.substr(start, actual.find('\n', diff) - start)));
+        }
+        fastForwarded += fast.fastForwarded();
+    }
+    EXPECT(fastForwarded > 0);
+}
+
+/** The triggers must see every line, so the output is not fast-forwarded while any triggers are set. The matches are styled in the cells of the matched characters, even when preceded by wide characters.
+ */
+TEST(fast_forward, disabledByTriggers) {
+    AnsiTerminal::Trigger trigger;
+    trigger.pattern = "ab";
+    trigger.style.font.setUnderline();
+    TestTerminal t{Size{20, 5}, 1000, true};
+    t.setTriggers({trigger});
+    std::string output;
+    for (size_t i = 0; i < 50; ++i)
+        output += "x\xe4\xb8\xad" "ab\r\n";
+    t.feed(output);
+    EXPECT_EQ(t.fastForwarded(), 0);
+    for (size_t row = 0; row < 40; ++row) {
+        EXPECT(! t.historyCell(row, 0).font().underline());
+        EXPECT(! t.historyCell(row, 1).font().underline());
+        EXPECT(t.historyCell(row, 2).font().underline());
+        EXPECT(t.historyCell(row, 3).font().underline());
+    }
+}
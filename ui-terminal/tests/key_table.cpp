@@ -0,0 +1,48 @@
+#include "helpers/tests.h"
+
+#include "../key_table.h"
+
+using namespace ui;
+
+TEST(key_table, normal) {
+    KeyTable t;
+    EXPECT(t.get(Key::Up).empty());
+    t.set(Key::Up, "\033[A", 3);
+    t.set(Key::Up + Key::Ctrl, "\033[1;5A", 6);
+    EXPECT(t.get(Key::Up) == "\033[A");
+    EXPECT(t.get(Key::Up + Key::Ctrl) == "\033[1;5A");
+    EXPECT(t.get(Key::Up + Key::Shift).empty());
+    // win modifier never sends anything
+    EXPECT(t.get(Key::Up + Key::Win).empty());
+    // first definition wins
+    t.set(Key::Up, "\033OA", 3);
+    EXPECT(t.get(Key::Up) == "\033[A");
+    t.clear(Key::Up);
+    EXPECT(t.get(Key::Up).empty());
+}
+
+TEST(key_table, tooLong) {
+    KeyTable t;
+    EXPECT(! t.set(Key::Up, "\033[1;2;3;4A", 10));
+    EXPECT(t.get(Key::Up).empty());
+    EXPECT(t.set(Key::Up, "\033[24;8~", 7));
+    EXPECT(t.get(Key::Up) == "\033[24;8~");
+    t.setKeypadApplication(Key::Numpad1, "\033Oq", 3);
+    EXPECT(! t.setKeypadApplication(Key::Numpad1, "\033[1;2;3;4q", 11));
+    EXPECT(t.get(Key::Numpad1, false, true) == "\033Oq");
+}
+
+TEST(key_table, applicationModes) {
+    KeyTable t;
+    t.set(Key::Up, "\033[A", 3);
+    t.set(Key::Up + Key::Shift, "\033[1;2A", 6);
+    t.set(Key::Numpad1, "1", 1);
+    t.setCursorApplication(Key::Up, "\033OA", 3);
+    t.setKeypadApplication(Key::Numpad1, "\033Oq", 3);
+    EXPECT(t.get(Key::Up, /* applicationCursor */ true) == "\033OA");
+    EXPECT(t.get(Key::Up, /* applicationCursor */ false, /* applicationKeypad */ true) == "\033[A");
+    // modified keys are not affected by the modes
+    EXPECT(t.get(Key::Up + Key::Shift, true, true) == "\033[1;2A");
+    EXPECT(t.get(Key::Numpad1) == "1");
+    EXPECT(t.get(Key::Numpad1, false, true) == "\033Oq");
+}
@@ -0,0 +1,219 @@
+#include <string>
+
+#include "helpers/tests.h"
+
+#include "../terminal_history.h"
+
+using namespace ui;
+
+namespace {
+
+    using Cell = Canvas::Cell;
+
+    /** Returns a new row with given text, one character per cell.
+     */
+    Cell * Row(std::string const & text) {
+        Cell * cells = new Cell[text.size()];
+        for (size_t i = 0; i < text.size(); ++i)
+            cells[i].setCodepoint(static_cast<char32_t>(text[i]));
+        return cells;
+    }
+
+    void AddRow(TerminalHistory & history, std::string const & text, bool terminated) {
+        history.addRow(Row(text), static_cast<int>(text.size()), terminated);
+    }
+
+    /** Returns the text of given history row.
+     */
+    std::string Text(TerminalHistory & history, size_t row) {
+        std::pair<Cell const *, int> cells = history.row(row);
+        std::string result;
+        for (int i = 0; i < cells.second; ++i)
+            result += static_cast<char>(cells.first[i].codepoint());
+        return result;
+    }
+
+} // anonymous namespace
+
+TEST(terminal_history, wrapsLines) {
+    TerminalHistory h;
+    h.setWidth(4);
+    h.setMaxRows(100);
+    AddRow(h, "abcd", false);
+    AddRow(h, "ef", true);
+    AddRow(h, "g", true);
+    EXPECT_EQ(h.numLines(), 2);
+    EXPECT_EQ(h.rows(), 3);
+    EXPECT_EQ(Text(h, 0), "abcd");
+    EXPECT_EQ(Text(h, 1), "ef");
+    EXPECT_EQ(Text(h, 2), "g");
+}
+
+TEST(terminal_history, rewrapsOnWidthChange) {
+    TerminalHistory h;
+    h.setWidth(4);
+    h.setMaxRows(100);
+    AddRow(h, "abcd", false);
+    AddRow(h, "efgh", false);
+    AddRow(h, "ij", true);
+    AddRow(h, "k", true);
+    EXPECT_EQ(h.rows(), 4);
+    h.setWidth(3);
+    EXPECT_EQ(h.rows(), 5);
+    EXPECT_EQ(Text(h, 0), "abc");
+    EXPECT_EQ(Text(h, 1), "def");
+    EXPECT_EQ(Text(h, 2), "ghi");
+    EXPECT_EQ(Text(h, 3), "j");
+    EXPECT_EQ(Text(h, 4), "k");
+    h.setWidth(10);
+    EXPECT_EQ(h.rows(), 2);
+    EXPECT_EQ(Text(h, 0), "abcdefghij");
+    EXPECT_EQ(Text(h, 1), "k");
+}
+
+TEST(terminal_history, removesOldestRows) {
+    TerminalHistory h;
+    h.setWidth(2);
+    h.setMaxRows(3);
+    AddRow(h, "ab", false);
+    AddRow(h, "cd", true);
+    AddRow(h, "e", true);
+    EXPECT_EQ(h.rows(), 3);
+    // the oldest line is only partially removed
+    AddRow(h, "f", true);
+    EXPECT_EQ(h.rows(), 3);
+    EXPECT_EQ(Text(h, 0), "cd");
+    EXPECT_EQ(Text(h, 1), "e");
+    EXPECT_EQ(Text(h, 2), "f");
+    AddRow(h, "g", true);
+    EXPECT_EQ(h.numLines(), 3);
+    EXPECT_EQ(Text(h, 0), "e");
+    h.setMaxRows(1);
+    EXPECT_EQ(h.rows(), 1);
+    EXPECT_EQ(Text(h, 0), "g");
+    h.setMaxRows(0);
+    EXPECT_EQ(h.rows(), 0);
+}
+
+TEST(terminal_history, appendsToTrimmedOpenLine) {
+    TerminalHistory h;
+    h.setWidth(2);
+    h.setMaxRows(2);
+    AddRow(h, "ab", false);
+    AddRow(h, "cd", false);
+    AddRow(h, "ef", false);
+    AddRow(h, "gh", true);
+    EXPECT_EQ(h.numLines(), 1);
+    EXPECT_EQ(h.rows(), 2);
+    EXPECT_EQ(Text(h, 0), "ef");
+    EXPECT_EQ(Text(h, 1), "gh");
+}
+
+TEST(terminal_history, compactAndExpand) {
+    TerminalHistory h;
+    h.setWidth(4);
+    h.setMaxRows(100);
+    AddRow(h, "aaaa", true);
+    AddRow(h, "bbbb", false);
+    h.compact();
+    // the open line is kept expanded so that the next row can be appended to it
+    EXPECT_EQ(h.numLines(), 2);
+    AddRow(h, "cc", true);
+    EXPECT_EQ(h.rows(), 3);
+    h.setWidth(3);
+    EXPECT_EQ(h.rows(), 4);
+    EXPECT_EQ(Text(h, 0), "aaa");
+    EXPECT_EQ(Text(h, 1), "a");
+    EXPECT_EQ(Text(h, 2), "bbb");
+    EXPECT_EQ(Text(h, 3), "bcc");
+    EXPECT_EQ(h.compactedLines(), 0);
+}
+
+TEST(terminal_history, movesOldestLinesToDisk) {
+    if (! HistorySegments::Available())
+        return;
+    TerminalHistory h;
+    h.setWidth(4);
+    h.setMaxRows(2);
+    h.setMaxDiskBytes(1024 * 1024);
+    AddRow(h, "aaaa", false);
+    AddRow(h, "bb", true);
+    AddRow(h, "cc", true);
+    AddRow(h, "dd", true);
+    // only the rows in memory are limited
+    EXPECT_EQ(h.rows(), 4);
+    EXPECT(h.diskBytes() > 0);
+    EXPECT_EQ(Text(h, 0), "aaaa");
+    EXPECT_EQ(Text(h, 1), "bb");
+    EXPECT_EQ(Text(h, 3), "dd");
+    // the lines on disk are rewrapped as well
+    h.setWidth(3);
+    EXPECT_EQ(h.rows(), 4);
+    EXPECT_EQ(Text(h, 0), "aaa");
+    EXPECT_EQ(Text(h, 1), "abb");
+    EXPECT_EQ(Text(h, 2), "cc");
+    // disabling the disk removes the lines stored there
+    h.setMaxDiskBytes(0);
+    EXPECT_EQ(h.diskBytes(), 0);
+    EXPECT_EQ(h.rows(), 2);
+    EXPECT_EQ(Text(h, 0), "cc");
+}
+
+TEST(terminal_history, movesRowsOfOpenLineToDisk) {
+    if (! HistorySegments::Available())
+        return;
+    TerminalHistory h;
+    h.setWidth(2);
+    h.setMaxRows(2);
+    h.setMaxDiskBytes(1024 * 1024);
+    AddRow(h, "ab", false);
+    AddRow(h, "cd", false);
+    AddRow(h, "ef", false);
+    AddRow(h, "gh", false);
+    // each time the line grows over the limit, its oldest row is moved to disk as a separate line
+    EXPECT_EQ(h.rows(), 4);
+    EXPECT_EQ(h.numLines(), 3);
+    AddRow(h, "ij", true);
+    EXPECT_EQ(h.rows(), 5);
+    EXPECT_EQ(Text(h, 0), "ab");
+    EXPECT_EQ(Text(h, 1), "cd");
+    EXPECT_EQ(Text(h, 2), "ef");
+    EXPECT_EQ(Text(h, 4), "ij");
+}
+
+TEST(terminal_history, removesOldestLinesFromDisk) {
+    if (! HistorySegments::Available())
+        return;
+    TerminalHistory h;
+    h.setWidth(4);
+    h.setMaxRows(1);
+    h.setMaxDiskBytes(1024);
+    AddRow(h, "aaaa", true);
+    AddRow(h, "bbbb", true);
+    // room for two lines of the same size on disk
+    h.setMaxDiskBytes(h.diskBytes() * 2);
+    AddRow(h, "cccc", true);
+    AddRow(h, "dddd", true);
+    EXPECT_EQ(h.rows(), 3);
+    EXPECT_EQ(Text(h, 0), "bbbb");
+    EXPECT_EQ(Text(h, 1), "cccc");
+    EXPECT_EQ(Text(h, 2), "dddd");
+}
+
+/** Lines over the size of the write buffer are written in the background and read back from the buffers, or the segment files.
+ */
+TEST(terminal_history, readsLinesWrittenInBackground) {
+    if (! HistorySegments::Available())
+        return;
+    TerminalHistory h;
+    h.setWidth(1000);
+    h.setMaxRows(1);
+    h.setMaxDiskBytes(64 * 1024 * 1024);
+    for (size_t i = 0; i < 1000; ++i)
+        AddRow(h, std::string(1000, static_cast<char>('a' + i % 26)), true);
+    EXPECT(h.diskBytes() > 2 * HistorySegments::BUFFER_BYTES);
+    EXPECT_EQ(h.rows(), 1000);
+    for (size_t i = 0; i < 1000; i += 111)
+        EXPECT_EQ(Text(h, i), std::string(1000, static_cast<char>('a' + i % 26)));
+    EXPECT_EQ(Text(h, 999), std::string(1000, static_cast<char>('a' + 999 % 26)));
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "../ansi_terminal.h"
+
+namespace ui {
+
+    /** Pseudoterminal which only delivers what the test passes to the terminal directly and discards what the terminal sends.
+     */
+    class NullPTY : public tpp::PTYMaster {
+    public:
+        void send(char const * buffer, size_t numBytes) override {
+            MARK_AS_UNUSED(buffer);
+            MARK_AS_UNUSED(numBytes);
+        }
+
+        size_t receive(char * buffer, size_t bufferSize) override {
+            MARK_AS_UNUSED(buffer);
+            MARK_AS_UNUSED(bufferSize);
+            std::unique_lock<std::mutex> g{m_};
+            cv_.wait(g, [this](){ return terminated_.load(); });
+            return 0;
+        }
+
+        void terminate() override {
+            std::lock_guard<std::mutex> g{m_};
+            terminated_ = true;
+            cv_.notify_all();
+        }
+
+        void resize(int cols, int rows) override {
+            MARK_AS_UNUSED(cols);
+            MARK_AS_UNUSED(rows);
+        }
+
+    private:
+        std::mutex m_;
+        std::condition_variable cv_;
+    };
+
+    /** Terminal fed directly by the test, in the same way the PTY reader does.
+     */
+    class TestTerminal : public AnsiTerminal {
+    public:
+        TestTerminal(Size size, int maxHistoryRows, bool fastForward):
+            AnsiTerminal{new NullPTY{}, Palette::XTerm256()} {
+            setMaxHistoryRows(maxHistoryRows);
+            setFastForward(fastForward);
+            resize(size);
+        }
+
+        /** Feeds the chunk to the terminal, keeping the input it did not process for the next chunk.
+         */
+        void feed(std::string const & chunk) {
+            pending_ += chunk;
+            char * x = pending_.data();
+            char * end = x + pending_.size();
+            while (x != end) {
+                size_t processed = received(x, end);
+                // the end of the lines is only added when the lines are fast-forwarded
+                if (fastForwardLines_.size() > static_cast<size_t>(height())) {
+                    ++fastForwarded_;
+                    fastForwardLines_.clear();
+                }
+                if (processed == 0)
+                    break;
+                x += processed;
+            }
+            pending_.erase(0, x - pending_.data());
+        }
+
+        /** Returns the buffer, cursor and history as text, one cell at a time, so that two terminals can be compared and the first difference found.
+
+            Hyperlink detection is disabled in the test terminals as the fast-forward only detects hyperlinks in the lines that remain on the screen.
+         */
+        std::string dump() {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            std::stringstream result;
+            result << "cursor " << cursorPosition().x() << "," << cursorPosition().y() << "\n";
+            for (size_t i = 0, e = history_.rows(); i < e; ++i) {
+                std::pair<Cell const *, int> row = history_.row(i);
+                result << "history " << i << ":";
+                DumpCells(result, row.first, row.second);
+                result << "\n";
+            }
+            Buffer const & buffer = state_->buffer;
+            for (int i = 0; i < buffer.height(); ++i) {
+                result << "row " << i << ":";
+                for (int col = 0; col < buffer.width(); ++col)
+                    DumpCells(result, & buffer.at(Point{col, i}), 1);
+                result << "\n";
+            }
+            return result.str();
+        }
+
+        /** Adds the chunk to the input not yet processed and discards it the same way the PTY reader does when the user interrupts the program, then feeds the rest. 
+         */
+        void feedDiscarding(std::string const & chunk) {
+            pending_ += chunk;
+            char * x = pending_.data();
+            char * discardEnd = DiscardBoundary(x, x + pending_.size(), insideStringSequence());
+            if (discardEnd != x) {
+                pending_.erase(0, discardEnd - x);
+                pendingInputDiscarded();
+            }
+            feed("");
+        }
+
+        size_t fastForwarded() const {
+            return fastForwarded_;
+        }
+
+        Cell historyCell(size_t row, int col) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            return history_.row(row).first[col];
+        }
+
+        /** Returns the cell of the terminal buffer as stored, i.e. with palette colors as their indices.
+         */
+        Cell bufferCell(Point p) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            return const_cast<Buffer const &>(state_->buffer).at(p);
+        }
+
+        /** Returns the cell with its palette colors resolved as when painted.
+         */
+        Cell resolved(Cell const & cell) {
+            std::lock_guard<PriorityLock> g{bufferLock_};
+            Cell result{cell};
+            resolveColors(result);
+            return result;
+        }
+
+        using AnsiTerminal::Buffer;
+        using AnsiTerminal::DiscardBoundary;
+        using AnsiTerminal::PaletteColor;
+        using AnsiTerminal::DefaultCell;
+        using AnsiTerminal::FG_INDEXED;
+        using AnsiTerminal::BG_INDEXED;
+        using AnsiTerminal::DECOR_INDEXED;
+        using AnsiTerminal::DEFAULT_FOREGROUND;
+        using AnsiTerminal::DEFAULT_BACKGROUND;
+
+    private:
+
+        static void DumpCells(std::stringstream & s, Cell const * cells, int cols) {
+            for (int i = 0; i < cols; ++i) {
+                Cell const & c = cells[i];
+                s << " " << std::hex << static_cast<unsigned>(c.codepoint()) << "/" << c.fg().toRGB() << "/" << c.bg().toRGB() << "/" << c.font().bold() << c.font().italic() << c.font().underline() << c.font().doubleWidth() << (Buffer::IsLineEnd(c) ? "$" : "") << std::dec;
+            }
+        }
+
+        std::string pending_;
+        size_t fastForwarded_ = 0;
+    };
+
+} // namespace ui
@@ -0,0 +1,74 @@
+#include <string>
+#include <vector>
+
+#include "helpers/tests.h"
+
+#include "../trigger_matcher.h"
+
+using namespace ui;
+
+namespace {
+
+    /** Matches the text and returns the end offset and index of each match as strings "end:index".
+     */
+    std::vector<std::string> Matches(TriggerMatcher & m, std::u32string const & text) {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < text.size(); ++i)
+            if (m.next(text[i]))
+                m.forEachMatch([&](size_t index) {
+                    result.push_back(std::to_string(i + 1) + ":" + std::to_string(index));
+                });
+        return result;
+    }
+
+} // anonymous namespace
+
+TEST(trigger_matcher, literals) {
+    TriggerMatcher m;
+    m.add(U"error");
+    m.add(U"password:");
+    m.compile();
+    EXPECT(Matches(m, U"no problems here") == std::vector<std::string>{});
+    EXPECT(Matches(m, U"an error, another error") == (std::vector<std::string>{"8:0", "23:0"}));
+    EXPECT(Matches(m, U"Enter password: ") == (std::vector<std::string>{"15:1"}));
+}
+
+TEST(trigger_matcher, overlapping) {
+    TriggerMatcher m;
+    m.add(U"he");
+    m.add(U"she");
+    m.add(U"his");
+    m.add(U"hers");
+    m.compile();
+    EXPECT(Matches(m, U"ushers") == (std::vector<std::string>{"4:1", "4:0", "6:3"}));
+    EXPECT(Matches(m, U"hishe") == (std::vector<std::string>{"3:2", "5:1", "5:0"}));
+}
+
+TEST(trigger_matcher, duplicatesAndSuffixes) {
+    TriggerMatcher m;
+    m.add(U"panic");
+    m.add(U"panic");
+    m.add(U"c");
+    m.compile();
+    EXPECT(Matches(m, U"kernel panic") == (std::vector<std::string>{"12:1", "12:0", "12:2"}));
+}
+
+TEST(trigger_matcher, streamingAndReset) {
+    TriggerMatcher m;
+    m.add(U"FAILED");
+    m.compile();
+    EXPECT(Matches(m, U"build FAI") == std::vector<std::string>{});
+    EXPECT(Matches(m, U"LED") == (std::vector<std::string>{"3:0"}));
+    Matches(m, U"FAI");
+    m.reset();
+    EXPECT(Matches(m, U"LED") == std::vector<std::string>{});
+}
+
+TEST(trigger_matcher, unicode) {
+    TriggerMatcher m;
+    m.add(U"chyba¡");
+    m.add(U"⚠");
+    m.compile();
+    EXPECT(Matches(m, U"x chyba¡ ⚠") == (std::vector<std::string>{"8:0", "10:1"}));
+    EXPECT_EQ(m.patternLength(0), 6);
+}
@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include "helpers/tests.h"
 
 #include "../url_matcher.h"
@@ -60,3 +63,70 @@ TEST(url_matcher, IP) {
     EXPECT(UrlMatcher::IsValid("http://10.20.30.40?foo=bar"));
     EXPECT(UrlMatcher::IsValid("http://10.20.30.40/foo?foo=bar&q=7"));
 }
+
+namespace {
+
+    /** Returns the sizes of urls matched in given text, feeding the matcher one character at a time, or skipping the characters the matcher allows to skip.
+     */
+    std::vector<size_t> Matches(std::string const & text, bool useSkip) {
+        std::u32string cps{text.begin(), text.end()};
+        UrlMatcher m;
+        std::vector<size_t> result;
+        for (size_t i = 0; i < cps.size(); ) {
+            size_t match = cps.size() - i;
+            if (useSkip)
+                i += m.skip(cps.data() + i, cps.data() + cps.size(), match);
+            for (size_t e = i + match; i < e; ++i) {
+                size_t x = m.next(cps[i]);
+                if (x != 0)
+                    result.push_back(x);
+            }
+        }
+        size_t x = m.reset();
+        if (x != 0)
+            result.push_back(x);
+        return result;
+    }
+
+} // anonymous namespace
+
+TEST(url_matcher, skipPlainText) {
+    UrlMatcher m;
+    std::u32string text{U"hello world, nothing to see here"};
+    size_t match;
+    size_t skipped = m.skip(text.data(), text.data() + text.size(), match);
+    EXPECT_EQ(skipped, 32);
+    EXPECT_EQ(match, 0);
+    // letters of the scheme at the end must be matched as the colon may follow in the next run
+    text = U"some text ending with http";
+    skipped = m.skip(text.data(), text.data() + text.size(), match);
+    EXPECT_EQ(skipped, 22);
+    EXPECT_EQ(match, 4);
+}
+
+TEST(url_matcher, skipStopsBeforeScheme) {
+    UrlMatcher m;
+    std::u32string text{U"see https://terminalpp.com"};
+    size_t match;
+    size_t skipped = m.skip(text.data(), text.data() + text.size(), match);
+    EXPECT_EQ(skipped, 4);
+    EXPECT_EQ(match, 6);
+    // the matcher is in the middle of the url now and cannot skip
+    for (size_t i = 0; i < match; ++i)
+        m.next(text[skipped + i]);
+    skipped = m.skip(text.data() + 10, text.data() + text.size(), match);
+    EXPECT_EQ(skipped, 0);
+    EXPECT_EQ(match, 1);
+}
+
+TEST(url_matcher, skipMatchesSameUrls) {
+    std::vector<std::string> texts{
+        "see https://terminalpp.com for more",
+        "xhttp://terminalpp.com and (http://foo.bar/baz?x=1:80) ok",
+        "a:b:c: http:/ http:// https://x.y/ shttp://z",
+        "http://a.b",
+        "no urls at all",
+    };
+    for (std::string const & text : texts)
+        EXPECT(Matches(text, true) == Matches(text, false));
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers/helpers.h"
+
+namespace ui {
+
+    /** Matches a set of literal patterns in a stream of codepoints.
+
+        The patterns are compiled into an Aho-Corasick automaton whose failure links are resolved in advance, so that matching a codepoint is a single table lookup regardless of the number of patterns, or the partial matches in progress, and the whole stream is matched in linear time. To keep the table small the codepoints are first mapped to classes, where each codepoint used in any of the patterns has its own class and all other codepoints share the class which always leads back to the initial state. ASCII codepoints are mapped by an array, others by a hash map which is only consulted if the patterns contain any non-ASCII codepoints.
+
+        The matcher is streaming, i.e. the state is kept between the codepoints and patterns spanning several runs of the input are matched as well.
+     */
+    class TriggerMatcher {
+    public:
+
+        /** Denotes no pattern. */
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        bool empty() const {
+            return patterns_.empty();
+        }
+
+        size_t numPatterns() const {
+            return patterns_.size();
+        }
+
+        /** Returns the number of codepoints of given pattern.
+         */
+        size_t patternLength(size_t index) const {
+            return patterns_[index].size();
+        }
+
+        /** Adds the pattern and returns its index.
+
+            The matcher must be compiled before the pattern is matched.
+         */
+        size_t add(std::u32string const & pattern) {
+            ASSERT(! pattern.empty()) << "Empty patterns are not allowed";
+            patterns_.push_back(pattern);
+            compiled_ = false;
+            return patterns_.size() - 1;
+        }
+
+        void clear() {
+            patterns_.clear();
+            compile();
+        }
+
+        /** Builds the automaton for the patterns added so far and resets the matcher.
+         */
+        void compile() {
+            compileClasses();
+            compileTrie();
+            compileTransitions();
+            compiled_ = true;
+            state_ = 0;
+        }
+
+        /** Forgets any partial matches in progress.
+         */
+        void reset() {
+            state_ = 0;
+        }
+
+        /** Matches next codepoint and returns true if any of the patterns ends with it.
+
+            The patterns matched can be enumerated with forEachMatch().
+         */
+        bool next(char32_t c) {
+            ASSERT(compiled_);
+            state_ = transitions_[state_ * numClasses_ + classOf(c)];
+            return matches_[state_] != NONE;
+        }
+
+        /** Calls the function with the index of every pattern ending with the last matched codepoint.
+         */
+        template<typename FUNCTION>
+        void forEachMatch(FUNCTION fn) const {
+            for (uint32_t i = matches_[state_]; i != NONE; i = nextMatch_[i])
+                fn(i);
+        }
+
+    private:
+
+        uint32_t classOf(char32_t c) const {
+            if (c < 128)
+                return asciiClasses_[c];
+            if (otherClasses_.empty())
+                return 0;
+            auto i = otherClasses_.find(c);
+            return i == otherClasses_.end() ? 0 : i->second;
+        }
+
+        void compileClasses() {
+            for (uint32_t & c : asciiClasses_)
+                c = 0;
+            otherClasses_.clear();
+            numClasses_ = 1;
+            for (std::u32string const & pattern : patterns_) {
+                for (char32_t c : pattern) {
+                    if (classOf(c) != 0)
+                        continue;
+                    if (c < 128)
+                        asciiClasses_[c] = numClasses_++;
+                    else
+                        otherClasses_.insert(std::make_pair(c, numClasses_++));
+                }
+            }
+        }
+
+        /** Builds the trie of the patterns in the transition table, where 0 denotes a missing edge, since no edge leads back to the root. Patterns ending in the same state are chained.
+         */
+        void compileTrie() {
+            transitions_.assign(numClasses_, 0);
+            matches_.assign(1, NONE);
+            nextMatch_.assign(patterns_.size(), NONE);
+            for (size_t i = 0, e = patterns_.size(); i < e; ++i) {
+                uint32_t state = 0;
+                for (char32_t c : patterns_[i]) {
+                    uint32_t & next = transitions_[state * numClasses_ + classOf(c)];
+                    if (next == 0) {
+                        next = static_cast<uint32_t>(matches_.size());
+                        matches_.push_back(NONE);
+                        transitions_.resize(transitions_.size() + numClasses_, 0);
+                    }
+                    // the reference may have been invalidated by the resize
+                    state = transitions_[state * numClasses_ + classOf(c)];
+                }
+                nextMatch_[i] = matches_[state];
+                matches_[state] = static_cast<uint32_t>(i);
+            }
+        }
+
+        /** Resolves the failure links breadth first, replacing the missing edges with the transitions of the failure state and appending the matches of the failure state to the matches of each state.
+         */
+        void compileTransitions() {
+            std::vector<uint32_t> failure(matches_.size(), 0);
+            std::deque<uint32_t> queue;
+            for (uint32_t c = 0; c < numClasses_; ++c)
+                if (transitions_[c] != 0)
+                    queue.push_back(transitions_[c]);
+            while (! queue.empty()) {
+                uint32_t state = queue.front();
+                queue.pop_front();
+                uint32_t fail = failure[state];
+                // the failure state is closer to the root and so its matches are final already
+                if (matches_[state] == NONE) {
+                    matches_[state] = matches_[fail];
+                } else {
+                    uint32_t last = matches_[state];
+                    while (nextMatch_[last] != NONE)
+                        last = nextMatch_[last];
+                    nextMatch_[last] = matches_[fail];
+                }
+                for (uint32_t c = 0; c < numClasses_; ++c) {
+                    uint32_t & next = transitions_[state * numClasses_ + c];
+                    if (next != 0) {
+                        failure[next] = transitions_[fail * numClasses_ + c];
+                        queue.push_back(next);
+                    } else {
+                        next = transitions_[fail * numClasses_ + c];
+                    }
+                }
+            }
+        }
+
+        std::vector<std::u32string> patterns_;
+
+        /** Class of each ASCII codepoint. */
+        uint32_t asciiClasses_[128] = {};
+
+        /** Classes of the non-ASCII codepoints used in the patterns. */
+        std::unordered_map<char32_t, uint32_t> otherClasses_;
+
+        uint32_t numClasses_ = 1;
+
+        /** Next state for each state and codepoint class. */
+        std::vector<uint32_t> transitions_ = std::vector<uint32_t>(1, 0);
+
+        /** First pattern matched in each state. */
+        std::vector<uint32_t> matches_ = std::vector<uint32_t>(1, NONE);
+
+        /** Next pattern matched in the same state for each pattern. */
+        std::vector<uint32_t> nextMatch_;
+
+        uint32_t state_ = 0;
+        bool compiled_ = true;
+
+    }; // ui::TriggerMatcher
+
+} // namespace ui
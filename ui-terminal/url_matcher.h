@@ -1,6 +1,12 @@
 #pragma once
 
+#if (defined __SSE2__ || defined _M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "helpers/helpers.h"
+#include "helpers/bits.h"
+#include "helpers/char.h"
 
 namespace ui {
 
@@ -39,6 +45,29 @@ namespace ui {
             return result;
         }
 
+        /** Skips the codepoints at the beginning of given run that cannot be part of an url. 
+
+            Returns the number of skipped codepoints, for which the state is updated as if they were matched, and sets the number of codepoints after them that must be matched by next() before skip() can be called again. 
+
+            When no url is being matched, an url can only start with the `http:` scheme. Until the next colon, the state after any character other than `h`, `t`, `p` and `s` depends only on whether the character is a separator, so the run is skipped up to the last such character before the colon. Zero width characters are not matched at all and so they are not used to determine the state either. The colon is found 4 codepoints at a time where SSE2 is available. 
+         */
+        size_t skip(char32_t const * begin, char32_t const * end, size_t & match) {
+            if (state_ != State::ready && state_ != State::invalid) {
+                match = 1;
+                return 0;
+            }
+            char32_t const * colon = FindColon(begin, end);
+            char32_t const * x = colon;
+            while (x != begin && (IsSchemeLetter(x[-1]) || Char::ColumnWidth(x[-1]) == 0))
+                --x;
+            match = (colon == end) ? (end - x) : (colon + 1 - x);
+            if (x != begin) {
+                state_ = isSeparator(x[-1]) ? State::ready : State::invalid;
+                matchSize_ = 0;
+            }
+            return x - begin;
+        }
+
         /** Returns true if given string is a valid url. 
          */
         static bool IsValid(std::string const & text) {
@@ -94,6 +123,29 @@ namespace ui {
             return state_ >= State::valid;
         }
 
+        /** Returns the first colon in the range, or its end. 
+         */
+        static char32_t const * FindColon(char32_t const * x, char32_t const * end) {
+#if (defined __SSE2__ || defined _M_X64)
+            __m128i colon = _mm_set1_epi32(':');
+            while (end - x >= 4) {
+                int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128(pointer_cast<__m128i const *>(x)), colon));
+                if (mask != 0)
+                    return x + CountTrailingZeros(static_cast<uint32_t>(mask)) / 4;
+                x += 4;
+            }
+#endif
+            while (x != end && *x != ':')
+                ++x;
+            return x;
+        }
+
+        /** Returns true for the letters of the `http` and `https` schemes. 
+         */
+        static bool IsSchemeLetter(char32_t c) {
+            return c == 'h' || c == 't' || c == 'p' || c == 's';
+        }
+
         /** \name Character Groups
          
             The character group functios return the char itself so that they can be used in the TRANSITION macro and compared agains the char itself. They return the character if the character belongs to the group and a value different from the character otherwise. 
@@ -24,33 +24,52 @@ namespace ui {
     }
 
     Canvas::TextLine Canvas::GetTextLine(Char::iterator_utf8 & begin, Char::iterator_utf8 const & end, int wordWrapAt) {
+        // the text is decoded the same way textOut() does, so that the metrics match the drawn text even if it is not valid UTF-8
+        char const * i = begin.charPtr();
+        char const * e = end.charPtr();
         TextLine l{0,0, begin, begin};
+        // the line up to its last word separator and the start of the next line after the separator
+        TextLine wrapped{0,0, begin, begin};
+        char const * wrappedNext = nullptr;
+        char32_t cp;
         while (wordWrapAt == NoWordWrap || l.width < wordWrapAt) {
-            if (begin == end) {
-                l.end = begin;
+            if (i == e) {
+                l.end = Char::iterator_utf8{i};
+                begin = l.end;
                 return l;
-            } else if (Char::IsLineEnd(*begin)) {
-                l.end = begin;
-                ++begin;
+            }
+            char const * next = i;
+            Char::DecodeUTF8(next, e, & cp, 1);
+            if (Char::IsLineEnd(cp)) {
+                l.end = Char::iterator_utf8{i};
+                begin = Char::iterator_utf8{next};
                 return l;
             }
-            l.width += Char::ColumnWidth(*begin);
+            if (Char::IsWordSeparator(cp)) {
+                wrapped = l;
+                wrapped.end = Char::iterator_utf8{i};
+                wrappedNext = next;
+            }
+            l.width += Char::ColumnWidth(cp);
             ++l.chars;
-            ++begin;
+            i = next;
         }
-        // word wrap is enabled and the line is longer, i.e. backtrack to first word separator
-        l.end = begin;
-        while (l.end != l.begin) {
-            --l.chars;
-            l.width -= Char::ColumnWidth(*l.end);
-            if (Char::IsWordSeparator(*l.end)) {
-                begin = l.end;
-                ++begin; // move *after* the word separator on the next line
+        // word wrap is enabled and the line is longer, i.e. break at the word separator right after the line, or the last word separator in it
+        l.end = Char::iterator_utf8{i};
+        if (i != e) {
+            char const * next = i;
+            Char::DecodeUTF8(next, e, & cp, 1);
+            if (Char::IsWordSeparator(cp)) {
+                begin = Char::iterator_utf8{next};
                 return l;
             }
-            --l.end;
+        }
+        if (wrappedNext != nullptr) {
+            begin = Char::iterator_utf8{wrappedNext};
+            return wrapped;
         }
         // there are no words in the line, just break at the word wrap limit mid-word
+        begin = l.end;
         return l;
     }
 
@@ -108,29 +127,34 @@ namespace ui {
 
     Canvas & Canvas::fill(Rect const & rect, Cell const & fill) {
         Rect r = (rect & visibleArea_.rect()) + visibleArea_.offset();
-        for (int y = r.top(), ye = r.bottom(); y < ye; ++y) {
-            for (int x = r.left(), xe = r.right(); x < xe; ++x) {
-                buffer_->at(x,y) = fill;
-            }
-        }
+        buffer_->fillRect(r, fill);
         return *this;
-
     }
 
     Canvas & Canvas::textOut(Point x, Char::iterator_utf8 begin, Char::iterator_utf8 end) {
         Rect vr = visibleArea_.rect() + visibleArea_.offset();
         x = x + visibleArea_.offset();
-        for (; begin != end; ++begin) {
-            if (vr.contains(x)) {
-                Cell & c = buffer_->at(x);
-                c.detachSpecialObject();
-                c.setFg(fg_);
-                c.setDecor(decor_);
-                c.setBg(bg_.blendOver(c.bg()));
-                c.setFont(font_);
-                c.setCodepoint(begin->codepoint());
+        char const * i = begin.charPtr();
+        char const * e = end.charPtr();
+        char32_t codepoints[64];
+        while (i < e) {
+            size_t n = Char::DecodeUTF8(i, e, codepoints, 64);
+            for (size_t j = 0; j < n; ++j) {
+                int columnWidth = Char::ColumnWidth(codepoints[j]);
+                // zero width characters would overwrite the previous character
+                if (columnWidth == 0)
+                    continue;
+                if (vr.contains(x)) {
+                    Cell & c = buffer_->at(x);
+                    c.detachSpecialObject();
+                    c.setFg(fg_);
+                    c.setDecor(decor_);
+                    c.setBg(bg_.blendOver(c.bg()));
+                    c.setFont(font_);
+                    c.setCodepoint(codepoints[j]);
+                }
+                x.setX(x.x() + columnWidth * font_.width());
             }
-            x.setX(x.x() + Char::ColumnWidth(*begin) * font_.width());
         }
         return *this;
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "font.h"
 #include "color.h"
 #include "border.h"
@@ -592,23 +594,21 @@ namespace ui {
         Cell & attachSpecialObject(SpecialObject * so) {
             ASSERT(so != nullptr);
             std::lock_guard<std::mutex> g{SpecialObject::MObjects_};
-            if (hasSpecialObject()) {
-                auto i = SpecialObject::Objects_.find(this);
-                ASSERT(i != SpecialObject::Objects_.end());
-                if (i->second != so) {
-                    if (--(i->second->refCount_) == 0)
-                        delete i->second;
-                    i->second = so;
-                    ++(i->second->refCount_);
-                }
-            } else {
-                SpecialObject::Objects_.insert(std::pair<Cell *, SpecialObject*>{this, so});
-                codepoint_ |= SPECIAL_OBJECT;
-                ++so->refCount_;
-            }
+            attachSpecialObjectLocked(so);
             return *this;
         }
 
+        /** Attaches given special object to all cells in the range. 
+         
+            Like attachSpecialObject(), but the special objects mutex is locked only once for the whole range. 
+         */
+        static void AttachSpecialObject(Cell * begin, Cell * end, SpecialObject * so) {
+            ASSERT(so != nullptr);
+            std::lock_guard<std::mutex> g{SpecialObject::MObjects_};
+            for (; begin != end; ++begin)
+                begin->attachSpecialObjectLocked(so);
+        }
+
         /** Returns true if the cell has a special object attached to it. 
          */
         bool hasSpecialObject() const {
@@ -699,6 +699,14 @@ namespace ui {
         }
         //@}
 
+        /** Returns true if the other cell has the same colors and font. 
+         
+            The colors and font are stored next to each other in the cell so that they can be compared at once, which is what the renderers use to detect glyph run boundaries. 
+         */
+        bool sameStyle(Cell const & other) const {
+            return memcmp(& fg_, & other.fg_, sizeof(Color) * 3 + sizeof(Font)) == 0;
+        }
+
         /** \name Border. 
          */
         //@{
@@ -719,6 +727,25 @@ namespace ui {
 
     private:
 
+        /** Attaches the special object to the cell, the special objects mutex must be locked. 
+         */
+        void attachSpecialObjectLocked(SpecialObject * so) {
+            if (hasSpecialObject()) {
+                auto i = SpecialObject::Objects_.find(this);
+                ASSERT(i != SpecialObject::Objects_.end());
+                if (i->second != so) {
+                    if (--(i->second->refCount_) == 0)
+                        delete i->second;
+                    i->second = so;
+                    ++(i->second->refCount_);
+                }
+            } else {
+                SpecialObject::Objects_.insert(std::pair<Cell *, SpecialObject*>{this, so});
+                codepoint_ |= SPECIAL_OBJECT;
+                ++so->refCount_;
+            }
+        }
+
         /** Marker indicating that special object is attached to the cell. 
          */
         static const char32_t SPECIAL_OBJECT = 0x80000000;
@@ -745,17 +772,21 @@ namespace ui {
 
         Buffer(Buffer && from) noexcept:
             size_{from.size_},
-            rows_{from.rows_} {
+            rows_{from.rows_},
+            offset_{from.offset_} {
             from.size_ = Size{0,0};
             from.rows_ = nullptr;
+            from.offset_ = 0;
         }
 
         Buffer & operator = (Buffer && from) noexcept {
             clear();
             size_ = from.size_;
             rows_ = from.rows_;
+            offset_ = from.offset_;
             from.size_ = Size{0,0};
             from.rows_ = nullptr;
+            from.offset_ = 0;
             return *this;
         }          
 
@@ -835,23 +866,98 @@ namespace ui {
 
         /** Fills portion of given row with the specified cell. 
          
-            Exponentially increases the size of copied cells for performance.
+            Unless special objects are involved, the cells are copied as plain memory, exponentially increasing the size of copied cells for performance.
          */
         void fillRow(int row, Cell const & fill, int from, int cols) {
-            Cell * r = rows_[row];
-            for (int e = from + cols; from < e; ++from)
-                r[from] = fill;
-            /*
-            r[from] = fill;
-            int i = 1;
-            int next = 2;
-            while (next < cols) {
-                memcpy(r + from + i, r + from, sizeof(Cell) * i);
-                i = next;
-                next *= 2;
+            if (cols <= 0)
+                return;
+            Cell * r = rowCells(row) + from;
+            if (fill.hasSpecialObject() || ! PlainCells(r, cols)) {
+                for (int i = 0; i < cols; ++i)
+                    r[i] = fill;
+                return;
+            }
+            // casting to void * so that compiler won't give warnings that non POD object is copied, there are no special objects
+            memcpy(static_cast<void *>(r), static_cast<void const *>(& fill), sizeof(Cell));
+            for (int i = 1; i < cols; ) {
+                int n = std::min(i, cols - i);
+                memcpy(static_cast<void *>(r + i), static_cast<void const *>(r), sizeof(Cell) * n);
+                i += n;
+            }
+        }
+
+        /** Fills the given rectangle, clipped to the buffer, with the specified cell. 
+         */
+        void fillRect(Rect const & rect, Cell const & fill) {
+            Rect r = rect & Rect{size_};
+            for (int row = r.top(), e = r.bottom(); row < e; ++row)
+                fillRow(row, fill, r.left(), r.width());
+        }
+
+        /** Deletes given number of cells from the row starting at the given column, shifting the rest of the row left and filling the vacated cells at its end with the specified cell. 
+         */
+        void deleteCells(int row, int col, int count, Cell const & fill) {
+            count = std::min(count, width() - col);
+            if (count <= 0)
+                return;
+            Cell * r = rowCells(row);
+            int moved = width() - col - count;
+            if (PlainCells(r + col, width() - col)) {
+                memmove(static_cast<void *>(r + col), static_cast<void const *>(r + col + count), sizeof(Cell) * moved);
+            } else {
+                for (int i = col, e = col + moved; i < e; ++i)
+                    r[i] = r[i + count];
+            }
+            fillRow(row, fill, width() - count, count);
+        }
+
+        /** Inserts given number of cells filled with the specified cell into the row at the given column, shifting the rest of the row right and discarding the cells shifted past its end. 
+         */
+        void insertCells(int row, int col, int count, Cell const & fill) {
+            count = std::min(count, width() - col);
+            if (count <= 0)
+                return;
+            Cell * r = rowCells(row);
+            int moved = width() - col - count;
+            if (PlainCells(r + col, width() - col)) {
+                memmove(static_cast<void *>(r + col + count), static_cast<void const *>(r + col), sizeof(Cell) * moved);
+            } else {
+                for (int i = width() - 1, e = col + count; i >= e; --i)
+                    r[i] = r[i - count];
+            }
+            fillRow(row, fill, col, count);
+        }
+
+        /** Inserts given number of rows filled with the specified cell at the top of the region between top (inclusive) and bottom (exclusive) rows, discarding the same number of rows at the bottom of the region. 
+         */
+        void insertRows(int top, int bottom, int count, Cell const & fill) {
+            count = std::min(count, bottom - top);
+            if (count <= 0)
+                return;
+            if (top == 0 && bottom == height()) {
+                offset_ = (offset_ + height() - count) % height();
+            } else {
+                normalizeRows();
+                std::rotate(rows_ + top, rows_ + bottom - count, rows_ + bottom);
             }
-            memcpy(r + from + i, r + from, sizeof(Cell) * (cols - i));
-            */
+            for (int row = top, e = top + count; row < e; ++row)
+                fillRow(row, fill, 0, width());
+        }
+
+        /** Deletes given number of rows from the top of the region between top (inclusive) and bottom (exclusive) rows, adding the same number of rows filled with the specified cell at the bottom of the region. 
+         */
+        void deleteRows(int top, int bottom, int count, Cell const & fill) {
+            count = std::min(count, bottom - top);
+            if (count <= 0)
+                return;
+            if (top == 0 && bottom == height()) {
+                offset_ = (offset_ + count) % height();
+            } else {
+                normalizeRows();
+                std::rotate(rows_ + top, rows_ + top + count, rows_ + bottom);
+            }
+            for (int row = bottom - count; row < bottom; ++row)
+                fillRow(row, fill, 0, width());
         }
 
     protected:
@@ -864,12 +970,44 @@ namespace ui {
 
         Cell const & cellAt(Point const & p) const {
             ASSERT(Rect{size_}.contains(p));
-            return rows_[p.y()][p.x()];
+            return rowCells(p.y())[p.x()];
         }
 
         Cell & cellAt(Point const & p) {
             ASSERT(Rect{size_}.contains(p));
-            return rows_[p.y()][p.x()];
+            return rowCells(p.y())[p.x()];
+        }
+
+        /** Returns the cells of given row. 
+         */
+        Cell * rowCells(int row) const {
+            ASSERT(row >= 0 && row < height());
+            int i = row + offset_;
+            if (i >= height())
+                i -= height();
+            return rows_[i];
+        }
+
+        /** Returns true if none of the cells has a special object attached. 
+         
+            Special objects are bound to the addresses of their cells, so only such cells can be moved, or overwritten as plain memory. 
+         */
+        static bool PlainCells(Cell const * cells, int count) {
+            for (int i = 0; i < count; ++i)
+                if (cells[i].hasSpecialObject())
+                    return false;
+            return true;
+        }
+
+        /** Rotates the rows so that the first row is stored first, i.e. the rows are indexed directly. 
+         
+            Scrolling regions that do not span the whole buffer are moved in the rows array and the region must therefore not wrap around its end. 
+         */
+        void normalizeRows() {
+            if (offset_ != 0) {
+                std::rotate(rows_, rows_ + offset_, rows_ + height());
+                offset_ = 0;
+            }
         }
 
         /** Returns the value of the unused bits in the given cell's codepoint so that the buffer can store extra information for each cell. 
@@ -895,6 +1033,7 @@ namespace ui {
             for (int i = 0; i < size.height(); ++i)
                 rows_[i] = new Cell[size.width()];
             size_ = size;
+            offset_ = 0;
         }
 
         void clear() {
@@ -908,7 +1047,9 @@ namespace ui {
         }
 
         Size size_;
+        /** The rows, stored as a circular array starting at the offset so that scrolling the entire buffer only changes the offset. */
         Cell ** rows_;
+        int offset_ = 0;
 
         Cursor cursor_;
         Point cursorPosition_;
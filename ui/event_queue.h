@@ -1,94 +1,296 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "task.h"
 #include "widget.h"
 
 namespace ui {
 
     /** \section Event Scheduling
-     
-        Inside the UI, event scheduling is a shared responsibility of both the ui::Widget and the ui::Renderer classes. Each event *must* be attached to a widget, and each widget remembers how many pending events it has currently scheduled so that if the widget is detached or deleted, its events can be cancelled (otherwise the events may hold pointers and references to the already dead structures). 
 
-        A widget can schedule its own event as long as it is attached to a renderer via the ui::Widget::schedule() method. Such event will be linked to the widget automatically. Renderer can be used to schedule events for any widget via its ui::Renderer::schedule() method. Furthermore, a renderer can schedule event not linked to any widget (this is implemented by linking the event to a dummy widget each renderer creates for its own lifetime). 
+        Inside the UI, event scheduling is a shared responsibility of both the ui::Widget and the ui::Renderer classes. Each event *must* be attached to a widget so that if the widget is detached or deleted, its events can be cancelled (otherwise the events may hold pointers and references to the already dead structures).
+
+        A widget can schedule its own event as long as it is attached to a renderer via the ui::Widget::schedule() method. Such event will be linked to the widget automatically. Renderer can be used to schedule events for any widget via its ui::Renderer::schedule() method. Furthermore, a renderer can schedule event not linked to any widget (this is implemented by linking the event to a dummy widget each renderer creates for its own lifetime).
+
+        Each renderer is given an event queue reference when created that is used to schedule its events. The event queue is decoupled from renderer so that multiple renderers can use the same event queue (such as multiple GUI windows of the same application).
 
-        Each renderer is given an event queue reference when created that is used to schedule its events. The event queue is decoupled from renderer so that multiple renderers can use the same event queue (such as multiple GUI windows of the same application). 
-        
-        The actual renderer implementation should override the ui::Renderer::schedule() method to inform the real main thread that an event has been scheduled so that it can later call the ui::EventQueue::processEvent() method to execute the event. 
+        The actual renderer implementation should override the ui::Renderer::schedule() method to inform the real main thread that an event has been scheduled so that it can later call the ui::EventQueue::processEvents() method to execute the events.
      */
 
-    /** Event queue for widgets. 
+    /** Event queue for widgets.
 
-        Implements an event queue that is capable of scheduling arbitrary code to be executed in the main thread. Each event is tied to a widget and when scheduled, the widget's number of pending events is increased. Similarly, when the event is executed, the corresponding number of pending events is decreased. 
+        Implements an event queue that is capable of scheduling arbitrary code to be executed in the main thread. Any thread can schedule events, but only the main thread executes them, which allows the queue to be a bounded lock-free multiple producer single consumer ring of tasks stored inline. Producers claim their ring entries with a compare and swap on the enqueue position and publish them via the entry's sequence number, which the main thread waits for. If the ring is full, the events are appended to an overflow list under a lock until the main thread empties it, so that scheduling never blocks and the events of each thread are executed in order.
 
-        All events of a given widget can be cancelled, typically when the widget is deleted, or detached from its renderer. 
+        Each event is tied to a widget. Instead of searching the queue for the events of a widget when they are cancelled, typically when the widget is deleted, or detached from its renderer, each widget with scheduled events is assigned a generation counter by the queue and every event remembers the generation of its widget at the time it was scheduled. Cancelling the events of a widget increments its generation so that its events already in the queue are skipped when processed, without the widget itself being accessed. The counter is then released for other widgets and the widget will be assigned a new counter if it schedules events again.
 
-        The event queue only deals with UI events. Depending on the renderer used, it may have its own main thread implementation and event queue. The renderer must make sure that any UI events scheduled in the UI event queue (this class) are correctly integrated in its own event queue and are executed when appropriate by calling the processEvent() method.  
+        The event queue only deals with UI events. Depending on the renderer used, it may have its own main thread implementation and event queue. The renderer must make sure that any UI events scheduled in the UI event queue (this class) are correctly integrated in its own event queue and are executed when appropriate by calling the processEvents() method.
      */
     class EventQueue {
     public:
-        /** Schedules new event linked to the specified widget. 
-         
-            The widget must not be nullptr. Can be called from any thread. 
+        /** Number of events the ring holds before it overflows. */
+        static constexpr size_t CAPACITY = 1024;
+
+        /** Number of times a thread yields and tries again when the ring is full before it uses the overflow list. */
+        static constexpr size_t FULL_RETRIES = 4;
+
+        /** Default maximum number of events executed by single processEvents() call. */
+        static constexpr size_t BATCH_SIZE = 64;
+
+        EventQueue():
+            ring_{new Entry[CAPACITY]} {
+            static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be power of two");
+            for (size_t i = 0; i < CAPACITY; ++i)
+                ring_[i].sequence.store(i, std::memory_order_relaxed);
+            for (auto & chunk : generations_)
+                chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        EventQueue(EventQueue const &) = delete;
+        EventQueue & operator = (EventQueue const &) = delete;
+
+        ~EventQueue() {
+            for (auto & chunk : generations_)
+                delete [] chunk.load(std::memory_order_relaxed);
+        }
+
+        /** Schedules new event linked to the specified widget.
+
+            The event must not be empty and the widget must not be nullptr. Can be called from any thread. Throws if the widget has no scheduled events and the maximum number of widgets with scheduled events has been reached.
          */
-        void schedule(std::function<void()> event, Widget * widget) {
+        void schedule(Task event, Widget * widget) {
+            ASSERT(event) << "Empty event scheduled";
             ASSERT(widget != nullptr);
-            std::lock_guard<std::mutex> g{eventsGuard_};
-            events_.push_back(std::make_pair(event, widget));
-            if (widget != nullptr)
-                ++widget->pendingEvents_;
+            uint64_t token = widget->eventToken_.load(std::memory_order_acquire);
+            if (token == 0)
+                token = assignGeneration(widget);
+            // once the ring overflows, all events go to the overflow list until it is empty to keep their order
+            if (overflowSize_.load(std::memory_order_acquire) == 0) {
+                if (push(event, token))
+                    return;
+                // give the main thread a chance to catch up before overflowing, the main thread itself overflows after the retries
+                for (size_t i = 0; i < FULL_RETRIES; ++i) {
+                    std::this_thread::yield();
+                    if (push(event, token))
+                        return;
+                }
+            }
+            std::lock_guard<std::mutex> g{overflowGuard_};
+            overflow_.push_back(std::make_pair(std::move(event), token));
+            overflowSize_.store(overflow_.size(), std::memory_order_release);
         }
 
-        /** Processes previously scheduled event. 
-         
-            Skips over cancelled events until it finds valid event, which is removed from the queue and executed. If there are no valid events in the queue, returns immediately. 
+        /** Processes previously scheduled events.
 
-            Must be called from the main thread. 
+            Skips over cancelled events and executes valid events in the order they were scheduled until the queue is empty, or given number of events has been executed, returning the number of executed events. Events scheduled by the executed events are executed in the same batch if the limit allows it.
+
+            Must be called from the main thread.
          */
-        bool processEvent() {
-            std::function<void()> handler;
-            {
-                std::lock_guard<std::mutex> g{eventsGuard_};
-                while (true) {
-                    if (events_.empty())
-                        return false;
-                    auto e = events_.front();
-                    events_.pop_front();
-                    if (! e.first)
-                        continue;
-                    if (e.second != nullptr)
-                        --(e.second->pendingEvents_);
-                    handler = e.first;
-                    break;
+        size_t processEvents(size_t maxEvents = BATCH_SIZE) {
+            size_t result = 0;
+            Task event;
+            uint64_t token;
+            while (result < maxEvents && pop(event, token)) {
+                if (event && valid(token)) {
+                    event();
+                    ++result;
                 }
+                event.reset();
             }
-            handler();
-            return true;
+            return result;
         }
 
-        /** Invalidates all events linked to the given widget. 
-         
-            The widget must not be nullptr. Can be called from any thread. 
+        /** Processes single previously scheduled event, if any, and returns true if an event was executed.
+
+            Must be called from the main thread.
+         */
+        bool processEvent() {
+            return processEvents(1) == 1;
+        }
+
+        /** Invalidates all events linked to the given widget.
+
+            The widget must not be nullptr. Can be called from any thread.
          */
         void cancelEvents(Widget * widget) {
             ASSERT(widget != nullptr);
-            std::lock_guard<std::mutex> g{eventsGuard_};
-            if (widget->pendingEvents_ == 0)
+            std::lock_guard<std::mutex> g{generationsGuard_};
+            uint64_t token = widget->eventToken_.exchange(0, std::memory_order_acq_rel);
+            if (token == 0)
                 return;
-            for (auto & e : events_) {
-                if (e.second == widget)
-                    e.first = nullptr;
-                if (--(widget->pendingEvents_) == 0)
-                    break;
-            }
+            generation(IndexOf(token)).fetch_add(1, std::memory_order_release);
+            freeGenerations_.push_back(IndexOf(token));
         }
 
     private:
-        /** The event queue. 
+
+        /** Number of generation counters allocated at once. */
+        static constexpr size_t GENERATIONS_CHUNK = 256;
+
+        /** Maximum number of generation counter chunks, i.e. the maximum number of widgets with scheduled events is 65536. */
+        static constexpr size_t MAX_GENERATION_CHUNKS = 256;
+
+        /** Event in the ring.
+
+            The sequence number equals the entry's position if the entry is free to be claimed by a producer, and the position + 1 when it holds an event.
+         */
+        struct Entry {
+            std::atomic<size_t> sequence;
+            Task event;
+            uint64_t token;
+        };
+
+        /** The widget token consists of the index of the generation counter of the widget + 1 and the generation of the widget, so that 0 means no counter has been assigned.
+         */
+        static uint64_t Token(size_t index, uint32_t generation) {
+            return (static_cast<uint64_t>(index + 1) << 32) | generation;
+        }
+
+        static size_t IndexOf(uint64_t token) {
+            return static_cast<size_t>(token >> 32) - 1;
+        }
+
+        static uint32_t GenerationOf(uint64_t token) {
+            return static_cast<uint32_t>(token);
+        }
+
+        std::atomic<uint32_t> & generation(size_t index) {
+            return generations_[index / GENERATIONS_CHUNK].load(std::memory_order_acquire)[index % GENERATIONS_CHUNK];
+        }
+
+        /** Returns true if the widget of the event has not been cancelled since the event was scheduled.
+         */
+        bool valid(uint64_t token) {
+            return generation(IndexOf(token)).load(std::memory_order_acquire) == GenerationOf(token);
+        }
+
+        /** Assigns a generation counter to the widget, unless another thread did so already, and returns the widget's token.
+         */
+        uint64_t assignGeneration(Widget * widget) {
+            std::lock_guard<std::mutex> g{generationsGuard_};
+            uint64_t token = widget->eventToken_.load(std::memory_order_acquire);
+            if (token != 0)
+                return token;
+            size_t index;
+            if (freeGenerations_.empty()) {
+                if (numGenerations_ == GENERATIONS_CHUNK * MAX_GENERATION_CHUNKS)
+                    THROW(Exception()) << "Too many widgets with scheduled events";
+                index = numGenerations_++;
+                if (index % GENERATIONS_CHUNK == 0) {
+                    std::atomic<uint32_t> * chunk = new std::atomic<uint32_t>[GENERATIONS_CHUNK];
+                    for (size_t i = 0; i < GENERATIONS_CHUNK; ++i)
+                        chunk[i].store(0, std::memory_order_relaxed);
+                    generations_[index / GENERATIONS_CHUNK].store(chunk, std::memory_order_release);
+                }
+            } else {
+                index = freeGenerations_.back();
+                freeGenerations_.pop_back();
+            }
+            token = Token(index, generation(index).load(std::memory_order_relaxed));
+            widget->eventToken_.store(token, std::memory_order_release);
+            return token;
+        }
+
+        /** Moves the event to the ring, returns false if the ring is full.
+         */
+        bool push(Task & event, uint64_t token) {
+            size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            while (true) {
+                Entry & e = ring_[pos & (CAPACITY - 1)];
+                size_t sequence = e.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        e.event = std::move(event);
+                        e.token = token;
+                        e.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    // the entry still holds an event from the previous round
+                    return false;
+                } else {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /** Takes the oldest event.
+
+            The events taken from the overflow list go first, then the events in the ring. When the ring is empty, the whole overflow list is taken at once, after which the threads can use the ring again.
          */
-        std::deque<std::pair<std::function<void()>, Widget*>> events_;
-        /** Event queue guard for multithreaded access. '
+        bool pop(Task & event, uint64_t & token) {
+            if (! backlog_.empty()) {
+                event = std::move(backlog_.front().first);
+                token = backlog_.front().second;
+                backlog_.pop_front();
+                return true;
+            }
+            if (popRing(event, token))
+                return true;
+            if (overflowSize_.load(std::memory_order_acquire) == 0)
+                return false;
+            {
+                std::lock_guard<std::mutex> g{overflowGuard_};
+                // events a thread put in the ring before it started using the overflow list must be executed first, the lock makes them visible
+                if (popRing(event, token))
+                    return true;
+                backlog_.swap(overflow_);
+                overflowSize_.store(0, std::memory_order_release);
+            }
+            return pop(event, token);
+        }
+
+        bool popRing(Task & event, uint64_t & token) {
+            Entry & e = ring_[dequeuePos_ & (CAPACITY - 1)];
+            if (e.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) {
+                if (enqueuePos_.load(std::memory_order_acquire) == dequeuePos_)
+                    return false;
+                // the entry has been claimed by a producer which has not yet stored the event
+                while (e.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1)
+                    std::this_thread::yield();
+            }
+            event = std::move(e.event);
+            token = e.token;
+            e.sequence.store(dequeuePos_ + CAPACITY, std::memory_order_release);
+            ++dequeuePos_;
+            return true;
+        }
+
+        std::unique_ptr<Entry[]> ring_;
+
+        /** Position of the next entry to be claimed by a producer. */
+        alignas(64) std::atomic<size_t> enqueuePos_{0};
+
+        /** Position of the next event to be executed, only accessed by the main thread. */
+        alignas(64) size_t dequeuePos_ = 0;
+
+        /** Events scheduled while the ring was full.
+         */
+        std::deque<std::pair<Task, uint64_t>> overflow_;
+        std::atomic<size_t> overflowSize_{0};
+        std::mutex overflowGuard_;
+
+        /** Events taken from the overflow list, only accessed by the main thread.
          */
-        std::mutex eventsGuard_;
-        
+        std::deque<std::pair<Task, uint64_t>> backlog_;
+
+        /** Generation counters of the widgets, allocated in chunks so that they never move.
+         */
+        std::atomic<std::atomic<uint32_t> *> generations_[MAX_GENERATION_CHUNKS];
+        size_t numGenerations_ = 0;
+        std::vector<size_t> freeGenerations_;
+        /** Guards the assignment and release of the generation counters.
+         */
+        std::mutex generationsGuard_;
+
     }; // ui::EventQueue
 
-}
\ No newline at end of file
+}
@@ -100,6 +100,20 @@ namespace ui {
             return size();
         }
 
+        /** Bits of the font that do not describe the font itself and are free for the widgets to store their own per cell information in.
+         */
+        static constexpr uint16_t CUSTOM_BITS = 0x1f8;
+
+        uint16_t customBits() const {
+            return font_ & CUSTOM_BITS;
+        }
+
+        Font & setCustomBits(uint16_t value) {
+            ASSERT((value & ~CUSTOM_BITS) == 0);
+            font_ = SetBits(font_, CUSTOM_BITS, value);
+            return *this;
+        }
+
         bool operator == (Font const & other) const {
             return font_ == other.font_;
         } 
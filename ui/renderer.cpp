@@ -14,10 +14,8 @@ namespace ui {
 
 
     Renderer::~Renderer() {
-        if (fpsThread_.joinable()) {
-            fps_ = 0;
-            fpsThread_.join();
-        }
+        if (frameTimer_ != 0)
+            TimerService::Instance().cancel(frameTimer_);
         eq_.cancelEvents(eventDummy_);
         delete eventDummy_;
         ASSERT_PANIC(root_ == nullptr) << "Deleting renderer with attached widgets is an error.";
@@ -131,35 +129,53 @@ namespace ui {
         else
             renderWidget_ = renderWidget_->commonParentWith(widget);
         ASSERT(renderWidget_ != nullptr);
-        // if fps is 0, render immediately, otherwise wait for the renderer to paint
+        // while invisible, only remember what to paint
+        if (! visible_)
+            return;
+        // if fps is 0, render immediately, otherwise wait for the next frame
         if (fps_ == 0) 
             paintAndRender();
+        else if (frameTimer_ == 0)
+            scheduleFrame();
     }
 
     void Renderer::paintAndRender() {
         UI_THREAD_ONLY;
-        if (renderWidget_ == nullptr)
+        if (renderWidget_ == nullptr || ! visible_)
             return;
         // paint the widget on the buffer
         renderWidget_->paint();
         // render the visible area of the widget, still under the priority lock
         render(renderWidget_->visibleArea_.bufferRect());
         renderWidget_ = nullptr;
+        lastFrame_ = std::chrono::steady_clock::now();
+        ++framesRendered_;
     }   
 
-    void Renderer::startFPSThread() {
-        if (fpsThread_.joinable())
-            fpsThread_.join();
-        fpsThread_ = std::thread([this](){
-            while (fps_ != 0) {
-                schedule([this](){
-                    paintAndRender();
-                });
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000 / fps_));
-            }
+    void Renderer::scheduleFrame() {
+        UI_THREAD_ONLY;
+        std::chrono::milliseconds frame{std::max(1u, 1000 / fps_)};
+        auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(lastFrame_ + frame - std::chrono::steady_clock::now());
+        // the timer handler only posts the frame to the UI thread, where the timer is cleared, so the timer can't be reset before its token is stored
+        frameTimer_ = TimerService::Instance().schedule(std::max(delay, std::chrono::milliseconds{0}), std::chrono::milliseconds{0}, [this](){
+            schedule([this](){
+                frameTimer_ = 0;
+                paintAndRender();
+            });
+            return false;
         });
     }
 
+    void Renderer::setRendererVisible(bool value) {
+        UI_THREAD_ONLY;
+        if (visible_ == value)
+            return;
+        visible_ = value;
+        // a frame already scheduled when the renderer becomes invisible does nothing, no new frames are scheduled until the root is repainted here
+        if (value && root_ != nullptr)
+            paint(root_);
+    }
+
     // Keyboard Input
 
     void Renderer::setKeyboardFocus(Widget * widget) {
@@ -60,7 +60,7 @@ namespace ui {
 
         The renderer provides interface to schedule functions to be executed in trhe main UI thread. These functions can be tied to a particular widget belonging to the renderer, in which case the scheduled function will only execute igf the widget has not been detached in the meantime. If scheduled function is not tied to a widget, it will always execute as long as the renderer which created it still exists. 
 
-        Internally each renderer has a dummy widget that is used to tie all its unregistered events, and which gets deleted when the renderer is deleted so that the events can be tracked. A widget remembers its number of currently scheduled events and if this is non-zero and the widget is detached, the event queue is examined and the events are descheduled. 
+        Internally each renderer has a dummy widget that is used to tie all its unregistered events, and which gets deleted when the renderer is deleted so that the events can be tracked. When a widget is detached, its events still in the event queue are cancelled. 
 
         The renderer and its event queue are decoupled so that multiple renderer instances running in same thread can share same event queue. The event queue also abstracts of the implementation details of scheduling and executing the events and allows event processing separate from the renderer itself. 
       */
@@ -73,8 +73,8 @@ namespace ui {
 
             This function can be called from any thread as long as it does not clash with the destructor of the renderer. 
          */
-        virtual void schedule(std::function<void()> event, Widget * widget) {
-            eq_.schedule(event, widget);
+        virtual void schedule(Task event, Widget * widget) {
+            eq_.schedule(std::move(event), widget);
         }
 
         /** Schedules the given event in the main UI thread. 
@@ -83,8 +83,8 @@ namespace ui {
 
             This function can be called from any thread as long as it does not clash with the destructor of the renderer. 
          */
-        void schedule(std::function<void()> event) {
-            schedule(event, eventDummy_);
+        void schedule(Task event) {
+            schedule(std::move(event), eventDummy_);
         }
 
         /** Yields to the UI thread. 
@@ -183,6 +183,18 @@ namespace ui {
             return buffer_.size().height();
         }
 
+        /** Returns true if the renderer's window can be seen by the user. 
+         */
+        bool rendererVisible() const {
+            return visible_;
+        }
+
+        /** Returns the number of frames the renderer has rendered so far. 
+         */
+        uint64_t framesRendered() const {
+            return framesRendered_;
+        }
+
         /** Triggers repaint of the entire buffer. 
 
             Can be called from any thread as long as no overlap with destructor is possible. 
@@ -209,16 +221,15 @@ namespace ui {
         }
 
         virtual void setFps(unsigned value) {
-            if (fps_ == value)
-                return;
-            if (fps_ == 0) {
-                fps_ = value;
-                startFPSThread(); 
-            } else {
-                fps_ = value;
-            }
+            fps_ = value;
         }
 
+        /** Updates the visibility of the renderer's window. 
+         
+            Subclasses call the method when the window is minimized, unmapped or fully obscured by other windows so that the renderer does not paint, or render anything while it cannot be seen. The widgets that requested repaint in the meantime are remembered and the root widget is repainted when the window becomes visible again. 
+         */
+        virtual void setRendererVisible(bool value);
+
         /** Returns the visible area of the entire renderer. 
          */
         Canvas::VisibleArea visibleArea() {
@@ -241,20 +252,24 @@ namespace ui {
 
         /** Paints the scheduled widget on the renderer's buffer and calls the render() method immediately. 
          
-            This method is either called by the fps renderer thread (if fps != 0), or by the paint() method and is responsible for actually repainting the scheduled widget. 
+            This method is either scheduled by the frame timer (if fps != 0), or called by the paint() method and is responsible for actually repainting the scheduled widget. Does nothing while the renderer is not visible. 
          */
         void paintAndRender();
 
-        /** Starts the FPS thread. 
+        /** Schedules the next frame. 
          
-            The thread periodically invokes the paintAndRender() method based on the fps value. If fps is 0, the thread is stopped. To start the thread, fps must be set to value > 0. 
+            Frames are only scheduled when there is something to paint so that a renderer whose contents do not change does not wake up at all. The frame is scheduled no sooner than the fps value permits after the previous one. 
          */
-        void startFPSThread();
+        void scheduleFrame();
 
         Buffer buffer_;
         Widget * renderWidget_{nullptr};
         std::atomic<unsigned> fps_{0};
-        std::thread fpsThread_;
+        /** Timer of the scheduled frame, 0 if no frame is scheduled. UI thread only. */
+        TimerService::Token frameTimer_ = 0;
+        std::chrono::steady_clock::time_point lastFrame_;
+        std::atomic<bool> visible_{true};
+        std::atomic<uint64_t> framesRendered_{0};
 
     //@}
 
@@ -35,7 +35,7 @@ namespace ui {
 
             /** Applies the style to given cell. 
              */
-            void applyTo(Canvas::Cell & cell) {
+            void applyTo(Canvas::Cell & cell) const {
                 switch (fg.a) {
                     case Color::OPAQUE:
                         cell.setFg(fg);
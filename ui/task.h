@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "helpers/helpers.h"
+
+namespace ui {
+
+    /** Function scheduled to be executed in the main thread.
+
+        Similar to std::function<void()>, but move-only and with inline storage large enough for the captures of the events the UI schedules so that scheduling an event does not allocate. Larger functions are allocated on the heap.
+
+        Like std::function, a task created from an empty std::function, or a null function pointer, is empty.
+     */
+    class Task {
+    public:
+        /** Size of the inline storage. */
+        static constexpr size_t INLINE_SIZE = 48;
+
+        Task() = default;
+
+        template<typename FUNCTION, typename = std::enable_if_t<! std::is_same_v<std::decay_t<FUNCTION>, Task>>>
+        Task(FUNCTION && f) {
+            using F = std::decay_t<FUNCTION>;
+            if constexpr (std::is_constructible_v<bool, F const &>) {
+                if (! static_cast<bool>(f))
+                    return;
+            }
+            if constexpr (sizeof(F) <= INLINE_SIZE && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>) {
+                new (storage_) F(std::forward<FUNCTION>(f));
+                ops_ = & Inline<F>::Ops;
+            } else {
+                new (storage_) F*(new F(std::forward<FUNCTION>(f)));
+                ops_ = & Heap<F>::Ops;
+            }
+        }
+
+        Task(Task && from) noexcept:
+            ops_{from.ops_} {
+            if (ops_ != nullptr)
+                ops_->relocate(from.storage_, storage_);
+            from.ops_ = nullptr;
+        }
+
+        Task & operator = (Task && from) noexcept {
+            if (this != & from) {
+                reset();
+                ops_ = from.ops_;
+                if (ops_ != nullptr)
+                    ops_->relocate(from.storage_, storage_);
+                from.ops_ = nullptr;
+            }
+            return *this;
+        }
+
+        Task(Task const &) = delete;
+        Task & operator = (Task const &) = delete;
+
+        ~Task() {
+            reset();
+        }
+
+        explicit operator bool () const {
+            return ops_ != nullptr;
+        }
+
+        void operator () () {
+            ASSERT(ops_ != nullptr);
+            ops_->invoke(storage_);
+        }
+
+        /** Returns true if the function is stored inline.
+         */
+        bool isInline() const {
+            return ops_ != nullptr && ops_->isInline;
+        }
+
+        /** Destroys the function, if any.
+         */
+        void reset() {
+            if (ops_ != nullptr) {
+                ops_->destroy(storage_);
+                ops_ = nullptr;
+            }
+        }
+
+    private:
+
+        struct Operations {
+            void (*invoke)(void * storage);
+            /** Moves the function to the other storage and destroys the original. */
+            void (*relocate)(void * from, void * to);
+            void (*destroy)(void * storage);
+            bool isInline;
+        };
+
+        template<typename F>
+        struct Inline {
+            static void Invoke(void * storage) {
+                (*static_cast<F *>(storage))();
+            }
+            static void Relocate(void * from, void * to) {
+                F * f = static_cast<F *>(from);
+                new (to) F(std::move(*f));
+                f->~F();
+            }
+            static void Destroy(void * storage) {
+                static_cast<F *>(storage)->~F();
+            }
+            static constexpr Operations Ops{Invoke, Relocate, Destroy, true};
+        };
+
+        template<typename F>
+        struct Heap {
+            static void Invoke(void * storage) {
+                (**static_cast<F **>(storage))();
+            }
+            static void Relocate(void * from, void * to) {
+                new (to) F*(*static_cast<F **>(from));
+            }
+            static void Destroy(void * storage) {
+                delete *static_cast<F **>(storage);
+            }
+            static constexpr Operations Ops{Invoke, Relocate, Destroy, false};
+        };
+
+        alignas(std::max_align_t) unsigned char storage_[INLINE_SIZE];
+        Operations const * ops_ = nullptr;
+
+    }; // ui::Task
+
+}
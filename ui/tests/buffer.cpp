@@ -0,0 +1,112 @@
+#include "helpers/tests.h"
+
+#include "../canvas.h"
+
+using namespace ui;
+
+namespace {
+
+    using Cell = Canvas::Cell;
+
+    /** Fills each row of the buffer with its own character, starting at 'a'. 
+     */
+    Canvas::Buffer LabeledBuffer(int cols, int rows) {
+        Canvas::Buffer buffer{Size{cols, rows}};
+        for (int row = 0; row < rows; ++row)
+            buffer.fillRow(row, Cell{}.setCodepoint('a' + row), 0, cols);
+        return buffer;
+    }
+
+    /** Returns the rows of the buffer as a string, one character per row, or '?' if the row is not uniform. 
+     */
+    std::string Rows(Canvas::Buffer const & buffer) {
+        std::string result;
+        for (int row = 0; row < buffer.height(); ++row) {
+            char32_t c = buffer.at(0, row).codepoint();
+            for (int col = 1; col < buffer.width(); ++col)
+                if (buffer.at(col, row).codepoint() != c)
+                    c = '?';
+            result.push_back(static_cast<char>(c));
+        }
+        return result;
+    }
+
+    std::string Row(Canvas::Buffer const & buffer, int row) {
+        std::string result;
+        for (int col = 0; col < buffer.width(); ++col)
+            result.push_back(static_cast<char>(buffer.at(col, row).codepoint()));
+        return result;
+    }
+
+} // anonymous namespace
+
+TEST(canvas_buffer, deleteRowsWholeBuffer) {
+    Canvas::Buffer buffer{LabeledBuffer(3, 5)};
+    buffer.deleteRows(0, 5, 2, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Rows(buffer), "cdexx");
+    buffer.deleteRows(0, 5, 4, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Rows(buffer), "xyyyy");
+    // more rows than the region deletes the whole region
+    buffer.deleteRows(0, 5, 10, Cell{}.setCodepoint('z'));
+    EXPECT_EQ(Rows(buffer), "zzzzz");
+}
+
+TEST(canvas_buffer, insertRowsWholeBuffer) {
+    Canvas::Buffer buffer{LabeledBuffer(3, 5)};
+    buffer.insertRows(0, 5, 2, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Rows(buffer), "xxabc");
+    buffer.insertRows(0, 5, 1, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Rows(buffer), "yxxab");
+}
+
+TEST(canvas_buffer, scrollRegion) {
+    Canvas::Buffer buffer{LabeledBuffer(3, 6)};
+    buffer.deleteRows(1, 5, 2, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Rows(buffer), "adexxf");
+    buffer.insertRows(2, 6, 3, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Rows(buffer), "adyyye");
+}
+
+/** Scroll regions must work after the whole buffer has been scrolled, i.e. when its rows wrap around. 
+ */
+TEST(canvas_buffer, scrollRegionAfterRotation) {
+    Canvas::Buffer buffer{LabeledBuffer(3, 6)};
+    buffer.deleteRows(0, 6, 4, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Rows(buffer), "efxxxx");
+    buffer.at(0, 3).setCodepoint('g');
+    buffer.deleteRows(1, 4, 1, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Rows(buffer), "ex?yxx");
+    buffer.insertRows(0, 6, 1, Cell{}.setCodepoint('z'));
+    EXPECT_EQ(Rows(buffer), "zex?yx");
+}
+
+TEST(canvas_buffer, deleteCells) {
+    Canvas::Buffer buffer{Size{6, 1}};
+    for (int col = 0; col < 6; ++col)
+        buffer.at(col, 0).setCodepoint('a' + col);
+    buffer.deleteCells(0, 1, 2, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Row(buffer, 0), "adefxx");
+    // more cells than left in the row
+    buffer.deleteCells(0, 4, 10, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Row(buffer, 0), "adefyy");
+    buffer.deleteCells(0, 6, 1, Cell{}.setCodepoint('z'));
+    EXPECT_EQ(Row(buffer, 0), "adefyy");
+}
+
+TEST(canvas_buffer, insertCells) {
+    Canvas::Buffer buffer{Size{6, 1}};
+    for (int col = 0; col < 6; ++col)
+        buffer.at(col, 0).setCodepoint('a' + col);
+    buffer.insertCells(0, 1, 2, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Row(buffer, 0), "axxbcd");
+    buffer.insertCells(0, 4, 10, Cell{}.setCodepoint('y'));
+    EXPECT_EQ(Row(buffer, 0), "axxbyy");
+}
+
+TEST(canvas_buffer, fillRect) {
+    Canvas::Buffer buffer{LabeledBuffer(5, 3)};
+    buffer.fillRect(Rect{Point{1, 1}, Point{10, 10}}, Cell{}.setCodepoint('x'));
+    EXPECT_EQ(Row(buffer, 0), "aaaaa");
+    EXPECT_EQ(Row(buffer, 1), "bxxxx");
+    EXPECT_EQ(Row(buffer, 2), "cxxxx");
+}
@@ -0,0 +1,40 @@
+#include "helpers/tests.h"
+
+#include "../canvas.h"
+
+using namespace ui;
+
+namespace {
+
+    std::string LineText(Canvas::TextLine const & line) {
+        return std::string{line.begin.charPtr(), line.end.charPtr()};
+    }
+
+} // anonymous namespace
+
+TEST(canvas, textMetricsWordWrap) {
+    // the lines point to the text
+    std::string text{"hello big world\nx"};
+    std::vector<Canvas::TextLine> lines = Canvas::GetTextMetrics(text, 10);
+    EXPECT_EQ(lines.size(), 3);
+    EXPECT_EQ(LineText(lines[0]), "hello big");
+    EXPECT_EQ(lines[0].width, 9);
+    EXPECT_EQ(lines[0].chars, 9);
+    EXPECT_EQ(LineText(lines[1]), "world");
+    EXPECT_EQ(LineText(lines[2]), "x");
+    // words longer than the line are broken mid-word
+    text = "abcdefgh";
+    lines = Canvas::GetTextMetrics(text, 3);
+    EXPECT_EQ(lines.size(), 3);
+    EXPECT_EQ(LineText(lines[0]), "abc");
+    EXPECT_EQ(LineText(lines[2]), "gh");
+}
+
+TEST(canvas, textMetricsInvalidUTF8) {
+    // the truncated sequence is measured as a single replacement character, as drawn by textOut
+    std::string text{"a\xe4\xb8" "b\xe4\xb8\xad"};
+    std::vector<Canvas::TextLine> lines = Canvas::GetTextMetrics(text);
+    EXPECT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0].chars, 4);
+    EXPECT_EQ(lines[0].width, 5);
+}
@@ -0,0 +1,128 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helpers/tests.h"
+
+#include "../event_queue.h"
+
+using namespace ui;
+
+TEST(event_queue, executesInOrder) {
+    EventQueue eq;
+    Widget w;
+    std::vector<size_t> executed;
+    // more events than the ring holds so that some of them overflow
+    size_t n = EventQueue::CAPACITY * 2 + 10;
+    for (size_t i = 0; i < n; ++i)
+        eq.schedule([& executed, i]() { executed.push_back(i); }, & w);
+    EXPECT_EQ(eq.processEvents(10), 10);
+    // events scheduled while the overflow list is not empty go after it
+    eq.schedule([& executed, n]() { executed.push_back(n); }, & w);
+    while (eq.processEvents() > 0) {
+    }
+    EXPECT_EQ(executed.size(), n + 1);
+    bool ordered = true;
+    for (size_t i = 0; i < executed.size(); ++i)
+        ordered = ordered && executed[i] == i;
+    EXPECT(ordered);
+    EXPECT(! eq.processEvent());
+    eq.cancelEvents(& w);
+}
+
+TEST(event_queue, cancelsEventsOfWidget) {
+    EventQueue eq;
+    Widget a;
+    Widget b;
+    std::string executed;
+    eq.schedule([& executed]() { executed += "a"; }, & a);
+    eq.schedule([& executed]() { executed += "b"; }, & b);
+    eq.schedule([& executed]() { executed += "a"; }, & a);
+    eq.cancelEvents(& a);
+    // events scheduled after the cancellation are executed, even if the widget's generation counter is reused by another widget
+    eq.schedule([& executed]() { executed += "B"; }, & b);
+    eq.schedule([& executed]() { executed += "A"; }, & a);
+    EXPECT_EQ(eq.processEvents(), 3);
+    EXPECT_EQ(executed, "bBA");
+    eq.cancelEvents(& a);
+    eq.cancelEvents(& b);
+}
+
+TEST(event_queue, limitsWidgetsWithEvents) {
+    EventQueue eq;
+    size_t n = 256 * 256;
+    std::unique_ptr<Widget[]> widgets{new Widget[n + 1]};
+    for (size_t i = 0; i < n; ++i)
+        eq.schedule([]() {}, & widgets[i]);
+    EXPECT_THROWS(Exception, eq.schedule([]() {}, & widgets[n]));
+    // cancelled widgets release their generation counters for others
+    eq.cancelEvents(& widgets[0]);
+    eq.schedule([]() {}, & widgets[n]);
+    for (size_t i = 0; i <= n; ++i)
+        eq.cancelEvents(& widgets[i]);
+}
+
+TEST(event_queue, schedulesFromManyThreads) {
+    EventQueue eq;
+    size_t const threads = 4;
+    size_t const events = EventQueue::CAPACITY;
+    std::vector<Widget *> widgets;
+    std::vector<size_t> last(threads, 0);
+    bool ordered = true;
+    for (size_t i = 0; i < threads; ++i)
+        widgets.push_back(new Widget{});
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < threads; ++i) {
+        producers.emplace_back([&, i]() {
+            for (size_t j = 1; j <= events; ++j)
+                eq.schedule([&, i, j]() { ordered = ordered && last[i] + 1 == j; last[i] = j; }, widgets[i]);
+        });
+    }
+    for (size_t done = 0; done < threads * events; ) {
+        size_t n = eq.processEvents();
+        if (n == 0)
+            std::this_thread::yield();
+        done += n;
+    }
+    for (std::thread & t : producers)
+        t.join();
+    EXPECT(ordered);
+    for (Widget * w : widgets) {
+        eq.cancelEvents(w);
+        delete w;
+    }
+}
+
+TEST(event_queue, taskStorage) {
+    size_t calls = 0;
+    Task small{[& calls]() { ++calls; }};
+    EXPECT(small.isInline());
+    char large[Task::INLINE_SIZE + 1] = {};
+    Task big{[& calls, large]() { calls += 1 + large[0]; }};
+    EXPECT(! big.isInline());
+    // functions keep their captures when moved
+    Task moved{std::move(big)};
+    EXPECT(! big);
+    moved();
+    Task other;
+    other = std::move(small);
+    other();
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(event_queue, taskFromEmptyFunction) {
+    std::function<void()> f;
+    Task empty{f};
+    EXPECT(! empty);
+    void (*fptr)() = nullptr;
+    Task null{fptr};
+    EXPECT(! null);
+    size_t calls = 0;
+    f = [& calls]() { ++calls; };
+    Task task{f};
+    EXPECT(static_cast<bool>(task));
+    task();
+    EXPECT_EQ(calls, 1);
+}
@@ -9,10 +9,10 @@ namespace ui {
 
     // ============================================================================================
 
-    void Widget::schedule(std::function<void()> event) {
+    void Widget::schedule(Task event) {
         std::lock_guard<std::mutex> g{rendererGuard_};
         if (renderer_ != nullptr)
-            renderer_->schedule(event, this);
+            renderer_->schedule(std::move(event), this);
     }
 
     // ============================================================================================
@@ -9,6 +9,7 @@
 #include "events.h"
 #include "canvas.h"
 #include "layout.h"
+#include "task.h"
 
 #ifndef NDEBUG
 
@@ -51,7 +52,7 @@ namespace ui {
 
         The widget has a shorthand schedule() method which can be used to schedule a new event linked to the widget.
 
-        Each widget also remembers the number of pending events, i.e. events that were scheduled, but not yet executed so that when the widget is detached, the events can be cancelled automatically.
+        Each widget also remembers its generation counter in the event queue, which allows the pending events, i.e. events that were scheduled, but not yet executed, to be cancelled automatically when the widget is detached.
      */
     //@{
 #ifndef NDEBUG
@@ -71,14 +72,14 @@ namespace ui {
 
             Does nothing if the widget is not attached to a renderer.
          */
-        void schedule(std::function<void()> event);
+        void schedule(Task event);
 
     private:
-        /** Number of pending events linked to the widget.
+        /** Generation counter of the widget in the event queue and the current generation, 0 if the widget has no counter assigned.
 
-            These are only accessed from the event queue and such are protected by the event queue access mutex.
+            This is only accessed by the event queue, see ui::EventQueue for details.
          */
-        size_t pendingEvents_{0};
+        std::atomic<uint64_t> eventToken_{0};
 
     //@}
 
@@ -33,12 +33,14 @@ namespace ui {
 
         /** Removes given page from the pager. 
          
-            If the removed page is active, moves the active page to the previous one and triggers the onPageChange event. 
+            If the removed page is active, moves the active page to the previous one, makes it visible and triggers the onPageChange event. 
          */
         void removePage(Widget * page) {
             Widget * oldActivePage = activePage();
             detach(page);
             if (page == oldActivePage) {
+                if (activePage() != nullptr)
+                    activePage()->setVisible(true);
                 Event<Widget*>::Payload p{activePage()};
                 onPageChange(p, this);
             }